@@ -0,0 +1,988 @@
+/**
+ * @file BPlusTree.hh
+ * @brief Árbol B+ con tamaño de nodo configurable, alternativa a BST y RedBlackTree para mapas grandes
+ */
+
+#ifndef __BPLUS_TREE__
+#define __BPLUS_TREE__
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+/*1. Nodos anchos con tamaño en bytes
+
+Qué es: Cada nodo ocupa unos NodeBytes bytes (256 B a 4 KB) y guarda decenas
+o cientos de claves. Las capacidades se calculan a partir de NodeBytes y de
+sizeof(Key) / sizeof(Value)
+Por qué: En BST y RedBlackTree cada nivel es un nodo distinto y casi siempre
+un fallo de caché. Con nodos anchos el árbol tiene log_B(n) niveles (3 o 4
+para 100M claves) y dentro del nodo las claves se leen seguidas.
+
+2. Claves contiguas y búsqueda binaria sin saltos
+
+Qué es: Las claves de un nodo están en su propio arreglo (los valores o hijos
+en otro) y la búsqueda dentro del nodo usa la forma de Khuong y Morin, donde
+cada paso es una selección (cmov) y no un salto condicional
+Por qué: El procesador no puede predecir los saltos de una búsqueda binaria,
+así que cada paso mal predicho cuesta ~15 ciclos. Sin saltos, el número de
+pasos es fijo (log2 del número de claves) y la prebúsqueda funciona.
+
+3. Datos solo en las hojas, hojas enlazadas
+
+Qué es: Los nodos internos guardan solo separadores; todos los pares
+Key-Value están en las hojas, enlazadas con next / prev
+Por qué: Un recorrido por rango baja una vez hasta la primera hoja y después
+lee hojas completas una tras otra, sin volver a subir por el árbol.
+findSuccessor / findPredecessor tampoco suben: saltan a la hoja vecina.
+
+4. Un espacio extra por nodo
+
+Qué es: Los arreglos tienen capacidad + 1 posiciones; se inserta normalmente
+y, si el nodo queda con una de más, se divide en dos mitades
+Por qué: Dividir después de insertar es un solo caso en vez de decidir de
+antemano en qué mitad cae la clave nueva.*/
+
+/**
+ * @class BPlusTree
+ * @brief Árbol B+ con pares Key-Value y la misma interfaz que BST
+ * @tparam Key Tipo de dato para la clave (comparable con operator<, con constructor por defecto)
+ * @tparam Value Tipo de dato para el valor (con constructor por defecto)
+ * @tparam NodeBytes Tamaño aproximado de cada nodo en bytes (por defecto 1 KB)
+ *
+ * insert / find / remove / findMin / findMax / findSuccessor / findPredecessor
+ * se comportan como en BST, pero todas son O(log n) garantizado. Los punteros
+ * devueltos por getValue se invalidan con el siguiente insert o remove.
+ */
+template <typename Key, typename Value, std::size_t NodeBytes = 1024>
+class BPlusTree
+{
+private:
+    /**
+     * @brief Capacidad de un nodo de NodeBytes con un encabezado y entradas del tamaño dado
+     *
+     * Reserva el espacio extra de la división y nunca baja de 4 entradas.
+     */
+    static constexpr unsigned int capacityFor(std::size_t header, std::size_t entry)
+    {
+        return (NodeBytes > header + 5 * entry) ? static_cast<unsigned int>((NodeBytes - header) / entry - 1) : 4;
+    }
+
+public:
+    static constexpr unsigned int LEAF_CAPACITY =
+        capacityFor(sizeof(unsigned int) + 2 * sizeof(void *), sizeof(Key) + sizeof(Value)); ///< Pares por hoja
+    static constexpr unsigned int INNER_CAPACITY =
+        capacityFor(sizeof(unsigned int) + sizeof(void *), sizeof(Key) + sizeof(void *)); ///< Separadores por nodo interno
+
+private:
+    static constexpr unsigned int LEAF_MIN = LEAF_CAPACITY / 2;   ///< Mínimo de pares en una hoja que no es raíz
+    static constexpr unsigned int INNER_MIN = INNER_CAPACITY / 2; ///< Mínimo de separadores en un interno que no es raíz
+
+    /**
+     * @struct Node
+     * @brief Encabezado común de hojas y nodos internos
+     */
+    struct Node
+    {
+        unsigned int count; ///< Pares (hoja) o separadores (interno) en uso
+        bool leaf;          ///< true si es una hoja
+
+        explicit Node(bool isLeaf) : count(0), leaf(isLeaf) {}
+    };
+
+    /**
+     * @struct Leaf
+     * @brief Hoja: pares ordenados por clave, enlazada con sus vecinas
+     */
+    struct Leaf : Node
+    {
+        Key keys[LEAF_CAPACITY + 1];     ///< Claves ordenadas (contiguas para la búsqueda)
+        Value values[LEAF_CAPACITY + 1]; ///< values[i] es el valor de keys[i]
+        Leaf *next;                      ///< Hoja siguiente en orden (nullptr en la última)
+        Leaf *prev;                      ///< Hoja anterior en orden (nullptr en la primera)
+
+        Leaf() : Node(true), next(nullptr), prev(nullptr) {}
+    };
+
+    /**
+     * @struct Inner
+     * @brief Nodo interno: count separadores y count + 1 hijos
+     *
+     * Todas las claves de children[i] son < keys[i] <= todas las claves de children[i + 1].
+     */
+    struct Inner : Node
+    {
+        Key keys[INNER_CAPACITY + 1];       ///< Separadores ordenados
+        Node *children[INNER_CAPACITY + 2]; ///< Hijos (todos hojas o todos internos)
+
+        Inner() : Node(false) {}
+    };
+
+    Node *root;      ///< Raíz del árbol (nullptr si está vacío)
+    Leaf *head;      ///< Primera hoja (clave mínima)
+    Leaf *tail;      ///< Última hoja (clave máxima)
+    unsigned int sz; ///< Número de pares en el árbol
+    int levels;      ///< Niveles de nodos internos (0 si la raíz es una hoja, -1 si está vacío)
+
+    // ==================== BÚSQUEDA DENTRO DE UN NODO ====================
+
+    /**
+     * @brief Número de claves de keys[0..n) menores que k
+     * @complexity O(log n) pasos sin saltos condicionales
+     */
+    static unsigned int lowerBoundIndex(const Key *keys, unsigned int n, const Key &k)
+    {
+        if (n == 0)
+            return 0;
+        const Key *base = keys;
+        while (n > 1)
+        {
+            unsigned int half = n / 2;
+            base = (base[half] < k) ? base + half : base;
+            n -= half;
+        }
+        return static_cast<unsigned int>(base - keys) + (*base < k ? 1 : 0);
+    }
+
+    /**
+     * @brief Número de claves de keys[0..n) menores o iguales que k
+     * @complexity O(log n) pasos sin saltos condicionales
+     */
+    static unsigned int upperBoundIndex(const Key *keys, unsigned int n, const Key &k)
+    {
+        if (n == 0)
+            return 0;
+        const Key *base = keys;
+        while (n > 1)
+        {
+            unsigned int half = n / 2;
+            base = (k < base[half]) ? base : base + half;
+            n -= half;
+        }
+        return static_cast<unsigned int>(base - keys) + (k < *base ? 0 : 1);
+    }
+
+    // ==================== MÉTODOS AUXILIARES DE BÚSQUEDA ====================
+
+    /**
+     * @brief Baja desde la raíz hasta la hoja que contiene (o contendría) k
+     * @return Hoja correspondiente (el árbol no debe estar vacío)
+     */
+    Leaf *findLeaf(const Key &k) const
+    {
+        Node *x = root;
+        while (!x->leaf)
+        {
+            Inner *in = static_cast<Inner *>(x);
+            x = in->children[upperBoundIndex(in->keys, in->count, k)];
+        }
+        return static_cast<Leaf *>(x);
+    }
+
+    /**
+     * @brief Busca el valor de una clave
+     * @return Puntero al valor o nullptr
+     */
+    Value *searchHelper(const Key &k) const
+    {
+        if (root == nullptr)
+            return nullptr;
+        Leaf *leaf = findLeaf(k);
+        unsigned int i = lowerBoundIndex(leaf->keys, leaf->count, k);
+        if (i < leaf->count && !(k < leaf->keys[i]))
+            return &leaf->values[i];
+        return nullptr;
+    }
+
+    // ==================== MÉTODOS AUXILIARES DE INSERCIÓN ====================
+
+    /**
+     * @brief Divide una hoja con LEAF_CAPACITY + 1 pares
+     * @param leaf Hoja llena de más (conserva la primera mitad)
+     * @param sep Recibe la primera clave de la hoja nueva
+     * @return Hoja nueva con la segunda mitad
+     */
+    Leaf *splitLeaf(Leaf *leaf, Key &sep)
+    {
+        Leaf *right = new Leaf();
+        unsigned int keep = leaf->count / 2;
+        right->count = leaf->count - keep;
+        std::move(leaf->keys + keep, leaf->keys + leaf->count, right->keys);
+        std::move(leaf->values + keep, leaf->values + leaf->count, right->values);
+        leaf->count = keep;
+
+        right->next = leaf->next;
+        right->prev = leaf;
+        if (leaf->next != nullptr)
+            leaf->next->prev = right;
+        else
+            tail = right;
+        leaf->next = right;
+
+        sep = right->keys[0];
+        return right;
+    }
+
+    /**
+     * @brief Divide un nodo interno con INNER_CAPACITY + 1 separadores
+     * @param in Nodo lleno de más (conserva la primera mitad)
+     * @param sep Recibe el separador del medio, que sube al padre
+     * @return Nodo nuevo con la segunda mitad
+     */
+    Inner *splitInner(Inner *in, Key &sep)
+    {
+        Inner *right = new Inner();
+        unsigned int mid = in->count / 2;
+        right->count = in->count - mid - 1;
+        sep = std::move(in->keys[mid]);
+        std::move(in->keys + mid + 1, in->keys + in->count, right->keys);
+        std::copy(in->children + mid + 1, in->children + in->count + 1, right->children);
+        in->count = mid;
+        return right;
+    }
+
+    /**
+     * @brief Inserta o actualiza un par en el subárbol x
+     * @param sep Si x se dividió, recibe el separador de la mitad nueva
+     * @return Mitad nueva si x se dividió, nullptr si no
+     */
+    Node *insertHelper(Node *x, const Key &k, const Value &v, Key &sep)
+    {
+        if (x->leaf)
+        {
+            Leaf *leaf = static_cast<Leaf *>(x);
+            unsigned int i = lowerBoundIndex(leaf->keys, leaf->count, k);
+            if (i < leaf->count && !(k < leaf->keys[i]))
+            {
+                leaf->values[i] = v; // La clave ya existe: actualizar
+                return nullptr;
+            }
+            std::move_backward(leaf->keys + i, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+            std::move_backward(leaf->values + i, leaf->values + leaf->count, leaf->values + leaf->count + 1);
+            leaf->keys[i] = k;
+            leaf->values[i] = v;
+            leaf->count++;
+            sz++;
+            return leaf->count > LEAF_CAPACITY ? splitLeaf(leaf, sep) : nullptr;
+        }
+
+        Inner *in = static_cast<Inner *>(x);
+        unsigned int i = upperBoundIndex(in->keys, in->count, k);
+        Key childSep;
+        Node *sibling = insertHelper(in->children[i], k, v, childSep);
+        if (sibling == nullptr)
+            return nullptr;
+
+        // El hijo se dividió: su mitad nueva entra a la derecha de children[i]
+        std::move_backward(in->keys + i, in->keys + in->count, in->keys + in->count + 1);
+        std::copy_backward(in->children + i + 1, in->children + in->count + 1, in->children + in->count + 2);
+        in->keys[i] = std::move(childSep);
+        in->children[i + 1] = sibling;
+        in->count++;
+        return in->count > INNER_CAPACITY ? splitInner(in, sep) : nullptr;
+    }
+
+    // ==================== MÉTODOS AUXILIARES DE ELIMINACIÓN ====================
+
+    /**
+     * @brief Quita el separador j y el hijo j + 1 de un nodo interno
+     */
+    static void removeFromInner(Inner *in, unsigned int j)
+    {
+        std::move(in->keys + j + 1, in->keys + in->count, in->keys + j);
+        std::copy(in->children + j + 2, in->children + in->count + 1, in->children + j + 1);
+        in->count--;
+    }
+
+    /**
+     * @brief Une la hoja children[j + 1] en children[j]
+     */
+    void mergeLeaves(Inner *in, unsigned int j)
+    {
+        Leaf *left = static_cast<Leaf *>(in->children[j]);
+        Leaf *right = static_cast<Leaf *>(in->children[j + 1]);
+        std::move(right->keys, right->keys + right->count, left->keys + left->count);
+        std::move(right->values, right->values + right->count, left->values + left->count);
+        left->count += right->count;
+
+        left->next = right->next;
+        if (right->next != nullptr)
+            right->next->prev = left;
+        else
+            tail = left;
+
+        removeFromInner(in, j);
+        delete right;
+    }
+
+    /**
+     * @brief Une el nodo interno children[j + 1] en children[j], bajando el separador j
+     */
+    void mergeInners(Inner *in, unsigned int j)
+    {
+        Inner *left = static_cast<Inner *>(in->children[j]);
+        Inner *right = static_cast<Inner *>(in->children[j + 1]);
+        left->keys[left->count] = std::move(in->keys[j]);
+        std::move(right->keys, right->keys + right->count, left->keys + left->count + 1);
+        std::copy(right->children, right->children + right->count + 1, left->children + left->count + 1);
+        left->count += right->count + 1;
+
+        removeFromInner(in, j);
+        delete right;
+    }
+
+    /**
+     * @brief Corrige el hijo i de in, que quedó con menos del mínimo
+     *
+     * Pide prestado un elemento a un hermano con sobrantes; si ninguno tiene,
+     * se une con uno de ellos.
+     */
+    void rebalanceChild(Inner *in, unsigned int i)
+    {
+        Node *left = (i > 0) ? in->children[i - 1] : nullptr;
+        Node *right = (i < in->count) ? in->children[i + 1] : nullptr;
+
+        if (in->children[i]->leaf)
+        {
+            Leaf *child = static_cast<Leaf *>(in->children[i]);
+            Leaf *l = static_cast<Leaf *>(left);
+            Leaf *r = static_cast<Leaf *>(right);
+            if (l != nullptr && l->count > LEAF_MIN)
+            {
+                // Mover el último par de la hermana izquierda al inicio
+                std::move_backward(child->keys, child->keys + child->count, child->keys + child->count + 1);
+                std::move_backward(child->values, child->values + child->count, child->values + child->count + 1);
+                child->keys[0] = std::move(l->keys[l->count - 1]);
+                child->values[0] = std::move(l->values[l->count - 1]);
+                l->count--;
+                child->count++;
+                in->keys[i - 1] = child->keys[0];
+            }
+            else if (r != nullptr && r->count > LEAF_MIN)
+            {
+                // Mover el primer par de la hermana derecha al final
+                child->keys[child->count] = std::move(r->keys[0]);
+                child->values[child->count] = std::move(r->values[0]);
+                child->count++;
+                std::move(r->keys + 1, r->keys + r->count, r->keys);
+                std::move(r->values + 1, r->values + r->count, r->values);
+                r->count--;
+                in->keys[i] = r->keys[0];
+            }
+            else
+            {
+                mergeLeaves(in, (l != nullptr) ? i - 1 : i);
+            }
+            return;
+        }
+
+        Inner *child = static_cast<Inner *>(in->children[i]);
+        Inner *l = static_cast<Inner *>(left);
+        Inner *r = static_cast<Inner *>(right);
+        if (l != nullptr && l->count > INNER_MIN)
+        {
+            // Rotar a la derecha: el separador baja y el último de la izquierda sube
+            std::move_backward(child->keys, child->keys + child->count, child->keys + child->count + 1);
+            std::copy_backward(child->children, child->children + child->count + 1, child->children + child->count + 2);
+            child->keys[0] = std::move(in->keys[i - 1]);
+            child->children[0] = l->children[l->count];
+            in->keys[i - 1] = std::move(l->keys[l->count - 1]);
+            l->count--;
+            child->count++;
+        }
+        else if (r != nullptr && r->count > INNER_MIN)
+        {
+            // Rotar a la izquierda: el separador baja y el primero de la derecha sube
+            child->keys[child->count] = std::move(in->keys[i]);
+            child->children[child->count + 1] = r->children[0];
+            child->count++;
+            in->keys[i] = std::move(r->keys[0]);
+            std::move(r->keys + 1, r->keys + r->count, r->keys);
+            std::copy(r->children + 1, r->children + r->count + 1, r->children);
+            r->count--;
+        }
+        else
+        {
+            mergeInners(in, (l != nullptr) ? i - 1 : i);
+        }
+    }
+
+    /**
+     * @brief Elimina k del subárbol x
+     * @return true si se eliminó, false si no existía
+     */
+    bool removeHelper(Node *x, const Key &k)
+    {
+        if (x->leaf)
+        {
+            Leaf *leaf = static_cast<Leaf *>(x);
+            unsigned int i = lowerBoundIndex(leaf->keys, leaf->count, k);
+            if (i == leaf->count || k < leaf->keys[i])
+                return false;
+            std::move(leaf->keys + i + 1, leaf->keys + leaf->count, leaf->keys + i);
+            std::move(leaf->values + i + 1, leaf->values + leaf->count, leaf->values + i);
+            leaf->count--;
+            return true;
+        }
+
+        Inner *in = static_cast<Inner *>(x);
+        unsigned int i = upperBoundIndex(in->keys, in->count, k);
+        if (!removeHelper(in->children[i], k))
+            return false;
+        Node *child = in->children[i];
+        if (child->count < (child->leaf ? LEAF_MIN : INNER_MIN))
+            rebalanceChild(in, i);
+        return true;
+    }
+
+    // ==================== MÉTODOS AUXILIARES DE UTILIDAD ====================
+
+    /**
+     * @brief Libera un nodo con su tipo real
+     */
+    static void deleteNode(Node *x)
+    {
+        if (x->leaf)
+            delete static_cast<Leaf *>(x);
+        else
+            delete static_cast<Inner *>(x);
+    }
+
+    /**
+     * @brief Elimina todos los nodos de un subárbol
+     */
+    static void clearHelper(Node *x)
+    {
+        if (x == nullptr)
+            return;
+        if (!x->leaf)
+        {
+            Inner *in = static_cast<Inner *>(x);
+            for (unsigned int i = 0; i <= in->count; i++)
+                clearHelper(in->children[i]);
+        }
+        deleteNode(x);
+    }
+
+    /**
+     * @brief Copia un subárbol y encadena sus hojas detrás de last
+     * @param last Última hoja copiada hasta ahora (se actualiza)
+     * @return Copia del subárbol
+     */
+    Node *copyHelper(const Node *x, Leaf *&last)
+    {
+        if (x->leaf)
+        {
+            const Leaf *leaf = static_cast<const Leaf *>(x);
+            Leaf *copy = new Leaf();
+            copy->count = leaf->count;
+            std::copy(leaf->keys, leaf->keys + leaf->count, copy->keys);
+            std::copy(leaf->values, leaf->values + leaf->count, copy->values);
+            copy->prev = last;
+            if (last != nullptr)
+                last->next = copy;
+            else
+                head = copy;
+            last = copy;
+            return copy;
+        }
+        const Inner *in = static_cast<const Inner *>(x);
+        Inner *copy = new Inner();
+        copy->count = in->count;
+        std::copy(in->keys, in->keys + in->count, copy->keys);
+        for (unsigned int i = 0; i <= in->count; i++)
+            copy->children[i] = copyHelper(in->children[i], last);
+        return copy;
+    }
+
+    /**
+     * @brief Verifica un subárbol: claves ordenadas, dentro de [lo, hi), ocupación mínima y profundidad
+     * @param lo Cota inferior (incluida) o nullptr
+     * @param hi Cota superior (excluida) o nullptr
+     * @param depth Niveles internos por encima de x
+     * @param nodes Cuenta de nodos visitados
+     */
+    bool verifyHelper(const Node *x, const Key *lo, const Key *hi, int depth, unsigned int &nodes) const
+    {
+        nodes++;
+        bool isRoot = (x == root);
+        if (x->leaf)
+        {
+            const Leaf *leaf = static_cast<const Leaf *>(x);
+            if (depth != levels || leaf->count > LEAF_CAPACITY || (!isRoot && leaf->count < LEAF_MIN))
+                return false;
+            for (unsigned int i = 0; i < leaf->count; i++)
+            {
+                if (i > 0 && !(leaf->keys[i - 1] < leaf->keys[i]))
+                    return false;
+                if ((lo != nullptr && leaf->keys[i] < *lo) || (hi != nullptr && !(leaf->keys[i] < *hi)))
+                    return false;
+            }
+            return true;
+        }
+
+        const Inner *in = static_cast<const Inner *>(x);
+        if (in->count > INNER_CAPACITY || (isRoot ? in->count == 0 : in->count < INNER_MIN))
+            return false;
+        for (unsigned int i = 0; i < in->count; i++)
+        {
+            if (i > 0 && !(in->keys[i - 1] < in->keys[i]))
+                return false;
+            if ((lo != nullptr && in->keys[i] < *lo) || (hi != nullptr && !(in->keys[i] < *hi)))
+                return false;
+        }
+        for (unsigned int i = 0; i <= in->count; i++)
+        {
+            const Key *childLo = (i == 0) ? lo : &in->keys[i - 1];
+            const Key *childHi = (i == in->count) ? hi : &in->keys[i];
+            if (!verifyHelper(in->children[i], childLo, childHi, depth + 1, nodes))
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Imprime un subárbol con una línea por nodo
+     */
+    void printTreeHelper(const Node *x, const std::string &prefix) const
+    {
+        std::cout << prefix << (x->leaf ? "hoja [" : "[");
+        const Key *keys = x->leaf ? static_cast<const Leaf *>(x)->keys : static_cast<const Inner *>(x)->keys;
+        for (unsigned int i = 0; i < x->count; i++)
+            std::cout << (i > 0 ? " " : "") << keys[i];
+        std::cout << "]" << std::endl;
+        if (!x->leaf)
+        {
+            const Inner *in = static_cast<const Inner *>(x);
+            for (unsigned int i = 0; i <= in->count; i++)
+                printTreeHelper(in->children[i], prefix + "    ");
+        }
+    }
+
+public:
+    // ==================== CONSTRUCTORES Y DESTRUCTOR ====================
+
+    /**
+     * @brief Constructor por defecto - Crea un árbol vacío
+     * @complexity O(1)
+     */
+    BPlusTree() : root(nullptr), head(nullptr), tail(nullptr), sz(0), levels(-1) {}
+
+    /**
+     * @brief Constructor de copia
+     * @complexity O(n)
+     */
+    BPlusTree(const BPlusTree &other) : root(nullptr), head(nullptr), tail(nullptr), sz(other.sz), levels(other.levels)
+    {
+        if (other.root != nullptr)
+        {
+            Leaf *last = nullptr;
+            root = copyHelper(other.root, last);
+            tail = last;
+        }
+    }
+
+    /**
+     * @brief Constructor de movimiento
+     * @complexity O(1)
+     */
+    BPlusTree(BPlusTree &&other)
+        : root(other.root), head(other.head), tail(other.tail), sz(other.sz), levels(other.levels)
+    {
+        other.root = nullptr;
+        other.head = other.tail = nullptr;
+        other.sz = 0;
+        other.levels = -1;
+    }
+
+    /**
+     * @brief Operador de asignación
+     * @complexity O(n)
+     */
+    BPlusTree &operator=(const BPlusTree &other)
+    {
+        if (this != &other)
+        {
+            BPlusTree copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Asignación por movimiento
+     * @complexity O(n) para liberar el contenido actual
+     */
+    BPlusTree &operator=(BPlusTree &&other)
+    {
+        if (this != &other)
+        {
+            clear();
+            std::swap(root, other.root);
+            std::swap(head, other.head);
+            std::swap(tail, other.tail);
+            std::swap(sz, other.sz);
+            std::swap(levels, other.levels);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Destructor - Libera toda la memoria
+     * @complexity O(n / B)
+     */
+    ~BPlusTree()
+    {
+        clear();
+    }
+
+    // ==================== OPERACIONES PRINCIPALES ====================
+
+    /**
+     * @brief Inserta un nuevo par Key-Value en el árbol
+     * @param k Clave a insertar
+     * @param v Valor asociado
+     * @complexity O(log n) garantizado, O(log_B n) nodos visitados
+     *
+     * Si la clave ya existe, actualiza su valor.
+     */
+    void insert(const Key &k, const Value &v)
+    {
+        if (root == nullptr)
+        {
+            Leaf *leaf = new Leaf();
+            leaf->keys[0] = k;
+            leaf->values[0] = v;
+            leaf->count = 1;
+            root = head = tail = leaf;
+            sz = 1;
+            levels = 0;
+            return;
+        }
+
+        Key sep;
+        Node *sibling = insertHelper(root, k, v, sep);
+        if (sibling != nullptr)
+        {
+            // La raíz se dividió: el árbol crece un nivel
+            Inner *newRoot = new Inner();
+            newRoot->keys[0] = std::move(sep);
+            newRoot->children[0] = root;
+            newRoot->children[1] = sibling;
+            newRoot->count = 1;
+            root = newRoot;
+            levels++;
+        }
+    }
+
+    /**
+     * @brief Busca una clave en el árbol
+     * @param k Clave a buscar
+     * @return true si la clave existe, false en caso contrario
+     * @complexity O(log n) garantizado
+     */
+    bool find(const Key &k) const
+    {
+        return searchHelper(k) != nullptr;
+    }
+
+    /**
+     * @brief Obtiene el valor asociado a una clave
+     * @param k Clave a buscar
+     * @return Puntero al valor, nullptr si no existe
+     * @complexity O(log n) garantizado
+     */
+    Value *getValue(const Key &k)
+    {
+        return searchHelper(k);
+    }
+
+    /**
+     * @brief Obtiene el valor asociado a una clave (versión const)
+     * @param k Clave a buscar
+     * @return Puntero constante al valor, nullptr si no existe
+     * @complexity O(log n) garantizado
+     */
+    const Value *getValue(const Key &k) const
+    {
+        return searchHelper(k);
+    }
+
+    /**
+     * @brief Elimina una clave del árbol
+     * @param k Clave a eliminar
+     * @return true si se eliminó correctamente, false si no existía
+     * @complexity O(log n) garantizado
+     *
+     * Una hoja o nodo interno que queda por debajo de la mitad pide prestado
+     * a un hermano o se une con él; si la raíz queda con un solo hijo, el
+     * árbol baja un nivel.
+     */
+    bool remove(const Key &k)
+    {
+        if (root == nullptr || !removeHelper(root, k))
+            return false;
+        sz--;
+
+        if (root->leaf && root->count == 0)
+        {
+            deleteNode(root);
+            root = head = tail = nullptr;
+            levels = -1;
+        }
+        else if (!root->leaf && root->count == 0)
+        {
+            Inner *old = static_cast<Inner *>(root);
+            root = old->children[0];
+            delete old;
+            levels--;
+        }
+        return true;
+    }
+
+    // ==================== RECORRIDOS ====================
+
+    /**
+     * @brief Recorrido inorden: imprime los pares ordenados por clave ascendente
+     * @complexity O(n), siguiendo los enlaces entre hojas
+     */
+    void inorder() const
+    {
+        for (const Leaf *leaf = head; leaf != nullptr; leaf = leaf->next)
+            for (unsigned int i = 0; i < leaf->count; i++)
+                std::cout << leaf->keys[i] << ": " << leaf->values[i] << std::endl;
+    }
+
+    /**
+     * @brief Visita en orden los elementos con clave en [lo, hi]
+     * @param lo Clave mínima del rango (incluida)
+     * @param hi Clave máxima del rango (incluida)
+     * @param fn Función llamada como fn(clave, valor); el valor se puede modificar
+     * @complexity O(log n + k), leyendo hojas completas una tras otra
+     *
+     * fn no debe insertar ni eliminar elementos del árbol.
+     */
+    template <typename Fn>
+    void forEachInRange(const Key &lo, const Key &hi, Fn fn)
+    {
+        if (root == nullptr)
+            return;
+        Leaf *leaf = findLeaf(lo);
+        unsigned int i = lowerBoundIndex(leaf->keys, leaf->count, lo);
+        for (; leaf != nullptr; leaf = leaf->next, i = 0)
+        {
+            for (; i < leaf->count; i++)
+            {
+                if (hi < leaf->keys[i])
+                    return;
+                fn(static_cast<const Key &>(leaf->keys[i]), leaf->values[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Visita en orden los elementos con clave en [lo, hi] (versión const)
+     * @param lo Clave mínima del rango (incluida)
+     * @param hi Clave máxima del rango (incluida)
+     * @param fn Función llamada como fn(clave, valor)
+     * @complexity O(log n + k)
+     */
+    template <typename Fn>
+    void forEachInRange(const Key &lo, const Key &hi, Fn fn) const
+    {
+        if (root == nullptr)
+            return;
+        const Leaf *leaf = findLeaf(lo);
+        unsigned int i = lowerBoundIndex(leaf->keys, leaf->count, lo);
+        for (; leaf != nullptr; leaf = leaf->next, i = 0)
+        {
+            for (; i < leaf->count; i++)
+            {
+                if (hi < leaf->keys[i])
+                    return;
+                fn(leaf->keys[i], leaf->values[i]);
+            }
+        }
+    }
+
+    // ==================== OPERACIONES DE CONSULTA ====================
+
+    /**
+     * @brief Encuentra la clave mínima del árbol
+     * @return Clave mínima
+     * @throw std::runtime_error si el árbol está vacío
+     * @complexity O(1)
+     */
+    const Key &findMin() const
+    {
+        if (root == nullptr)
+            throw std::runtime_error("El árbol está vacío");
+        return head->keys[0];
+    }
+
+    /**
+     * @brief Encuentra la clave máxima del árbol
+     * @return Clave máxima
+     * @throw std::runtime_error si el árbol está vacío
+     * @complexity O(1)
+     */
+    const Key &findMax() const
+    {
+        if (root == nullptr)
+            throw std::runtime_error("El árbol está vacío");
+        return tail->keys[tail->count - 1];
+    }
+
+    /**
+     * @brief Igual que findMax, con el nombre que usa BST
+     */
+    const Key &findMaximum() const
+    {
+        return findMax();
+    }
+
+    /**
+     * @brief Encuentra el sucesor de una clave (la menor clave mayor que k)
+     * @param k Clave de referencia (no tiene que estar en el árbol)
+     * @return Clave del sucesor
+     * @throw std::runtime_error si no existe sucesor
+     * @complexity O(log n) garantizado
+     */
+    const Key &findSuccessor(const Key &k) const
+    {
+        if (root != nullptr)
+        {
+            const Leaf *leaf = findLeaf(k);
+            unsigned int i = upperBoundIndex(leaf->keys, leaf->count, k);
+            if (i < leaf->count)
+                return leaf->keys[i];
+            if (leaf->next != nullptr)
+                return leaf->next->keys[0];
+        }
+        throw std::runtime_error("No existe sucesor para la clave dada");
+    }
+
+    /**
+     * @brief Encuentra el predecesor de una clave (la mayor clave menor que k)
+     * @param k Clave de referencia (no tiene que estar en el árbol)
+     * @return Clave del predecesor
+     * @throw std::runtime_error si no existe predecesor
+     * @complexity O(log n) garantizado
+     */
+    const Key &findPredecessor(const Key &k) const
+    {
+        if (root != nullptr)
+        {
+            const Leaf *leaf = findLeaf(k);
+            unsigned int i = lowerBoundIndex(leaf->keys, leaf->count, k);
+            if (i > 0)
+                return leaf->keys[i - 1];
+            if (leaf->prev != nullptr)
+                return leaf->prev->keys[leaf->prev->count - 1];
+        }
+        throw std::runtime_error("No existe predecesor para la clave dada");
+    }
+
+    /**
+     * @brief Calcula la altura del árbol
+     * @return Niveles de nodos internos sobre las hojas (0 si la raíz es una hoja, -1 si está vacío)
+     * @complexity O(1)
+     */
+    int height() const { return levels; }
+
+    /**
+     * @brief Obtiene el número total de pares
+     * @complexity O(1)
+     */
+    unsigned int size() const { return sz; }
+
+    /**
+     * @brief Verifica si el árbol está vacío
+     * @complexity O(1)
+     */
+    bool empty() const { return root == nullptr; }
+
+    /**
+     * @brief Elimina todos los elementos del árbol
+     * @complexity O(n / B)
+     */
+    void clear()
+    {
+        clearHelper(root);
+        root = head = tail = nullptr;
+        sz = 0;
+        levels = -1;
+    }
+
+    // ==================== OPERACIONES DE VERIFICACIÓN ====================
+
+    /**
+     * @brief Verifica las propiedades del árbol B+
+     * @return true si es válido, false en caso contrario
+     * @complexity O(n)
+     *
+     * Verifica:
+     * 1. Claves ordenadas dentro de cada nodo y dentro de los separadores del padre
+     * 2. Todo nodo que no es raíz está al menos medio lleno
+     * 3. Todas las hojas están a la misma profundidad
+     * 4. La cadena de hojas recorre todas las claves en orden y suma size()
+     */
+    bool verifyProperties() const
+    {
+        if (root == nullptr)
+            return head == nullptr && tail == nullptr && sz == 0 && levels == -1;
+
+        unsigned int nodes = 0;
+        if (!verifyHelper(root, nullptr, nullptr, 0, nodes))
+            return false;
+
+        unsigned int count = 0;
+        const Leaf *prevLeaf = nullptr;
+        for (const Leaf *leaf = head; leaf != nullptr; leaf = leaf->next)
+        {
+            if (leaf->prev != prevLeaf || leaf->count == 0)
+                return false;
+            if (prevLeaf != nullptr && !(prevLeaf->keys[prevLeaf->count - 1] < leaf->keys[0]))
+                return false;
+            count += leaf->count;
+            prevLeaf = leaf;
+        }
+        return prevLeaf == tail && count == sz;
+    }
+
+    /**
+     * @brief Imprime el árbol, un nodo por línea con sus claves
+     * @complexity O(n)
+     */
+    void printTree() const
+    {
+        if (root != nullptr)
+            printTreeHelper(root, "");
+    }
+
+    /**
+     * @brief Imprime estadísticas del árbol
+     * @complexity O(n / B)
+     *
+     * Muestra: tamaño, altura, capacidades, número de hojas y ocupación media.
+     */
+    void printStats() const
+    {
+        unsigned int leaves = 0;
+        for (const Leaf *leaf = head; leaf != nullptr; leaf = leaf->next)
+            leaves++;
+        std::cout << "Tamaño: " << size() << std::endl;
+        std::cout << "Altura: " << height() << std::endl;
+        std::cout << "Pares por hoja: " << LEAF_CAPACITY << " (" << sizeof(Leaf) << " bytes)" << std::endl;
+        std::cout << "Hijos por nodo interno: " << INNER_CAPACITY + 1 << " (" << sizeof(Inner) << " bytes)" << std::endl;
+        std::cout << "Hojas: " << leaves << std::endl;
+        if (leaves > 0)
+            std::cout << "Ocupación media de las hojas: " << 100.0 * size() / (leaves * LEAF_CAPACITY) << "%" << std::endl;
+        std::cout << "Válido: " << (verifyProperties() ? "sí" : "no") << std::endl;
+    }
+};
+
+#endif // __BPLUS_TREE__
@@ -0,0 +1,197 @@
+/**
+ * @file BPlusTreeTest.cpp
+ * @brief Pruebas para la clase BPlusTree
+ * @date 2025
+ */
+
+#include "BPlusTree.hh"
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+void printHeader(const string &title)
+{
+    cout << "\n" << string(70, '=') << endl;
+    cout << "  " << title << endl;
+    cout << string(70, '=') << endl;
+}
+
+void printTest(const string &test, bool passed)
+{
+    cout << "[" << (passed ? "✓ PASS" : "✗ FAIL") << "] " << test << endl;
+}
+
+/**
+ * @brief Operaciones aleatorias contra std::map, verificando el árbol cada cierto tiempo
+ * @return true si el contenido y las propiedades coinciden siempre
+ */
+template <typename Tree>
+bool randomAgainstMap(Tree &tree, unsigned int ops, int keyRange, unsigned int seed)
+{
+    map<int, int> reference;
+    mt19937 rng(seed);
+    for (unsigned int i = 0; i < ops; i++)
+    {
+        int k = static_cast<int>(rng() % keyRange);
+        if (rng() % 3 == 0)
+        {
+            if (tree.remove(k) != (reference.erase(k) == 1))
+                return false;
+        }
+        else
+        {
+            tree.insert(k, static_cast<int>(i));
+            reference[k] = static_cast<int>(i);
+        }
+        if (i % 1000 == 0 && !tree.verifyProperties())
+            return false;
+    }
+    if (tree.size() != reference.size() || !tree.verifyProperties())
+        return false;
+    for (const auto &kv : reference)
+    {
+        const int *v = tree.getValue(kv.first);
+        if (v == nullptr || *v != kv.second)
+            return false;
+    }
+    return true;
+}
+
+int main()
+{
+    cout << "\n╔══════════════════════════════════════════════════════════════════╗\n";
+    cout << "║                   PRUEBAS DEL ÁRBOL B+                           ║\n";
+    cout << "╚══════════════════════════════════════════════════════════════════╝\n";
+
+    // ==================== PRUEBA 1: Constructor y métodos básicos ====================
+    printHeader("PRUEBA 1: Constructor, empty(), size()");
+
+    BPlusTree<int, string> arbol;
+    printTest("Árbol creado vacío", arbol.empty() && arbol.size() == 0 && arbol.height() == -1);
+    try
+    {
+        arbol.findMin();
+        printTest("findMin() en árbol vacío lanza excepción", false);
+    }
+    catch (runtime_error &e)
+    {
+        printTest("findMin() en árbol vacío lanza excepción", true);
+    }
+
+    // ==================== PRUEBA 2: Insert, find y actualización ====================
+    printHeader("PRUEBA 2: Insert, find y actualización");
+
+    arbol.insert(50, "cincuenta");
+    arbol.insert(30, "treinta");
+    arbol.insert(70, "setenta");
+    arbol.insert(30, "TREINTA");
+    printTest("size() == 3 tras actualizar una clave", arbol.size() == 3);
+    printTest("find(30) y find(70)", arbol.find(30) && arbol.find(70));
+    printTest("find(40) == false", !arbol.find(40));
+    printTest("getValue(30) devuelve el valor actualizado", *arbol.getValue(30) == "TREINTA");
+    printTest("findMin() == 30 y findMax() == 70", arbol.findMin() == 30 && arbol.findMax() == 70);
+    printTest("findMaximum() (nombre de BST) == 70", arbol.findMaximum() == 70);
+
+    // ==================== PRUEBA 3: Sucesor y predecesor ====================
+    printHeader("PRUEBA 3: findSuccessor y findPredecessor entre hojas");
+
+    BPlusTree<int, int, 64> pequeno; // Nodos de 4 claves: muchas hojas y niveles
+    for (int i = 0; i < 1000; i += 2)
+        pequeno.insert(i, i);
+    bool sucesoresOk = true;
+    for (int i = 0; i < 998; i++)
+    {
+        int esperado = (i % 2 == 0) ? i + 2 : i + 1;
+        if (pequeno.findSuccessor(i) != esperado)
+            sucesoresOk = false;
+        int anterior = (i % 2 == 0) ? i - 2 : i - 1;
+        if (i > 0 && pequeno.findPredecessor(i) != anterior)
+            sucesoresOk = false;
+    }
+    printTest("Sucesor y predecesor de claves presentes y ausentes", sucesoresOk);
+    printTest("Altura > 2 con nodos de 4 claves", pequeno.height() > 2 && pequeno.verifyProperties());
+    try
+    {
+        pequeno.findSuccessor(998);
+        printTest("findSuccessor del máximo lanza excepción", false);
+    }
+    catch (runtime_error &e)
+    {
+        printTest("findSuccessor del máximo lanza excepción", true);
+    }
+    try
+    {
+        pequeno.findPredecessor(0);
+        printTest("findPredecessor del mínimo lanza excepción", false);
+    }
+    catch (runtime_error &e)
+    {
+        printTest("findPredecessor del mínimo lanza excepción", true);
+    }
+
+    // ==================== PRUEBA 4: Aleatorio con varios tamaños de nodo ====================
+    printHeader("PRUEBA 4: 100000 operaciones aleatorias contra std::map");
+
+    BPlusTree<int, int, 64> nodos64;
+    BPlusTree<int, int, 256> nodos256;
+    BPlusTree<int, int, 4096> nodos4096;
+    printTest("Nodos de 64 bytes", randomAgainstMap(nodos64, 100000, 3000, 1));
+    printTest("Nodos de 256 bytes", randomAgainstMap(nodos256, 100000, 3000, 2));
+    printTest("Nodos de 4 KB", randomAgainstMap(nodos4096, 100000, 20000, 3));
+
+    // ==================== PRUEBA 5: Rangos ====================
+    printHeader("PRUEBA 5: forEachInRange sobre hojas enlazadas");
+
+    long long suma = 0;
+    int visitados = 0;
+    pequeno.forEachInRange(101, 199, [&](const int &k, int &v) {
+        suma += k;
+        v = -v; // Modificar en el lugar
+        visitados++;
+    });
+    printTest("Rango [101, 199] visita 49 claves pares", visitados == 49 && suma == 49 * 150);
+    printTest("Los valores se modificaron en el lugar", *pequeno.getValue(150) == -150);
+    visitados = 0;
+    const BPlusTree<int, int, 64> &constante = pequeno;
+    constante.forEachInRange(2000, 3000, [&](const int &, const int &) { visitados++; });
+    printTest("Rango fuera de las claves no visita nada", visitados == 0);
+
+    // ==================== PRUEBA 6: Copia, movimiento y vaciado ====================
+    printHeader("PRUEBA 6: Copia, movimiento y eliminar todo");
+
+    BPlusTree<int, int, 64> copia(pequeno);
+    copia.remove(500);
+    printTest("La copia es independiente", pequeno.find(500) && !copia.find(500) && copia.verifyProperties());
+    BPlusTree<int, int, 64> movido(std::move(copia));
+    printTest("Movimiento deja el origen vacío", copia.empty() && movido.size() == 499 && movido.verifyProperties());
+    copia = movido;
+    printTest("Asignación por copia", copia.size() == 499 && copia.verifyProperties());
+
+    for (int i = 0; i < 1000; i += 4)
+        pequeno.remove(i);
+    for (int i = 998; i >= 0; i -= 4)
+        pequeno.remove(i);
+    printTest("Eliminar todas las claves deja el árbol vacío", pequeno.empty() && pequeno.verifyProperties());
+
+    // ==================== PRUEBA 7: Claves string ====================
+    printHeader("PRUEBA 7: Claves string y 200000 claves ordenadas");
+
+    BPlusTree<string, int, 512> nombres;
+    vector<string> palabras = {"pera", "manzana", "uva", "kiwi", "banano", "mango", "fresa"};
+    for (unsigned int i = 0; i < palabras.size(); i++)
+        nombres.insert(palabras[i], static_cast<int>(i));
+    printTest("findMin() == banano, findMax() == uva", nombres.findMin() == "banano" && nombres.findMax() == "uva");
+    printTest("findSuccessor(\"manzana\") == pera", nombres.findSuccessor("manzana") == "pera");
+
+    BPlusTree<int, int> ordenado;
+    for (int i = 0; i < 200000; i++)
+        ordenado.insert(i, i);
+    printTest("200000 claves ordenadas, propiedades válidas", ordenado.size() == 200000 && ordenado.verifyProperties());
+    ordenado.printStats();
+
+    return 0;
+}
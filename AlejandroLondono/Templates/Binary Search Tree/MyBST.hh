@@ -5,20 +5,122 @@
 #include <stdexcept>
 #include <string>
 #include <queue>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
 
 using namespace std;
+
+/*1. Operaciones iterativas
+
+Qué es: insert, find, remove, height, copia y los recorridos usan bucles
+(con una pila o cola explícita en el heap cuando hace falta), nunca recursión
+Por qué: Sin balanceo, claves ordenadas convierten el árbol en una lista de
+altura n. Con recursión, buscar, copiar o destruir un árbol así de 1M nodos
+desborda la pila de llamadas.
+
+2. Inorden de Morris
+
+Qué es: inorder enlaza temporalmente el predecesor de cada nodo con él para
+poder volver sin pila, y quita el enlace al pasar de nuevo
+Por qué: Recorre en orden con memoria O(1), sin importar la altura.
+
+3. clear por rotaciones
+
+Qué es: clear rota a la derecha hasta que el nodo actual no tiene hijo
+izquierdo, lo borra y sigue por la derecha
+Por qué: Libera el árbol en O(n) sin pila ni memoria extra, así que el
+destructor nunca desborda la pila.
+
+4. Políticas de balanceo (Balance)
+
+Qué es: El tercer parámetro elige cómo se reorganiza el árbol
+    NoBalancing  sin balanceo (por defecto, el comportamiento original)
+    Splay        cada insert / find / remove sube la clave a la raíz
+    Treap        prioridad aleatoria por nodo, O(log n) esperado
+    Scapegoat    reconstruye el subárbol de un ancestro desbalanceado
+Por qué: Las claves que llegan ordenadas (por tiempo, por id) vuelven el
+árbol sin balanceo una lista con búsquedas O(n). Splay deja cerca de la raíz
+las claves más consultadas, Treap se divide y une en O(log n), y Scapegoat no
+guarda nada extra en los nodos.
+Ejemplo: BST<int, string, Treap> t; t.insert(5, "a");
+
+5. get / getOrInsert / upsert
+
+Qué es: Las cuatro políticas implementan una sola operación "buscar o
+insertar" que devuelve el nodo; insert, getOrInsert y upsert solo deciden
+qué hacer con su valor, y get devuelve un puntero al valor encontrado
+Por qué: Leer con find y luego actualizar con insert recorre el camino dos
+veces (y con Splay reorganiza dos veces). find y get también aceptan tipos
+comparables con Key, así buscar "abc" en un BST<string, ...> no crea un
+string temporal.*/
+
+/**
+ * @brief Sin balanceo: la forma del árbol depende del orden de inserción
+ */
+struct NoBalancing
+{
+    struct NodeData
+    {
+    };
+};
+
+/**
+ * @brief Árbol splay: insert, find y remove suben la clave accedida a la raíz (splay top-down)
+ *
+ * O(log n) amortizado. find reorganiza el árbol, así que no se puede llamar
+ * desde varios hilos a la vez aunque sea const.
+ */
+struct Splay
+{
+    struct NodeData
+    {
+    };
+};
+
+/**
+ * @brief Treap: cada nodo tiene una prioridad aleatoria y el árbol es un max-heap por prioridad
+ *
+ * Altura O(log n) esperada sin importar el orden de las claves.
+ */
+struct Treap
+{
+    struct NodeData
+    {
+        unsigned int priority; ///< Prioridad aleatoria (el padre siempre tiene mayor o igual)
+    };
+};
+
+/**
+ * @brief Árbol scapegoat: la altura nunca pasa de log_{1/ALPHA}(n)
+ *
+ * Cuando un nodo nuevo queda más hondo, se reconstruye perfectamente
+ * balanceado el primer ancestro con un hijo de más de ALPHA de su tamaño.
+ * O(log n) amortizado y ningún dato extra por nodo.
+ */
+struct Scapegoat
+{
+    struct NodeData
+    {
+    };
+
+    static constexpr double ALPHA = 0.7; ///< Desbalance tolerado (entre 0.5 y 1)
+};
+
 /**
  * @class BST
  * @brief Árbol Binario de Búsqueda con pares Key-Value
  * @tparam Key Tipo de dato para la clave (debe ser comparable)
  * @tparam Value Tipo de dato para el valor
+ * @tparam Balance Política de balanceo: NoBalancing (por defecto), Splay, Treap o Scapegoat
  *
  * Implementa todas las operaciones estándar de un BST donde:
  * - La Key es única y determina la posición en el árbol
  * - El Value puede repetirse y se asocia a cada Key
  * - Las operaciones de búsqueda y ordenamiento se basan en la Key
  */
-template <typename Key, typename Value>
+template <typename Key, typename Value, typename Balance = NoBalancing>
 class BST
 {
 private:
@@ -27,9 +129,10 @@ private:
      * @brief Representa un nodo del árbol con par Key-Value
      *
      * Encapsula la información de cada nodo: clave única, valor asociado,
-     * y punteros a los hijos izquierdo y derecho.
+     * y punteros a los hijos izquierdo y derecho. Hereda los datos que pide
+     * la política de balanceo (vacíos salvo en Treap, sin costo de memoria).
      */
-    class Node
+    class Node : public Balance::NodeData
     {
     private:
         Key key;     ///< Clave única del nodo (usada para ordenar)
@@ -43,7 +146,14 @@ private:
          * @param k Clave del nodo
          * @param v Valor asociado a la clave
          */
-        Node(const Key &k, const Value &v) : key(k), value(v), left(nullptr), right(nullptr) {}
+        Node(const Key &k, const Value &v) : Balance::NodeData(), key(k), value(v), left(nullptr), right(nullptr) {}
+
+        /**
+         * @brief Copia clave, valor y datos de balanceo de otro nodo, sin hijos
+         * @param other Nodo a copiar
+         */
+        explicit Node(const Node *other)
+            : Balance::NodeData(*other), key(other->key), value(other->value), left(nullptr), right(nullptr) {}
 
         /**
          * @brief Obtiene la clave del nodo
@@ -57,6 +167,12 @@ private:
          */
         const Value &getValue() const { return value; }
 
+        /**
+         * @brief Obtiene el valor del nodo para modificarlo en el lugar
+         * @return Referencia al valor
+         */
+        Value &getValue() { return value; }
+
         /**
          * @brief Obtiene el puntero al hijo izquierdo
          * @return Puntero al nodo izquierdo
@@ -100,140 +216,154 @@ private:
         bool hasRight() const { return right != nullptr; }
     };
 
-    Node *root;      ///< Raíz del árbol
-    unsigned int sz; ///< Número de nodos en el árbol
+    mutable Node *root;         ///< Raíz del árbol (Splay la cambia también al buscar)
+    unsigned int sz;            ///< Número de nodos en el árbol
+    unsigned int maxSize;       ///< Mayor tamaño desde la última reconstrucción total (solo Scapegoat)
+    unsigned int priorityState; ///< Estado del generador de prioridades (solo Treap)
+
+    /// Válido solo si K se compara con Key en ambos sentidos (habilita la búsqueda heterogénea)
+    template <typename K>
+    using EnableIfComparable = decltype(void(declval<const K &>() < declval<const Key &>()),
+                                        void(declval<const Key &>() < declval<const K &>()));
 
     // ==================== MÉTODOS AUXILIARES PRIVADOS ====================
 
     /**
-     * @brief Inserta un nodo recursivamente
-     * @param node Nodo actual en la recursión
-     * @param k Clave a insertar
-     * @param v Valor asociado a la clave
-     * @return Puntero al nodo actualizado
+     * @brief Busca una clave bajando iterativamente desde un nodo y la inserta si no está
+     * @param node Nodo desde donde se empieza a bajar (no nulo)
+     * @param k Clave a buscar o insertar
+     * @param factory Crea el valor del nodo nuevo (solo se llama si k no existe)
+     * @param inserted Recibe true si se creó un nodo
+     * @return Nodo con clave k
      */
-    void insertHelper(Node *node, const Key &k, const Value &v)
+    template <typename Factory>
+    Node *insertHelper(Node *node, const Key &k, Factory &factory, bool &inserted)
     {
-        // Si la clave a insertar es menor que la del nodo actual,
-        // intentamos insertarla en el subárbol izquierdo.
-        if (k < node->getKey())
+        while (true)
         {
-            // Si el nodo izquierdo existe, seguimos descendiendo por la izquierda.
-            if (node->hasLeft())
+            // Si la clave a insertar es menor que la del nodo actual,
+            // seguimos por el subárbol izquierdo.
+            if (k < node->getKey())
             {
-                insertHelper(node->getLeft(), k, v);
-            }
-            // Si el nodo izquierdo NO existe, creamos uno nuevo en esa posición.
-            else
-            {
-                Node *newNode = new Node(k, v);
-                node->setLeft(newNode);
-                sz++; // Aumentamos el contador de nodos (solo si se crea uno nuevo).
+                // Si el nodo izquierdo NO existe, creamos uno nuevo en esa posición.
+                if (!node->hasLeft())
+                {
+                    node->setLeft(new Node(k, factory()));
+                    sz++; // Aumentamos el contador de nodos (solo si se crea uno nuevo).
+                    inserted = true;
+                    return node->getLeft();
+                }
+                node = node->getLeft();
             }
-        }
-        // Si la clave a insertar es mayor que la del nodo actual,
-        // intentamos insertarla en el subárbol derecho.
-        else if (k > node->getKey())
-        {
-            // Si el nodo derecho existe, seguimos descendiendo por la derecha.
-            if (node->hasRight())
+            // Si es mayor, seguimos por el subárbol derecho.
+            else if (k > node->getKey())
             {
-                insertHelper(node->getRight(), k, v);
+                if (!node->hasRight())
+                {
+                    node->setRight(new Node(k, factory()));
+                    sz++;
+                    inserted = true;
+                    return node->getRight();
+                }
+                node = node->getRight();
             }
-            // Si el nodo derecho NO existe, creamos uno nuevo en esa posición.
+            // Si la clave YA existe en el árbol, se devuelve su nodo (insert actualiza el valor).
             else
             {
-                Node *newNode = new Node(k, v);
-                node->setRight(newNode);
-                sz++; // Aumentamos el contador de nodos.
+                inserted = false;
+                return node;
             }
         }
-        // Si la clave YA existe en el árbol (igual a la del nodo actual),
-        // simplemente actualizamos el valor asociado.
-        else
-        {
-            node->setValue(v);
-        }
     }
 
     /**
-     * @brief Busca un nodo por su clave recursivamente
-     * @param node Nodo actual en la recursión
-     * @param k Clave a buscar
-     * @return Puntero al nodo encontrado o nullptr
+     * @brief Busca un nodo por su clave iterativamente
+     * @param node Raíz del subárbol donde buscar
+     * @param k Clave a buscar (Key o un tipo comparable con Key)
+     * @return Nodo con la clave, nullptr si no existe en el subárbol
      */
-    bool findHelper(Node *node, const Key &k) const
+    template <typename K>
+    Node *findHelper(Node *node, const K &k) const
     {
-        if (node == nullptr)
-        {
-            return false;
-        }
-        if (k == node->getKey())
-        {
-            return true;
-        }
-        else if (k < node->getKey())
+        while (node != nullptr)
         {
-            return findHelper(node->getLeft(), k);
-        }
-        else
-        {
-            return findHelper(node->getRight(), k);
+            if (k < node->getKey())
+                node = node->getLeft();
+            else if (node->getKey() < k)
+                node = node->getRight();
+            else
+                return node;
         }
+        return nullptr;
     }
 
     /**
-     * @brief Elimina un nodo recursivamente
-     * @param node Nodo actual en la recursión
+     * @brief Elimina un nodo iterativamente
+     * @param node Raíz del subárbol
      * @param k Clave a eliminar
-     * @return Puntero al nodo actualizado
+     * @return Nueva raíz del subárbol
+     *
+     * En el caso de dos hijos, el sucesor inorden se desengancha y ocupa el
+     * lugar del nodo eliminado (no se crea ni se copia ningún nodo).
      */
     Node *removeHelper(Node *node, const Key &k)
     {
-        if (k < node->getKey())
+        Node *parent = nullptr;
+        Node *current = node;
+        while (current != nullptr && !(k == current->getKey()))
+        {
+            parent = current;
+            current = (k < current->getKey()) ? current->getLeft() : current->getRight();
+        }
+        if (current == nullptr)
         {
-            node->setLeft(removeHelper(node->getLeft(), k));
+            return node;
         }
-        else if (node->getKey() < k)
+
+        Node *replacement;
+        if (!current->hasLeft())
+        {
+            // Caso 1 y 2: sin hijos o solo hijo derecho
+            replacement = current->getRight();
+        }
+        else if (!current->hasRight())
         {
-            node->setRight(removeHelper(node->getRight(), k)); // una vez se encuentre el nodo == k entonces el nodo con el que trabajaremos sera ese, y el nodo anterior sera el padre (node->setRight(nodo hijo))
+            // Caso 2: solo hijo izquierdo
+            replacement = current->getLeft();
         }
         else
         {
-            // Nodo encontrado, empezamos con verificar si es nodo hoja, un solo hijo o dos hijos y realizamos la eliminacion y reasignacion
-            if (!node->hasLeft() && !node->hasRight())
-            {
-                // Caso 2: solo hijo izquierdo
-                delete node;
-                return nullptr;
-            }
-
-            else if (!node->hasLeft())
+            // Caso 3: dos hijos. El sucesor inorden es el mínimo del subárbol derecho
+            Node *successorParent = current;
+            Node *successor = current->getRight();
+            while (successor->hasLeft())
             {
-                // Caso 2: solo hijo derecho
-                Node *temp = node->getRight();
-                delete node;
-                return temp;
+                successorParent = successor;
+                successor = successor->getLeft();
             }
-            else if (!node->hasRight())
+            if (successorParent != current)
             {
-                // Caso 2: solo hijo izquierdo
-                Node *temp = node->getLeft();
-                delete node;
-                return temp;
+                // Desenganchar el sucesor (no tiene hijo izquierdo) y darle el subárbol derecho del nodo
+                successorParent->setLeft(successor->getRight());
+                successor->setRight(current->getRight());
             }
+            successor->setLeft(current->getLeft());
+            replacement = successor;
+        }
 
-            else
-            {
-                // Caso 3: dos hijos
-                Node *successor = findMinHelper(node->getRight());                   // el sucesor inorden es el minimo del subarbol derecho
-                Node *newNode = new Node(successor->getKey(), successor->getValue());
-                newNode->setLeft(node->getLeft());
-                newNode->setRight(removeHelper(node->getRight(), successor->getKey())); // eliminamos el sucesor inorden del subarbol derecho
-                delete node;
-                return newNode;
-            }
+        if (parent == nullptr)
+        {
+            node = replacement;
         }
+        else if (parent->getLeft() == current)
+        {
+            parent->setLeft(replacement);
+        }
+        else
+        {
+            parent->setRight(replacement);
+        }
+        delete current;
         return node;
     }
 
@@ -271,72 +401,127 @@ private:
     }
 
     /**
-     * @brief Recorrido inorden recursivo (Izquierda-Raíz-Derecha)
-     * @param node Nodo actual en la recursión
+     * @brief Recorrido inorden de Morris (Izquierda-Raíz-Derecha) en espacio O(1)
+     * @param node Raíz del subárbol
+     * @param visit Función llamada como visit(nodo) en orden ascendente de clave
      *
-     * Visita el subárbol izquierdo, luego el nodo actual, luego el subárbol derecho.
-     * Este recorrido produce los elementos en orden ascendente por clave.
+     * Antes de bajar a la izquierda, el predecesor inorden del nodo apunta
+     * temporalmente a él con su hijo derecho (un "hilo"), que sirve para volver
+     * sin pila. Al volver se quita el hilo, así que el árbol queda como estaba.
+     * visit no debe lanzar excepciones ni modificar el árbol.
      *
-     * @complexity O(n) donde n es el número de nodos en el subárbol
+     * @complexity O(n) tiempo, O(1) espacio
      */
-    void inorderHelper(Node *node) const
+    template <typename Visit>
+    void inorderHelper(Node *node, Visit visit) const
     {
-        if (node == nullptr)
+        Node *current = node;
+        while (current != nullptr)
         {
-            return;
-        }
+            if (!current->hasLeft())
+            {
+                visit(current);
+                current = current->getRight();
+                continue;
+            }
 
-        inorderHelper(node->getLeft());                             // 1. Visitar izquierda
-        cout << node->getKey() << ": " << node->getValue() << endl; // 2. Procesar raíz
-        inorderHelper(node->getRight());                            // 3. Visitar derecha
+            // Buscar el predecesor inorden (máximo del subárbol izquierdo)
+            Node *predecessor = current->getLeft();
+            while (predecessor->hasRight() && predecessor->getRight() != current)
+            {
+                predecessor = predecessor->getRight();
+            }
+
+            if (!predecessor->hasRight())
+            {
+                predecessor->setRight(current); // 1. Crear el hilo y bajar a la izquierda
+                current = current->getLeft();
+            }
+            else
+            {
+                predecessor->setRight(nullptr); // 2. Izquierda terminada: quitar el hilo
+                visit(current);                 // 3. Procesar raíz
+                current = current->getRight();  // 4. Visitar derecha
+            }
+        }
     }
 
     /**
-     * @brief Recorrido preorden recursivo (Raíz-Izquierda-Derecha)
-     * @param node Nodo actual en la recursión
+     * @brief Recorrido preorden iterativo (Raíz-Izquierda-Derecha)
+     * @param node Raíz del subárbol
+     * @param visit Función llamada como visit(nodo)
      *
-     * Visita primero el nodo actual, luego el subárbol izquierdo, luego el derecho.
-     * Útil para copiar el árbol o crear una representación serializada.
+     * Usa una pila explícita en el heap en vez de la pila de llamadas.
      *
-     * @complexity O(n) donde n es el número de nodos en el subárbol
+     * @complexity O(n) tiempo, O(altura) memoria
      */
-    void preorderHelper(Node *node) const
+    template <typename Visit>
+    void preorderHelper(Node *node, Visit visit) const
     {
         if (node == nullptr)
         {
             return;
         }
 
-        cout << node->getKey() << ": " << node->getValue() << endl; // 1. Procesar raíz ✅
-        preorderHelper(node->getLeft());                            // 2. Visitar izquierda ✅
-        preorderHelper(node->getRight());                           // 3. Visitar derecha ✅
+        std::vector<Node *> stack;
+        stack.push_back(node);
+        while (!stack.empty())
+        {
+            Node *current = stack.back();
+            stack.pop_back();
+            visit(current); // 1. Procesar raíz
+            // La derecha entra primero para salir después de la izquierda
+            if (current->hasRight())
+                stack.push_back(current->getRight()); // 3. Visitar derecha
+            if (current->hasLeft())
+                stack.push_back(current->getLeft()); // 2. Visitar izquierda
+        }
     }
 
     /**
-     * @brief Recorrido postorden recursivo (Izquierda-Derecha-Raíz)
-     * @param node Nodo actual en la recursión
+     * @brief Recorrido postorden iterativo (Izquierda-Derecha-Raíz)
+     * @param node Raíz del subárbol
+     * @param visit Función llamada como visit(nodo)
      *
-     * Visita el subárbol izquierdo, luego el derecho, y finalmente el nodo actual.
-     * Útil para eliminar el árbol o evaluar expresiones postfijas.
+     * Un nodo se procesa cuando su derecha ya se visitó (o no existe);
+     * lastVisited indica si volvemos desde la derecha.
      *
-     * @complexity O(n) donde n es el número de nodos en el subárbol
+     * @complexity O(n) tiempo, O(altura) memoria
      */
-    void postorderHelper(Node *node) const
+    template <typename Visit>
+    void postorderHelper(Node *node, Visit visit) const
     {
-        if (node == nullptr)
+        std::vector<Node *> stack;
+        Node *current = node;
+        Node *lastVisited = nullptr;
+        while (current != nullptr || !stack.empty())
         {
-            return;
+            if (current != nullptr)
+            {
+                stack.push_back(current); // 1. Visitar izquierda
+                current = current->getLeft();
+                continue;
+            }
+            Node *top = stack.back();
+            if (top->hasRight() && top->getRight() != lastVisited)
+            {
+                current = top->getRight(); // 2. Visitar derecha
+            }
+            else
+            {
+                visit(top); // 3. Procesar raíz
+                lastVisited = top;
+                stack.pop_back();
+            }
         }
-
-        postorderHelper(node->getLeft());                           // 1. Visitar izquierda ✅
-        postorderHelper(node->getRight());                          // 2. Visitar derecha ✅
-        cout << node->getKey() << ": " << node->getValue() << endl; // 3. Procesar raíz ✅
     }
 
     /**
-     * @brief Calcula la altura del árbol recursivamente
-     * @param node Nodo actual en la recursión
+     * @brief Calcula la altura recorriendo el árbol por niveles
+     * @param node Raíz del subárbol
      * @return Altura del subárbol
+     *
+     * @complexity O(n) tiempo, O(ancho máximo) memoria en el heap
      */
     int heightHelper(Node *node) const
     {
@@ -344,30 +529,61 @@ private:
         {
             return -1; // Altura de árbol vacío es -1
         }
-        int leftHeight = heightHelper(node->getLeft());
-        int rightHeight = heightHelper(node->getRight());
-        return 1 + max(leftHeight, rightHeight);
+
+        int height = -1;
+        std::queue<Node *> level;
+        level.push(node);
+        while (!level.empty())
+        {
+            height++;
+            for (std::size_t remaining = level.size(); remaining > 0; remaining--)
+            {
+                Node *current = level.front();
+                level.pop();
+                if (current->hasLeft())
+                    level.push(current->getLeft());
+                if (current->hasRight())
+                    level.push(current->getRight());
+            }
+        }
+        return height;
     }
 
     /**
-     * @brief Elimina todos los nodos del árbol recursivamente
-     * @param node Nodo actual en la recursión
+     * @brief Elimina todos los nodos de un subárbol en espacio O(1)
+     * @param node Raíz del subárbol
+     *
+     * Mientras el nodo actual tenga hijo izquierdo, se rota a la derecha (el
+     * hijo sube); cuando no tiene, se borra y se sigue por su derecha. Cada
+     * rotación deja un nodo más en la "espina" derecha, así que el total es O(n).
      */
     void clearHelper(Node *node)
     {
-        if (node == nullptr)
+        while (node != nullptr)
         {
-            return;
+            if (node->hasLeft())
+            {
+                Node *left = node->getLeft();
+                node->setLeft(left->getRight());
+                left->setRight(node);
+                node = left;
+            }
+            else
+            {
+                Node *right = node->getRight();
+                delete node;
+                node = right;
+            }
         }
-        clearHelper(node->getLeft());
-        clearHelper(node->getRight());
-        delete node;
     }
 
     /**
-     * @brief Copia un árbol recursivamente
+     * @brief Copia un árbol iterativamente
      * @param node Nodo del árbol a copiar
      * @return Puntero al nuevo nodo copiado
+     *
+     * Los pares (original, copia) pendientes de copiar sus hijos van en una
+     * pila explícita en el heap.
      */
     Node *copyHelper(Node *node)
     {
@@ -375,33 +591,633 @@ private:
         {
             return nullptr;
         }
-        Node *newNode = new Node(node->getKey(), node->getValue());
-        newNode->setLeft(copyHelper(node->getLeft()));
-        newNode->setRight(copyHelper(node->getRight()));
-        return newNode;
+        Node *copy = new Node(node);
+        std::vector<std::pair<Node *, Node *>> pending;
+        pending.push_back(std::make_pair(node, copy));
+        while (!pending.empty())
+        {
+            Node *original = pending.back().first;
+            Node *target = pending.back().second;
+            pending.pop_back();
+            if (original->hasLeft())
+            {
+                Node *left = new Node(original->getLeft());
+                target->setLeft(left);
+                pending.push_back(std::make_pair(original->getLeft(), left));
+            }
+            if (original->hasRight())
+            {
+                Node *right = new Node(original->getRight());
+                target->setRight(right);
+                pending.push_back(std::make_pair(original->getRight(), right));
+            }
+        }
+        return copy;
     }
 
     /**
      * @brief Imprime el árbol de forma visual
-     * @param node Nodo actual
+     * @param node Raíz del árbol
      * @param prefix Prefijo para la indentación
      * @param isLeft Indica si es hijo izquierdo
+     *
+     * Usa una pila explícita con el prefijo de cada nodo pendiente.
      */
     void printTreeHelper(Node *node, const std::string &prefix, bool isLeft) const
     {
-        if (node != nullptr)
+        struct Pending
         {
-            std::cout << prefix;
+            Node *node;
+            std::string prefix;
+            bool isLeft;
+        };
+
+        std::vector<Pending> stack;
+        stack.push_back(Pending{node, prefix, isLeft});
+        while (!stack.empty())
+        {
+            Pending current = stack.back();
+            stack.pop_back();
+            if (current.node == nullptr)
+                continue;
 
-            std::cout << (isLeft ? "├──" : "└──");
+            std::cout << current.prefix;
+            std::cout << (current.isLeft ? "├──" : "└──");
 
             // print the value of the node
-            std::cout << node->getKey() << ": " << node->getValue() << std::endl;
+            std::cout << current.node->getKey() << ": " << current.node->getValue() << std::endl;
+
+            // enter the next tree level - left and right branch (la derecha entra primero a la pila)
+            std::string childPrefix = current.prefix + (current.isLeft ? "│   " : "    ");
+            stack.push_back(Pending{current.node->getRight(), childPrefix, false});
+            stack.push_back(Pending{current.node->getLeft(), childPrefix, true});
+        }
+    }
+
+    // ==================== MÉTODOS AUXILIARES DE BALANCEO ====================
+
+    /**
+     * @brief Rotación a la derecha: el hijo izquierdo sube
+     * @return Nueva raíz del subárbol
+     */
+    static Node *rotateRight(Node *node)
+    {
+        Node *left = node->getLeft();
+        node->setLeft(left->getRight());
+        left->setRight(node);
+        return left;
+    }
+
+    /**
+     * @brief Rotación a la izquierda: el hijo derecho sube
+     * @return Nueva raíz del subárbol
+     */
+    static Node *rotateLeft(Node *node)
+    {
+        Node *right = node->getRight();
+        node->setRight(right->getLeft());
+        right->setLeft(node);
+        return right;
+    }
+
+    /**
+     * @brief Pone child en el lugar que ocupaba old (no nulo) bajo parent, o en la raíz
+     */
+    void replaceChild(Node *parent, Node *old, Node *child)
+    {
+        if (parent == nullptr)
+            root = child;
+        else if (parent->getLeft() == old)
+            parent->setLeft(child);
+        else
+            parent->setRight(child);
+    }
+
+    /**
+     * @brief Splay top-down: reorganiza el subárbol para que k (o la última clave visitada) quede en la raíz
+     * @param node Raíz del subárbol
+     * @param k Clave buscada (Key o un tipo comparable con Key)
+     * @return Nueva raíz del subárbol
+     *
+     * Baja una sola vez, colgando los nodos menores que k en un árbol
+     * izquierdo y los mayores en uno derecho (con rotación en los casos
+     * zig-zig), y al final los cuelga de la nueva raíz.
+     *
+     * @complexity O(log n) amortizado, O(1) espacio
+     */
+    template <typename K>
+    Node *splay(Node *node, const K &k) const
+    {
+        if (node == nullptr)
+            return nullptr;
+
+        Node *leftRoot = nullptr, *leftTail = nullptr;   // Claves menores que k
+        Node *rightRoot = nullptr, *rightTail = nullptr; // Claves mayores que k
+        while (true)
+        {
+            if (k < node->getKey())
+            {
+                if (!node->hasLeft())
+                    break;
+                if (k < node->getLeft()->getKey())
+                {
+                    node = rotateRight(node); // zig-zig
+                    if (!node->hasLeft())
+                        break;
+                }
+                // node y su derecha son mayores que k
+                if (rightTail == nullptr)
+                    rightRoot = node;
+                else
+                    rightTail->setLeft(node);
+                rightTail = node;
+                node = node->getLeft();
+            }
+            else if (node->getKey() < k)
+            {
+                if (!node->hasRight())
+                    break;
+                if (node->getRight()->getKey() < k)
+                {
+                    node = rotateLeft(node); // zag-zag
+                    if (!node->hasRight())
+                        break;
+                }
+                // node y su izquierda son menores que k
+                if (leftTail == nullptr)
+                    leftRoot = node;
+                else
+                    leftTail->setRight(node);
+                leftTail = node;
+                node = node->getRight();
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        // Armar: los árboles izquierdo y derecho pasan a ser los hijos de node
+        if (leftTail != nullptr)
+        {
+            leftTail->setRight(node->getLeft());
+            node->setLeft(leftRoot);
+        }
+        if (rightTail != nullptr)
+        {
+            rightTail->setLeft(node->getRight());
+            node->setRight(rightRoot);
+        }
+        return node;
+    }
+
+    /**
+     * @brief Siguiente prioridad aleatoria de Treap (xorshift32)
+     */
+    unsigned int nextPriority()
+    {
+        priorityState ^= priorityState << 13;
+        priorityState ^= priorityState >> 17;
+        priorityState ^= priorityState << 5;
+        return priorityState;
+    }
+
+    /**
+     * @brief Divide un treap en claves < k, claves > k y el nodo con clave k
+     * @param node Raíz del treap
+     * @param k Clave de corte
+     * @param less Recibe el treap con las claves menores que k
+     * @param greater Recibe el treap con las claves mayores que k
+     * @return Nodo con clave k (sin hijos) o nullptr si no estaba
+     *
+     * @complexity O(log n) esperado, O(1) espacio
+     */
+    static Node *treapSplit(Node *node, const Key &k, Node *&less, Node *&greater)
+    {
+        Node *lessTail = nullptr, *greaterTail = nullptr;
+        Node *equal = nullptr;
+        Node *lessRest = nullptr, *greaterRest = nullptr;
+        less = greater = nullptr;
+        while (node != nullptr)
+        {
+            if (node->getKey() < k)
+            {
+                // node y su izquierda van a less; su derecha se sigue dividiendo
+                if (lessTail == nullptr)
+                    less = node;
+                else
+                    lessTail->setRight(node);
+                lessTail = node;
+                node = node->getRight();
+            }
+            else if (k < node->getKey())
+            {
+                if (greaterTail == nullptr)
+                    greater = node;
+                else
+                    greaterTail->setLeft(node);
+                greaterTail = node;
+                node = node->getLeft();
+            }
+            else
+            {
+                equal = node;
+                lessRest = node->getLeft();
+                greaterRest = node->getRight();
+                equal->setLeft(nullptr);
+                equal->setRight(nullptr);
+                break;
+            }
+        }
+        if (lessTail == nullptr)
+            less = lessRest;
+        else
+            lessTail->setRight(lessRest);
+        if (greaterTail == nullptr)
+            greater = greaterRest;
+        else
+            greaterTail->setLeft(greaterRest);
+        return equal;
+    }
+
+    /**
+     * @brief Une dos treaps con todas las claves de a menores que las de b
+     * @return Raíz del treap unido
+     *
+     * Baja por la espina derecha de a y la izquierda de b eligiendo siempre
+     * la mayor prioridad.
+     *
+     * @complexity O(log n) esperado, O(1) espacio
+     */
+    static Node *treapMerge(Node *a, Node *b)
+    {
+        Node *result = nullptr;
+        Node *tail = nullptr;
+        bool tailRight = false; // Lado de tail donde se cuelga lo siguiente
+        while (true)
+        {
+            Node *chosen;
+            if (a == nullptr || b == nullptr)
+                chosen = (a != nullptr) ? a : b;
+            else
+                chosen = (a->priority > b->priority) ? a : b;
+
+            if (tail == nullptr)
+                result = chosen;
+            else if (tailRight)
+                tail->setRight(chosen);
+            else
+                tail->setLeft(chosen);
+
+            if (a == nullptr || b == nullptr)
+                return result;
+            tail = chosen;
+            if (chosen == a)
+            {
+                a = a->getRight(); // Lo que queda a la derecha de a se une con b
+                tailRight = true;
+            }
+            else
+            {
+                b = b->getLeft(); // Lo que queda a la izquierda de b se une con a
+                tailRight = false;
+            }
+        }
+    }
+
+    /**
+     * @brief Altura máxima permitida por Scapegoat para n nodos: log_{1/ALPHA}(n)
+     */
+    static unsigned int scapegoatDepthLimit(unsigned int n)
+    {
+        return static_cast<unsigned int>(std::log(static_cast<double>(n)) / -std::log(Scapegoat::ALPHA));
+    }
+
+    /**
+     * @brief Cuenta los nodos de un subárbol (Morris, sin memoria extra)
+     */
+    unsigned int subtreeSize(Node *node) const
+    {
+        unsigned int count = 0;
+        inorderHelper(node, [&count](const Node *) { count++; });
+        return count;
+    }
+
+    /**
+     * @brief Reconstruye un subárbol como un árbol perfectamente balanceado
+     * @param node Raíz del subárbol
+     * @return Nueva raíz del subárbol
+     *
+     * Los nodos se reusan: solo cambian sus enlaces.
+     *
+     * @complexity O(tamaño del subárbol)
+     */
+    Node *rebuild(Node *node)
+    {
+        std::vector<Node *> sorted;
+        inorderHelper(node, [&sorted](const Node *n) { sorted.push_back(const_cast<Node *>(n)); });
+
+        // Rangos [lo, hi) pendientes, con el padre y el lado donde cuelga su mitad
+        struct Range
+        {
+            std::size_t lo, hi;
+            Node *parent;
+            bool isLeft;
+        };
+        Node *subtreeRoot = nullptr;
+        std::vector<Range> pending;
+        pending.push_back(Range{0, sorted.size(), nullptr, false});
+        while (!pending.empty())
+        {
+            Range range = pending.back();
+            pending.pop_back();
+            Node *middle = nullptr;
+            if (range.lo < range.hi)
+            {
+                std::size_t mid = range.lo + (range.hi - range.lo) / 2;
+                middle = sorted[mid];
+                pending.push_back(Range{range.lo, mid, middle, true});
+                pending.push_back(Range{mid + 1, range.hi, middle, false});
+            }
+            if (range.parent == nullptr)
+                subtreeRoot = middle;
+            else if (range.isLeft)
+                range.parent->setLeft(middle);
+            else
+                range.parent->setRight(middle);
+        }
+        return subtreeRoot;
+    }
+
+    /*
+     * Cada insertBalanced busca k y, si no está, lo inserta con factory()
+     * según la política. Devuelve el nodo de k e indica en inserted si es
+     * nuevo; insert, getOrInsert y upsert deciden qué hacer con el valor.
+     */
+
+    /**
+     * @brief Inserción sin balanceo
+     */
+    template <typename Factory>
+    Node *insertBalanced(const Key &k, Factory &factory, bool &inserted, NoBalancing)
+    {
+        if (empty())
+        {
+            root = new Node(k, factory());
+            sz++;
+            inserted = true;
+            return root;
+        }
+        return insertHelper(root, k, factory, inserted);
+    }
 
-            // enter the next tree level - left and right branch
-            printTreeHelper(node->getLeft(), prefix + (isLeft ? "│   " : "    "), true);
-            printTreeHelper(node->getRight(), prefix + (isLeft ? "│   " : "    "), false);
+    /**
+     * @brief Inserción Splay: la clave nueva (o actualizada) queda en la raíz
+     */
+    template <typename Factory>
+    Node *insertBalanced(const Key &k, Factory &factory, bool &inserted, Splay)
+    {
+        inserted = true;
+        if (empty())
+        {
+            root = new Node(k, factory());
+            sz++;
+            return root;
+        }
+        root = splay(root, k);
+        if (!(k < root->getKey()) && !(root->getKey() < k))
+        {
+            inserted = false;
+            return root;
+        }
+        // La raíz es el vecino de k: se parte en dos alrededor del nodo nuevo
+        Node *node = new Node(k, factory());
+        if (k < root->getKey())
+        {
+            node->setLeft(root->getLeft());
+            node->setRight(root);
+            root->setLeft(nullptr);
+        }
+        else
+        {
+            node->setRight(root->getRight());
+            node->setLeft(root);
+            root->setRight(nullptr);
         }
+        root = node;
+        sz++;
+        return node;
+    }
+
+    /**
+     * @brief Inserción Treap: baja mientras las prioridades sean mayores y divide ahí
+     *
+     * Si la clave ya existía, su nodo se reusa con la prioridad nueva (sigue
+     * siendo aleatoria, así que el treap mantiene su distribución).
+     */
+    template <typename Factory>
+    Node *insertBalanced(const Key &k, Factory &factory, bool &inserted, Treap)
+    {
+        unsigned int priority = nextPriority();
+        Node *parent = nullptr;
+        bool isLeft = false; // Lado de parent donde está current
+        Node *current = root;
+        while (current != nullptr && current->priority >= priority)
+        {
+            if (k < current->getKey())
+            {
+                parent = current;
+                isLeft = true;
+                current = current->getLeft();
+            }
+            else if (current->getKey() < k)
+            {
+                parent = current;
+                isLeft = false;
+                current = current->getRight();
+            }
+            else
+            {
+                inserted = false;
+                return current;
+            }
+        }
+
+        Node *less, *greater;
+        Node *node = treapSplit(current, k, less, greater);
+        inserted = (node == nullptr);
+        if (inserted)
+        {
+            node = new Node(k, factory());
+            sz++;
+        }
+        node->priority = priority;
+        node->setLeft(less);
+        node->setRight(greater);
+        if (parent == nullptr)
+            root = node;
+        else if (isLeft)
+            parent->setLeft(node);
+        else
+            parent->setRight(node);
+        return node;
+    }
+
+    /**
+     * @brief Inserción Scapegoat: si el nodo nuevo queda demasiado hondo, reconstruye el ancestro desbalanceado
+     */
+    template <typename Factory>
+    Node *insertBalanced(const Key &k, Factory &factory, bool &inserted, Scapegoat)
+    {
+        // La altura nunca pasa de log_{1/ALPHA}(2^32) < 64, así que el camino cabe en un arreglo
+        Node *path[96];
+        unsigned int depth = 0;
+        Node *current = root;
+        while (current != nullptr)
+        {
+            if (k < current->getKey())
+            {
+                path[depth++] = current;
+                current = current->getLeft();
+            }
+            else if (current->getKey() < k)
+            {
+                path[depth++] = current;
+                current = current->getRight();
+            }
+            else
+            {
+                inserted = false;
+                return current;
+            }
+        }
+
+        Node *node = new Node(k, factory());
+        inserted = true;
+        if (depth == 0)
+            root = node;
+        else if (k < path[depth - 1]->getKey())
+            path[depth - 1]->setLeft(node);
+        else
+            path[depth - 1]->setRight(node);
+        sz++;
+        if (sz > maxSize)
+            maxSize = sz;
+        if (depth <= scapegoatDepthLimit(sz))
+            return node;
+
+        // Subir hasta el primer ancestro donde un hijo pesa más que ALPHA del total
+        Node *child = node;
+        unsigned int childSize = 1;
+        for (unsigned int i = depth; i-- > 0;)
+        {
+            Node *ancestor = path[i];
+            Node *sibling = (ancestor->getLeft() == child) ? ancestor->getRight() : ancestor->getLeft();
+            unsigned int ancestorSize = childSize + 1 + subtreeSize(sibling);
+            if (childSize > Scapegoat::ALPHA * ancestorSize)
+            {
+                replaceChild(i > 0 ? path[i - 1] : nullptr, ancestor, rebuild(ancestor));
+                break;
+            }
+            child = ancestor;
+            childSize = ancestorSize;
+        }
+        return node; // rebuild solo cambia enlaces: el nodo sigue siendo el mismo
+    }
+
+    /**
+     * @brief Búsqueda sin reorganizar (NoBalancing, Treap, Scapegoat)
+     * @return Nodo con clave k, nullptr si no existe
+     */
+    template <typename K, typename Mode>
+    Node *findBalanced(const K &k, Mode) const
+    {
+        return findHelper(root, k);
+    }
+
+    /**
+     * @brief Búsqueda Splay: la clave encontrada (o su vecina) sube a la raíz
+     * @return Nodo con clave k (la raíz), nullptr si no existe
+     */
+    template <typename K>
+    Node *findBalanced(const K &k, Splay) const
+    {
+        if (root == nullptr)
+            return nullptr;
+        root = splay(root, k);
+        return (!(k < root->getKey()) && !(root->getKey() < k)) ? root : nullptr;
+    }
+
+    /**
+     * @brief Eliminación sin balanceo
+     */
+    bool removeBalanced(const Key &k, NoBalancing)
+    {
+        if (!find(k))
+        {
+            return false; // Key not found
+        }
+        root = removeHelper(root, k);
+        sz--;
+        return true;
+    }
+
+    /**
+     * @brief Eliminación Splay: se sube k a la raíz y se unen sus dos subárboles
+     */
+    bool removeBalanced(const Key &k, Splay)
+    {
+        if (!findBalanced(k, Splay()))
+            return false;
+        Node *old = root;
+        if (!old->hasLeft())
+        {
+            root = old->getRight();
+        }
+        else
+        {
+            // El máximo del subárbol izquierdo sube y no tiene hijo derecho
+            root = splay(old->getLeft(), k);
+            root->setRight(old->getRight());
+        }
+        delete old;
+        sz--;
+        return true;
+    }
+
+    /**
+     * @brief Eliminación Treap: el nodo se reemplaza por la unión de sus hijos
+     */
+    bool removeBalanced(const Key &k, Treap)
+    {
+        Node *parent = nullptr;
+        Node *current = root;
+        while (current != nullptr && !(k == current->getKey()))
+        {
+            parent = current;
+            current = (k < current->getKey()) ? current->getLeft() : current->getRight();
+        }
+        if (current == nullptr)
+            return false;
+        replaceChild(parent, current, treapMerge(current->getLeft(), current->getRight()));
+        delete current;
+        sz--;
+        return true;
+    }
+
+    /**
+     * @brief Eliminación Scapegoat: si quedan menos de ALPHA * maxSize nodos, reconstruye todo
+     */
+    bool removeBalanced(const Key &k, Scapegoat)
+    {
+        if (!removeBalanced(k, NoBalancing()))
+            return false;
+        if (sz < Scapegoat::ALPHA * maxSize)
+        {
+            root = rebuild(root);
+            maxSize = sz;
+        }
+        return true;
     }
 
 public:
@@ -411,14 +1227,14 @@ public:
      * @brief Constructor por defecto - Crea un BST vacío
      * @complexity O(1)
      */
-    BST() : root(nullptr), sz(0) {}
+    BST() : root(nullptr), sz(0), maxSize(0), priorityState(2463534242u) {}
 
     /**
      * @brief Constructor de copia
      * @param other Árbol a copiar
      * @complexity O(n)
      */
-    BST(const BST &other)
+    BST(const BST &other) : maxSize(other.maxSize), priorityState(other.priorityState)
     {
         root = copyHelper(other.root); // Copiar el otro árbol
         sz = other.sz;                 // Actualizar el tamaño
@@ -437,6 +1253,7 @@ public:
             clear();                       // Limpiar el árbol actual
             root = copyHelper(other.root); // Copiar el otro árbol
             sz = other.sz;                 // Actualizar el tamaño
+            maxSize = other.maxSize;
         }
         return *this;
     }
@@ -454,36 +1271,133 @@ public:
      * @brief Inserta un nuevo par Key-Value en el árbol
      * @param k Clave a insertar
      * @param v Valor asociado
-     * @complexity O(log n) en promedio, O(n) en el peor caso
+     * @complexity O(log n) en promedio, O(n) en el peor caso sin balanceo;
+     *             O(log n) amortizado (Splay, Scapegoat) o esperado (Treap)
      *
      * Si la clave ya existe, actualiza su valor.
      * Mantiene la propiedad del BST basada en las claves.
      */
     void insert(const Key &k, const Value &v)
     {
-        if (empty())
-        {
-            root = new Node(k, v);
-            sz++;
-        }
-        else
-        {
-            insertHelper(root, k, v);
-        }
+        auto copyValue = [&v]() -> const Value & { return v; };
+        bool inserted;
+        Node *node = insertBalanced(k, copyValue, inserted, Balance());
+        if (!inserted)
+            node->setValue(v);
     }
+
+    /**
+     * @brief Obtiene el valor de k, insertándolo con factory() si no existe
+     * @param k Clave a buscar o insertar
+     * @param factory Función sin argumentos que devuelve el valor inicial (solo se llama si k no existe)
+     * @return Referencia al valor de k
+     * @complexity Una sola bajada: la misma que insert
+     *
+     * La referencia es válida hasta que se elimine k (los nodos no se mueven
+     * al rebalancear).
+     */
+    template <typename Factory>
+    Value &getOrInsert(const Key &k, Factory factory)
+    {
+        bool inserted;
+        return insertBalanced(k, factory, inserted, Balance())->getValue();
+    }
+
+    /**
+     * @brief Modifica el valor de k en el lugar, insertándolo con Value() si no existe
+     * @param k Clave a modificar o insertar
+     * @param fn Función que recibe Value& (también se llama con el valor recién insertado)
+     * @return true si k no existía y se insertó
+     * @complexity Una sola bajada: la misma que insert
+     *
+     * Ejemplo (contar palabras): arbol.upsert(palabra, [](int &c) { c++; });
+     */
+    template <typename Fn>
+    bool upsert(const Key &k, Fn fn)
+    {
+        auto defaultValue = []() { return Value(); };
+        bool inserted;
+        fn(insertBalanced(k, defaultValue, inserted, Balance())->getValue());
+        return inserted;
+    }
+
     /**
      * @brief Busca una clave en el árbol
      * @param k Clave a buscar
-     * @return Puntero al valor asociado, nullptr si no existe
-     * @complexity O(log n) en promedio, O(n) en el peor caso
+     * @return true si la clave existe, false en caso contrario
+     * @complexity O(log n) en promedio, O(n) en el peor caso sin balanceo
+     *
+     * Con Splay, la clave encontrada (o la última visitada) sube a la raíz.
      */
     bool find(const Key &k) const
     {
-        if (empty())
-        {
-            return false;
-        }
-        return findHelper(root, k);
+        return findBalanced(k, Balance()) != nullptr;
+    }
+
+    /**
+     * @brief Busca una clave de otro tipo comparable con Key (por ejemplo string_view con claves string)
+     * @param k Clave a buscar; se compara directamente, sin construir un Key temporal
+     * @return true si la clave existe, false en caso contrario
+     * @complexity La misma que find(const Key &)
+     */
+    template <typename K, typename = EnableIfComparable<K>>
+    bool find(const K &k) const
+    {
+        return findBalanced(k, Balance()) != nullptr;
+    }
+
+    /**
+     * @brief Obtiene el valor asociado a una clave con una sola bajada
+     * @param k Clave a buscar
+     * @return Puntero al valor, nullptr si no existe
+     * @complexity La misma que find
+     *
+     * Reemplaza el par find + insert para leer o modificar un valor. Con
+     * Splay la clave sube a la raíz igual que en find. El puntero es válido
+     * hasta que se elimine k.
+     */
+    Value *get(const Key &k)
+    {
+        Node *node = findBalanced(k, Balance());
+        return node == nullptr ? nullptr : &node->getValue();
+    }
+
+    /**
+     * @brief Obtiene el valor asociado a una clave (versión const)
+     * @param k Clave a buscar
+     * @return Puntero constante al valor, nullptr si no existe
+     * @complexity La misma que find
+     */
+    const Value *get(const Key &k) const
+    {
+        const Node *node = findBalanced(k, Balance());
+        return node == nullptr ? nullptr : &node->getValue();
+    }
+
+    /**
+     * @brief Obtiene el valor de una clave de otro tipo comparable con Key
+     * @param k Clave a buscar, sin construir un Key temporal
+     * @return Puntero al valor, nullptr si no existe
+     * @complexity La misma que find
+     */
+    template <typename K, typename = EnableIfComparable<K>>
+    Value *get(const K &k)
+    {
+        Node *node = findBalanced(k, Balance());
+        return node == nullptr ? nullptr : &node->getValue();
+    }
+
+    /**
+     * @brief Obtiene el valor de una clave de otro tipo comparable con Key (versión const)
+     * @param k Clave a buscar, sin construir un Key temporal
+     * @return Puntero constante al valor, nullptr si no existe
+     * @complexity La misma que find
+     */
+    template <typename K, typename = EnableIfComparable<K>>
+    const Value *get(const K &k) const
+    {
+        const Node *node = findBalanced(k, Balance());
+        return node == nullptr ? nullptr : &node->getValue();
     }
 
     /**
@@ -496,31 +1410,40 @@ public:
      * 1. Nodo sin hijos (hoja)
      * 2. Nodo con un hijo
      * 3. Nodo con dos hijos (usa sucesor inorden)
+     *
+     * Splay y Treap eliminan uniendo los dos subárboles del nodo; Scapegoat
+     * reconstruye todo el árbol cuando quedan menos de ALPHA * maxSize nodos.
      */
     bool remove(const Key &k)
     {
-        if (!find(k))
-        {
-            return false; // Key not found
-        }
-        root = removeHelper(root, k);
-        sz--;
-        return true;
+        return removeBalanced(k, Balance());
     }
 
     // ==================== TRAVERSALS ====================
 
     /**
      * @brief Recorrido Inorden (Izquierda-Raíz-Derecha)
-     * @complexity O(n)
+     * @complexity O(n) tiempo, O(1) espacio (recorrido de Morris)
      *
      * Imprime los pares Key-Value ordenados por clave ascendente
      */
     void inorder() const
     {
-        if (empty())
-            return;
-        inorderHelper(root);
+        inorderHelper(root, [](const Node *node) { cout << node->getKey() << ": " << node->getValue() << endl; });
+    }
+
+    /**
+     * @brief Recorrido Inorden con una función de visita
+     * @param fn Función llamada como fn(clave, valor) en orden ascendente
+     * @complexity O(n) tiempo, O(1) espacio (recorrido de Morris)
+     *
+     * fn no debe lanzar excepciones ni modificar el árbol: durante el
+     * recorrido hay enlaces temporales que se quitan al terminar.
+     */
+    template <typename Fn>
+    void inorder(Fn fn) const
+    {
+        inorderHelper(root, [&fn](const Node *node) { fn(node->getKey(), node->getValue()); });
     }
 
     /**
@@ -531,9 +1454,18 @@ public:
      */
     void preorder() const
     {
-        if (empty())
-            return;
-        preorderHelper(root);
+        preorderHelper(root, [](const Node *node) { cout << node->getKey() << ": " << node->getValue() << endl; });
+    }
+
+    /**
+     * @brief Recorrido Preorden con una función de visita
+     * @param fn Función llamada como fn(clave, valor)
+     * @complexity O(n)
+     */
+    template <typename Fn>
+    void preorder(Fn fn) const
+    {
+        preorderHelper(root, [&fn](const Node *node) { fn(node->getKey(), node->getValue()); });
     }
 
     /**
@@ -544,9 +1476,18 @@ public:
      */
     void postorder() const
     {
-        if (empty())
-            return;
-        postorderHelper(root);
+        postorderHelper(root, [](const Node *node) { cout << node->getKey() << ": " << node->getValue() << endl; });
+    }
+
+    /**
+     * @brief Recorrido Postorden con una función de visita
+     * @param fn Función llamada como fn(clave, valor)
+     * @complexity O(n)
+     */
+    template <typename Fn>
+    void postorder(Fn fn) const
+    {
+        postorderHelper(root, [&fn](const Node *node) { fn(node->getKey(), node->getValue()); });
     }
 
     /**
@@ -618,7 +1559,8 @@ public:
      * @return Altura (número de aristas en el camino más largo)
      * @complexity O(n)
      *
-     * Un árbol vacío tiene altura -1, un árbol con solo raíz tiene altura 0
+     * Un árbol vacío tiene altura -1, un árbol con solo raíz tiene altura 0.
+     * Se calcula por niveles, sin recursión.
      */
     int height() const
     {
@@ -641,15 +1583,16 @@ public:
 
     /**
      * @brief Elimina todos los nodos del árbol
-     * @complexity O(n)
+     * @complexity O(n) tiempo, O(1) espacio
      *
-     * Libera toda la memoria y deja el árbol vacío
+     * Libera toda la memoria y deja el árbol vacío, sin recursión
      */
     void clear()
     {
         clearHelper(root);
         root = nullptr;
         sz = 0;
+        maxSize = 0;
     }
 
     // ==================== ADDITIONAL USEFUL OPERATIONS ====================
@@ -753,7 +1696,7 @@ public:
         printTreeHelper(root, "", false);
     }
 };
-#endif __BST__
+#endif // __BST__
 
 /*  PENDIENTES DE IMPLEMENTAR:
   • remove(k)
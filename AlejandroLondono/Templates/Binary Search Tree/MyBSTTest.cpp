@@ -9,6 +9,11 @@
 #include <iostream>
 #include <string>
 #include <iomanip>
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string_view>
+#include <vector>
 
 using namespace std;
 
@@ -24,6 +29,89 @@ void printTest(const string &test, bool passed)
     cout << "[" << (passed ? "✓ PASS" : "✗ FAIL") << "] " << test << endl;
 }
 
+/**
+ * @brief Operaciones aleatorias contra std::map para una política de balanceo
+ * @return true si el contenido, el orden y el tamaño coinciden siempre
+ */
+template <typename Balance>
+bool randomAgainstMap(unsigned int seed)
+{
+    BST<int, int, Balance> tree;
+    map<int, int> reference;
+    mt19937 rng(seed);
+    for (int i = 0; i < 50000; i++)
+    {
+        int k = static_cast<int>(rng() % 2000);
+        unsigned int op = rng() % 3;
+        if (op == 0)
+        {
+            if (tree.remove(k) != (reference.erase(k) == 1))
+                return false;
+        }
+        else if (op == 1)
+        {
+            if (tree.find(k) != (reference.count(k) == 1))
+                return false;
+        }
+        else
+        {
+            tree.insert(k, i);
+            reference[k] = i;
+        }
+    }
+    vector<pair<int, int>> contents;
+    tree.inorder([&](const int &k, const int &v) { contents.push_back(make_pair(k, v)); });
+    return tree.size() == reference.size() && contents == vector<pair<int, int>>(reference.begin(), reference.end());
+}
+
+/**
+ * @brief upsert, getOrInsert y get mezclados con remove, contra std::map
+ * @return true si el contenido coincide al final
+ */
+template <typename Balance>
+bool upsertAgainstMap(unsigned int seed)
+{
+    BST<int, int, Balance> tree;
+    map<int, int> reference;
+    mt19937 rng(seed);
+    for (int i = 0; i < 50000; i++)
+    {
+        int k = static_cast<int>(rng() % 2000);
+        unsigned int op = rng() % 4;
+        if (op == 0)
+        {
+            if (tree.upsert(k, [i](int &v) { v += i; }) == (reference.count(k) == 1))
+                return false;
+            reference[k] += i;
+        }
+        else if (op == 1)
+        {
+            bool existed = reference.count(k) == 1;
+            int &v = tree.getOrInsert(k, [k]() { return -k; });
+            if (!existed)
+                reference[k] = -k;
+            if (v != reference[k])
+                return false;
+            v++;
+            reference[k]++;
+        }
+        else if (op == 2)
+        {
+            int *v = tree.get(k);
+            if ((v == nullptr) != (reference.count(k) == 0) || (v != nullptr && *v != reference[k]))
+                return false;
+        }
+        else
+        {
+            tree.remove(k);
+            reference.erase(k);
+        }
+    }
+    vector<pair<int, int>> contents;
+    tree.inorder([&](const int &k, const int &v) { contents.push_back(make_pair(k, v)); });
+    return tree.size() == reference.size() && contents == vector<pair<int, int>>(reference.begin(), reference.end());
+}
+
 int main()
 {
     cout << "\n╔══════════════════════════════════════════════════════════════════╗\n";
@@ -326,6 +414,99 @@ int main()
     cout << "\nEstructura (como lista enlazada):\n";
     degenerado.printTree();
 
+    // ==================== PRUEBA 21: Recorridos iterativos ====================
+    printHeader("PRUEBA 21: Recorridos iterativos y Morris");
+
+    vector<int> enOrden, preOrden, postOrden;
+    arbol4.inorder([&](const int &k, const int &) { enOrden.push_back(k); });
+    arbol4.preorder([&](const int &k, const int &) { preOrden.push_back(k); });
+    arbol4.postorder([&](const int &k, const int &) { postOrden.push_back(k); });
+    printTest("inorder(fn) visita en orden ascendente", enOrden.size() == 7 && is_sorted(enOrden.begin(), enOrden.end()));
+    printTest("preorder(fn) empieza por la raíz", preOrden.size() == 7 && preOrden.front() == 10);
+    printTest("postorder(fn) termina en la raíz", postOrden.size() == 7 && postOrden.back() == 10);
+    vector<int> otraVez;
+    arbol4.inorder([&](const int &k, const int &) { otraVez.push_back(k); });
+    printTest("Morris deja el árbol intacto", otraVez == enOrden);
+
+    // ==================== PRUEBA 22: Árbol degenerado grande ====================
+    printHeader("PRUEBA 22: 20000 claves ordenadas sin recursión");
+
+    // Insertar en orden es O(n^2), pero ninguna operación usa la pila de llamadas
+    const int N = 20000;
+    BST<int, int> lista;
+    for (int i = 0; i < N; i++)
+    {
+        lista.insert(i, i);
+    }
+    printTest("height() = N - 1", lista.height() == N - 1);
+    printTest("find(N - 1) en el fondo de la lista", lista.find(N - 1));
+    long long suma = 0;
+    int anterior = -1;
+    bool ordenado = true;
+    lista.inorder([&](const int &k, const int &) {
+        ordenado = ordenado && k == anterior + 1;
+        anterior = k;
+        suma += k;
+    });
+    printTest("inorder(fn) de Morris sobre la lista", ordenado && suma == 1LL * N * (N - 1) / 2);
+    BST<int, int> copiaLista(lista);
+    printTest("Copia iterativa", copiaLista.size() == N && copiaLista.height() == N - 1);
+    lista.remove(0);
+    lista.remove(N / 2);
+    printTest("remove en la lista", lista.size() == N - 2 && !lista.find(N / 2) && lista.findMin() == 1);
+    copiaLista.clear();
+    printTest("clear() en espacio constante", copiaLista.empty() && copiaLista.size() == 0);
+
+    // ==================== PRUEBA 23: Políticas de balanceo ====================
+    printHeader("PRUEBA 23: Splay, Treap y Scapegoat");
+
+    printTest("NoBalancing: 50000 operaciones contra std::map", randomAgainstMap<NoBalancing>(1));
+    printTest("Splay: 50000 operaciones contra std::map", randomAgainstMap<Splay>(2));
+    printTest("Treap: 50000 operaciones contra std::map", randomAgainstMap<Treap>(3));
+    printTest("Scapegoat: 50000 operaciones contra std::map", randomAgainstMap<Scapegoat>(4));
+
+    BST<int, int, Treap> treap;
+    BST<int, int, Scapegoat> scapegoat;
+    BST<int, int, Splay> splay;
+    for (int i = 0; i < 100000; i++)
+    {
+        treap.insert(i, i);
+        scapegoat.insert(i, i);
+        splay.insert(i, i);
+    }
+    cout << "\nAltura con 100000 claves ordenadas: Treap " << treap.height() << ", Scapegoat "
+         << scapegoat.height() << ", Splay " << splay.height() << endl;
+    printTest("Treap: altura O(log n) con claves ordenadas", treap.height() < 60);
+    printTest("Scapegoat: altura <= log_{1/0.7}(n)", scapegoat.height() <= 32);
+    splay.find(0);
+    printTest("Splay: find(0) deja la clave en la raíz", splay.findMin() == 0 && splay.height() < 100000);
+    BST<int, int, Treap> copiaTreap(treap);
+    printTest("Copia de un Treap conserva la forma", copiaTreap.height() == treap.height() && copiaTreap.size() == 100000);
+    for (int i = 0; i < 90000; i++)
+        scapegoat.remove(i);
+    printTest("Scapegoat: reconstruye al eliminar", scapegoat.size() == 10000 && scapegoat.height() <= 26);
+
+    // ==================== PRUEBA 24: get, getOrInsert, upsert y búsqueda heterogénea ====================
+    printHeader("PRUEBA 24: get, getOrInsert, upsert y búsqueda heterogénea");
+
+    printTest("NoBalancing: 50000 upsert/getOrInsert/get contra std::map", upsertAgainstMap<NoBalancing>(5));
+    printTest("Splay: 50000 upsert/getOrInsert/get contra std::map", upsertAgainstMap<Splay>(6));
+    printTest("Treap: 50000 upsert/getOrInsert/get contra std::map", upsertAgainstMap<Treap>(7));
+    printTest("Scapegoat: 50000 upsert/getOrInsert/get contra std::map", upsertAgainstMap<Scapegoat>(8));
+
+    BST<string, int, Splay> palabras;
+    vector<string> texto = {"sol", "mar", "sol", "luna", "sol", "mar"};
+    for (const string &palabra : texto)
+        palabras.upsert(palabra, [](int &c) { c++; });
+    printTest("upsert cuenta palabras", palabras.size() == 3 && *palabras.get("sol") == 3 && *palabras.get("mar") == 2);
+    string_view vista = "luna";
+    printTest("find y get con string_view, sin string temporal",
+              palabras.find(vista) && *palabras.get(vista) == 1 && !palabras.find(string_view("cielo")));
+    *palabras.get("luna") = 7;
+    const BST<string, int, Splay> &palabrasConst = palabras;
+    printTest("get permite modificar el valor en el lugar", *palabrasConst.get(string("luna")) == 7);
+    printTest("get de una clave ausente devuelve nullptr", palabras.get("cielo") == nullptr);
+
     // ==================== RESUMEN FINAL ====================
     printHeader("RESUMEN DE FUNCIONALIDADES PROBADAS");
 
@@ -340,6 +521,12 @@ int main()
     cout << "  • preorder() - raíz primero\n";
     cout << "  • postorder() - raíz último\n";
     cout << "  • levelOrder() - por niveles\n";
+    cout << "  • inorder(fn) / preorder(fn) / postorder(fn) - sin recursión (Morris en inorden)\n";
+
+    cout << "\n✓ BALANCEO:\n";
+    cout << "  • BST<Key, Value, Splay | Treap | Scapegoat>\n";
+    cout << "  • get(k) / getOrInsert(k, factory) / upsert(k, fn) - una sola bajada\n";
+    cout << "  • find(k) / get(k) con claves heterogéneas (string_view)\n";
 
     cout << "\n✓ HELPER OPERATIONS:\n";
     cout << "  • findMin() / findMaximum()\n";
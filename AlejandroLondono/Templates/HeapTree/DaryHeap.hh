@@ -0,0 +1,249 @@
+#ifndef DARY_HEAP_HH
+#define DARY_HEAP_HH
+
+#include "DarySift.hh"
+
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+/*1. Arity (d hijos por nodo)
+
+Qué es: Cada nodo tiene Arity hijos en vez de 2; los hijos de i están en [Arity*i + 1, Arity*i + Arity]
+Por qué: El árbol queda con log_d(n) niveles en vez de log_2(n). Los d hijos
+están contiguos en el vector, así que compararlos para elegir el mayor cuesta
+casi lo mismo que comparar dos: con pair<int, int> (8 bytes), 8 hijos ocupan
+una línea de caché de 64 bytes.
+
+2. Sift con "hueco" en vez de swaps
+
+Qué es: Se saca el elemento que se mueve, se corren los demás un nivel y se
+escribe el elemento una sola vez al final
+Por qué: Un swap son tres movimientos por nivel; con el hueco es uno.
+
+3. heapifyDown iterativo
+
+Qué es: Un while en vez de la llamada recursiva
+Por qué: Evita una llamada por nivel y permite al compilador mantener el
+elemento en registros durante todo el recorrido.
+
+4. Construcción de Floyd (heapify)
+
+Qué es: Se copian todos los elementos y se hace heapifyDown desde el último
+padre hasta la raíz
+Por qué: La mayoría de los nodos están cerca de las hojas y bajan pocos
+niveles, así que el total es O(n) en vez de O(n log n) con n inserts.*/
+
+/**
+ * @brief Max-heap of (priority, value) pairs with a configurable number of children per node.
+ *
+ * Default engine of HeapTree (see DaryHeap below). The element with the
+ * greatest priority is always at the root. Sifts move a "hole" instead of
+ * swapping pairs and are iterative.
+ *
+ * @tparam Priority Type of the priorities (must support operator<).
+ * @tparam Value Type of the values stored with each priority.
+ * @tparam Arity Number of children per node (2 = binary heap). 4 or 8 are usually the fastest.
+ */
+template <typename Priority, typename Value, unsigned int Arity = 4>
+class DaryHeapEngine
+{
+    static_assert(Arity >= 2, "DaryHeapEngine needs at least 2 children per node");
+
+private:
+    vector<pair<Priority, Value>> heap; ///< Elements in level order.
+
+    typedef DarySift<Arity> Sift;
+
+    static bool lessPriority(const pair<Priority, Value> &a, const pair<Priority, Value> &b) { return a.first < b.first; }
+
+    /**
+     * @brief Move the element at i up until its parent is not smaller.
+     * @param i Position of the element.
+     */
+    void heapifyUp(unsigned int i)
+    {
+        Sift::up(heap, i, lessPriority, [this](unsigned int j, pair<Priority, Value> &&e) { heap[j] = std::move(e); });
+    }
+
+    /**
+     * @brief Move the element at i down until no child is greater.
+     * @param i Position of the element.
+     */
+    void heapifyDown(unsigned int i)
+    {
+        Sift::down(heap, i, lessPriority, [this](unsigned int j, pair<Priority, Value> &&e) { heap[j] = std::move(e); });
+    }
+
+    /**
+     * @brief Floyd's bottom-up construction over the whole vector.
+     */
+    void heapify()
+    {
+        if (heap.size() < 2)
+            return;
+        for (unsigned int i = Sift::parent(heap.size() - 1) + 1; i-- > 0;)
+            heapifyDown(i);
+    }
+
+    /**
+     * @brief Restore the heap after appending the elements from position oldSize on.
+     * @param oldSize Number of elements that already formed a heap.
+     */
+    void fixAppended(unsigned int oldSize)
+    {
+        unsigned int added = heap.size() - oldSize;
+        // Si el lote es al menos tan grande como el heap, reconstruir todo (O(n))
+        // es más barato que subir cada elemento (O(k log n) en el peor caso).
+        if (added >= oldSize)
+        {
+            heapify();
+        }
+        else
+        {
+            for (unsigned int i = oldSize; i < heap.size(); i++)
+                heapifyUp(i);
+        }
+    }
+
+public:
+    DaryHeapEngine() {}
+
+    /**
+     * @brief Build a heap from a range of (priority, value) pairs in O(n).
+     * @param first Iterator to the first pair.
+     * @param last Iterator past the last pair.
+     */
+    template <typename InputIt>
+    DaryHeapEngine(InputIt first, InputIt last) : heap(first, last)
+    {
+        heapify();
+    }
+
+    /**
+     * @brief Insert a value with the given priority.
+     * @param p Priority of the value.
+     * @param v Value to insert.
+     */
+    void insert(const Priority &p, const Value &v)
+    {
+        heap.emplace_back(p, v);
+        heapifyUp(heap.size() - 1);
+    }
+
+    /**
+     * @brief Insert a range of (priority, value) pairs.
+     * @param first Iterator to the first pair.
+     * @param last Iterator past the last pair.
+     * @note Uses Floyd's heapify when the batch is at least as large as the heap.
+     */
+    template <typename InputIt>
+    void insertBatch(InputIt first, InputIt last)
+    {
+        unsigned int oldSize = heap.size();
+        heap.insert(heap.end(), first, last);
+        fixAppended(oldSize);
+    }
+
+    /**
+     * @brief Move all the elements of another heap into this one.
+     * @param other Heap to merge; it is left empty.
+     */
+    void merge(DaryHeapEngine &&other)
+    {
+        if (this == &other)
+            return;
+        // Anexar siempre el heap más chico al más grande
+        if (heap.size() < other.heap.size())
+            heap.swap(other.heap);
+        unsigned int oldSize = heap.size();
+        heap.insert(heap.end(), make_move_iterator(other.heap.begin()), make_move_iterator(other.heap.end()));
+        other.heap.clear();
+        fixAppended(oldSize);
+    }
+
+    /**
+     * @brief Copy all the elements of another heap into this one.
+     * @param other Heap to merge; it is not modified.
+     */
+    void merge(const DaryHeapEngine &other)
+    {
+        if (this == &other)
+        {
+            vector<pair<Priority, Value>> copy(heap);
+            insertBatch(copy.begin(), copy.end());
+            return;
+        }
+        insertBatch(other.heap.begin(), other.heap.end());
+    }
+
+    /**
+     * @brief Get the element with the greatest priority without removing it.
+     * @return Reference to the (priority, value) pair at the root.
+     * @throws std::runtime_error if the heap is empty.
+     */
+    const pair<Priority, Value> &max() const
+    {
+        if (heap.empty())
+            throw runtime_error("HeapTree is empty");
+        return heap[0];
+    }
+
+    /**
+     * @brief Remove and return the element with the greatest priority.
+     * @return The (priority, value) pair that was at the root.
+     * @throws std::runtime_error if the heap is empty.
+     */
+    pair<Priority, Value> extractMax()
+    {
+        if (heap.empty())
+            throw runtime_error("HeapTree is empty");
+
+        pair<Priority, Value> maxElem = std::move(heap[0]);
+        if (heap.size() > 1)
+        {
+            heap[0] = std::move(heap.back());
+            heap.pop_back();
+            heapifyDown(0);
+        }
+        else
+        {
+            heap.pop_back();
+        }
+        return maxElem;
+    }
+
+    /**
+     * @brief Reserve memory for at least n elements.
+     * @param n Number of elements.
+     */
+    void reserve(unsigned int n) { heap.reserve(n); }
+
+    unsigned int size() const { return heap.size(); }
+    bool isEmpty() const { return heap.empty(); }
+    void clear() { heap.clear(); }
+
+    void printHeap() const
+    {
+        for (auto &p : heap)
+            cout << "(" << p.first << ", " << p.second << ") ";
+        cout << "\n";
+    }
+};
+
+/**
+ * @brief HeapTree policy that selects a DaryHeapEngine with the given arity.
+ * @tparam Arity Number of children per node (2 = binary heap).
+ */
+template <unsigned int Arity>
+struct DaryHeap
+{
+    template <typename Priority, typename Value>
+    using Heap = DaryHeapEngine<Priority, Value, Arity>;
+};
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef DARY_SIFT_HH
+#define DARY_SIFT_HH
+
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Hole-based sift-up and sift-down shared by the d-ary heaps.
+ *
+ * DaryHeapEngine, IndexedHeapTree and SoaHeapTree keep their elements in
+ * level order in a vector and only differ in what they store and in what
+ * happens when an element lands on a position (IndexedHeapTree records it in
+ * its handle table). The sifts take that store step as a callback:
+ * place(i, std::move(elem)) must write elem at heap[i].
+ *
+ * The element that moves is taken out once, the others are shifted one
+ * level into the hole, and it is written back once at the end.
+ *
+ * @tparam Arity Number of children per node.
+ */
+template <unsigned int Arity>
+struct DarySift
+{
+    static_assert(Arity >= 2, "DarySift needs at least 2 children per node");
+
+    static unsigned int parent(unsigned int i) { return (i - 1) / Arity; }
+    static unsigned int firstChild(unsigned int i) { return Arity * i + 1; }
+
+    /**
+     * @brief Move the element at i up until its parent is not smaller.
+     * @param heap Elements in level order.
+     * @param i Position of the element.
+     * @param less less(a, b) is true if a has a smaller priority than b.
+     * @param place place(j, std::move(e)) stores e at position j.
+     */
+    template <typename T, typename Less, typename Place>
+    static void up(vector<T> &heap, unsigned int i, Less less, Place place)
+    {
+        T elem = std::move(heap[i]);
+        while (i > 0 && less(heap[parent(i)], elem))
+        {
+            place(i, std::move(heap[parent(i)]));
+            i = parent(i);
+        }
+        place(i, std::move(elem));
+    }
+
+    /**
+     * @brief Move the element at i down until no child is greater.
+     * @param heap Elements in level order.
+     * @param i Position of the element.
+     * @param less less(a, b) is true if a has a smaller priority than b.
+     * @param place place(j, std::move(e)) stores e at position j.
+     */
+    template <typename T, typename Less, typename Place>
+    static void down(vector<T> &heap, unsigned int i, Less less, Place place)
+    {
+        unsigned int n = heap.size();
+        T elem = std::move(heap[i]);
+        for (;;)
+        {
+            unsigned int first = firstChild(i);
+            if (first >= n)
+                break;
+
+            // Elegir el mayor de los hijos (contiguos en memoria)
+            unsigned int last = (first + Arity < n) ? first + Arity : n;
+            unsigned int largest = first;
+            for (unsigned int c = first + 1; c < last; c++)
+            {
+                if (less(heap[largest], heap[c]))
+                    largest = c;
+            }
+
+            if (!less(elem, heap[largest]))
+                break;
+            place(i, std::move(heap[largest]));
+            i = largest;
+        }
+        place(i, std::move(elem));
+    }
+};
+
+#endif
@@ -1,98 +1,126 @@
 #include <iostream>
+#include <string>
 #include <vector>
-#include <stdexcept>
-#include <utility>
+#include "HeapTree.hh"
+#include "IndexedHeapTree.hh"
+#include "SoaHeapTree.hh"
 using namespace std;
 
-template <typename Priority, typename Value>
-class HeapTree
+int main()
 {
-private:
-    vector<pair<Priority, Value>> heap;
+    HeapTree<int, string> heap; // 4 hijos por nodo
 
-   unsigned int left(unsigned int i) const { return 2 * i + 1; }
-   unsigned int right(unsigned int i) const { return 2 * i + 2; }
-   unsigned int parent(unsigned int i) const { return (i - 1) / 2; }
+    heap.insert(10, "A");
+    heap.insert(4, "B");
+    heap.insert(15, "C");
+    heap.insert(7, "D");
 
-    int size() const { return heap.size(); }
+    cout << "Heap actual: ";
+    heap.printHeap();
 
-    void heapifyUp(int i)
-    {
-        while (i > 0 && heap[i].first > heap[parent(i)].first)
-        {
-            swap(heap[i], heap[parent(i)]);
-            i = parent(i);
-        }
-    }
+    cout << "Extraer máximo: ";
+    auto maxElem = heap.extractMax();
+    cout << "(" << maxElem.first << ", " << maxElem.second << ")\n";
 
-    void heapifyDown(int i)
+    cout << "Heap luego de extraer: ";
+    heap.printHeap();
+
+    HeapTree<int, string, DaryHeap<2>> binary; // Mismo comportamiento que el heap binario original
+    binary.insert(3, "x");
+    binary.insert(9, "y");
+    binary.insert(5, "z");
+    cout << "Heap binario, máximo: (" << binary.max().first << ", " << binary.max().second << ")\n";
+
+    // Construcción en O(n), inserción por lotes, unión y top-k
+    vector<pair<int, string>> items = {{3, "e"}, {12, "f"}, {1, "g"}, {9, "h"}, {6, "i"}};
+    HeapTree<int, string> built(items.begin(), items.end());
+    cout << "\nHeap construido desde un rango: ";
+    built.printHeap();
+
+    vector<pair<int, string>> batch = {{11, "j"}, {2, "k"}};
+    built.insertBatch(batch.begin(), batch.end());
+    built.merge(std::move(heap));
+    cout << "Luego de insertBatch y merge: ";
+    built.printHeap();
+
+    cout << "Top 3: ";
+    for (auto &e : built.extractTopK(3))
+        cout << "(" << e.first << ", " << e.second << ") ";
+    cout << "\nQuedan " << built.size() << " elementos\n";
+
+    // Otros motores detrás de la misma interfaz
+    HeapTree<int, string, PairingHeap> pairing;
+    pairing.insert(2, "p");
+    pairing.insert(8, "q");
+    HeapTree<int, string, PairingHeap> other;
+    other.insert(5, "r");
+    pairing.merge(std::move(other)); // O(1)
+    cout << "PairingHeap luego de merge, máximo: (" << pairing.max().first << ", " << pairing.max().second << ")\n";
+
+    HeapTree<int, string, RadixHeap> radix; // Prioridades que nunca superan el último máximo
+    radix.insert(100, "t0");
+    radix.insert(90, "t1");
+    cout << "RadixHeap, extraer: " << radix.extractMax().second;
+    radix.insert(95, "t2");
+    cout << ", luego: " << radix.extractMax().second << "\n";
+    try
     {
-        int largest = i;
-        int l = left(i);
-        int r = right(i);
-
-        if (l < size() && heap[l].first > heap[largest].first)
-            largest = l;
-        if (r < size() && heap[r].first > heap[largest].first)
-            largest = r;
-
-        if (largest != i)
-        {
-            swap(heap[i], heap[largest]);
-            heapifyDown(largest);
-        }
+        radix.insert(120, "t3");
     }
-
-public:
-    HeapTree() {}
-
-    void insert(const Priority &p, const Value &v)
+    catch (const invalid_argument &e)
     {
-        heap.push_back({p, v});
-        heapifyUp(size() - 1);
+        cout << "RadixHeap, insertar 120: " << e.what() << "\n";
     }
 
-    pair<Priority, Value> extractMax()
-    {
-        if (size() == 0)
-            throw runtime_error("HeapTree is empty");
+    // Prioridades y valores en arreglos separados: los sifts no mueven los strings
+    SoaHeapTree<int, string> jobs;
+    jobs.insert(4, "reporte mensual");
+    jobs.insert(9, "respaldo de la base de datos");
+    jobs.insert(6, "reindexar");
+    cout << "\nSoaHeapTree, máximo: (" << jobs.maxPriority() << ", " << jobs.maxValue() << ")\n";
 
-        pair<Priority, Value> maxElem = heap[0];
-        heap[0] = heap.back();
-        heap.pop_back();
+    HeapTree<int, string, SoaDaryHeap<4>> soa(items.begin(), items.end()); // El mismo motor detrás de HeapTree
+    soa.merge(std::move(jobs));
+    cout << "HeapTree con SoaDaryHeap, top 2: ";
+    for (auto &e : soa.extractTopK(2))
+        cout << "(" << e.first << ", " << e.second << ") ";
+    cout << "\n";
 
-        if (size() > 0)
-            heapifyDown(0);
+    // Heap indexado: cambiar prioridades sin reinsertar
+    IndexedHeapTree<int, string> tasks;
+    auto a = tasks.insert(5, "compilar");
+    auto b = tasks.insert(8, "testear");
+    auto c = tasks.insert(2, "desplegar");
 
-        return maxElem;
-    }
+    cout << "\nTareas: ";
+    tasks.printHeap();
 
-    void printHeap() const
-    {
-        for (auto &p : heap)
-            cout << "(" << p.first << ", " << p.second << ") ";
-        cout << "\n";
-    }
-};
+    tasks.increaseKey(c, 10);
+    cout << "increaseKey(desplegar, 10), máximo: " << tasks.max().second << "\n";
 
-int main()
-{
-    HeapTree<int, string> heap;
-
-    heap.insert(10, "A");
-    heap.insert(4, "B");
-    heap.insert(15, "C");
-    heap.insert(7, "D");
+    tasks.decreaseKey(c, 1);
+    cout << "decreaseKey(desplegar, 1), máximo: " << tasks.max().second << "\n";
 
-    cout << "Heap actual: ";
-    heap.printHeap();
+    tasks.erase(b);
+    cout << "erase(testear), máximo: " << tasks.max().second
+         << ", contiene testear: " << (tasks.contains(b) ? "true" : "false") << "\n";
 
-    cout << "Extraer máximo: ";
-    auto maxElem = heap.extractMax();
-    cout << "(" << maxElem.first << ", " << maxElem.second << ")\n";
+    try
+    {
+        tasks.decreaseKey(a, 20);
+    }
+    catch (const invalid_argument &e)
+    {
+        cout << "decreaseKey hacia arriba: " << e.what() << "\n";
+    }
 
-    cout << "Heap luego de extraer: ";
-    heap.printHeap();
+    cout << "Orden de salida: ";
+    while (!tasks.isEmpty())
+    {
+        auto t = tasks.extractMax();
+        cout << "(" << t.first << ", " << t.second << ") ";
+    }
+    cout << "\n";
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,64 @@
+#ifndef HEAP_TREE_HH
+#define HEAP_TREE_HH
+
+#include "DaryHeap.hh"
+#include "PairingHeap.hh"
+#include "RadixHeap.hh"
+#include "SoaHeapTree.hh"
+
+#include <vector>
+#include <utility>
+
+using namespace std;
+
+/*Motores (Engine)
+
+Qué es: HeapTree delega en una política que elige la estructura por dentro
+    DaryHeap<d>   heap d-ario en un vector (por defecto, d = 4)
+    PairingHeap   heap de emparejamiento: insert y merge en O(1)
+    RadixHeap     heap de radix: prioridades enteras que nunca superan el último máximo
+    SoaDaryHeap<d> heap d-ario con prioridades y valores en arreglos separados
+Por qué: Cada carga de trabajo tiene un ganador distinto, y así se cambia de
+motor sin tocar el código que usa insert / extractMax.
+Ejemplo: HeapTree<int, string, PairingHeap> h; h.insert(5, "a");*/
+
+/**
+ * @brief Max-heap of (priority, value) pairs with a selectable engine.
+ *
+ * Every engine provides insert, max, extractMax, merge, size, isEmpty,
+ * clear, printHeap and a range constructor. Engine-specific operations
+ * (e.g. the insertBatch and reserve of the d-ary engines) are available too.
+ *
+ * @tparam Priority Type of the priorities (must support operator<).
+ * @tparam Value Type of the values stored with each priority.
+ * @tparam Engine Policy that selects the implementation: DaryHeap<Arity>, PairingHeap, RadixHeap or SoaDaryHeap<Arity>.
+ */
+template <typename Priority, typename Value, typename Engine = DaryHeap<4>>
+class HeapTree : public Engine::template Heap<Priority, Value>
+{
+private:
+    typedef typename Engine::template Heap<Priority, Value> Base;
+
+public:
+    using Base::Base;
+
+    HeapTree() {}
+
+    /**
+     * @brief Remove and return the k elements with the greatest priorities.
+     * @param k Number of elements to extract (fewer if the heap is smaller).
+     * @return The extracted pairs, from greatest to smallest priority.
+     */
+    vector<pair<Priority, Value>> extractTopK(unsigned int k)
+    {
+        if (k > this->size())
+            k = this->size();
+        vector<pair<Priority, Value>> top;
+        top.reserve(k);
+        for (unsigned int i = 0; i < k; i++)
+            top.push_back(this->extractMax());
+        return top;
+    }
+};
+
+#endif
@@ -0,0 +1,516 @@
+/**
+ * @file HeapTreeTest.cpp
+ * @brief Pruebas de HeapTree (todos los motores) e IndexedHeapTree contra std::priority_queue
+ *
+ * Compilar, por ejemplo:
+ *   g++ -std=c++17 -fsanitize=address,undefined HeapTreeTest.cpp -o HeapTreeTest
+ *
+ * Cada motor recibe la misma secuencia de operaciones al azar (insert,
+ * extractMax, max, merge, insertBatch, extractTopK, clear) que un
+ * std::priority_queue. Como con prioridades repetidas el orden entre
+ * empates no está definido, se compara la prioridad y se verifica que el
+ * valor extraído sea uno vivo con esa prioridad.
+ */
+
+#include "HeapTree.hh"
+#include "IndexedHeapTree.hh"
+#include <climits>
+#include <iostream>
+#include <map>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+int failures = 0;
+
+void printHeader(const string &title)
+{
+    cout << "\n" << string(70, '=') << endl;
+    cout << "  " << title << endl;
+    cout << string(70, '=') << endl;
+}
+
+void printTest(const string &test, bool passed)
+{
+    if (!passed)
+        failures++;
+    cout << "[" << (passed ? "✓ PASS" : "✗ FAIL") << "] " << test << endl;
+}
+
+/**
+ * @brief Modelo: std::priority_queue con las prioridades, más la prioridad de cada valor vivo
+ */
+struct Model
+{
+    priority_queue<long long> priorities;
+    map<string, long long> live; ///< valor -> prioridad, de los elementos que siguen en el heap
+
+    void insert(long long p, const string &v)
+    {
+        priorities.push(p);
+        live[v] = p;
+    }
+
+    /**
+     * @brief Verifica un par extraído del heap y lo saca del modelo.
+     */
+    bool extract(const pair<long long, string> &e)
+    {
+        if (priorities.empty() || priorities.top() != e.first)
+            return false;
+        auto it = live.find(e.second);
+        if (it == live.end() || it->second != e.first)
+            return false;
+        priorities.pop();
+        live.erase(it);
+        return true;
+    }
+
+    void clear()
+    {
+        priorities = priority_queue<long long>();
+        live.clear();
+    }
+};
+
+template <typename Engine>
+struct HasInsertBatch : std::false_type
+{
+};
+
+template <unsigned int Arity>
+struct HasInsertBatch<DaryHeap<Arity>> : std::true_type
+{
+};
+
+template <unsigned int Arity>
+struct HasInsertBatch<SoaDaryHeap<Arity>> : std::true_type
+{
+};
+
+template <typename Engine>
+struct IsMonotone : std::false_type
+{
+};
+
+template <>
+struct IsMonotone<RadixHeap> : std::true_type
+{
+};
+
+template <typename Heap, typename InputIt>
+void insertRange(Heap &heap, InputIt first, InputIt last, std::true_type)
+{
+    heap.insertBatch(first, last);
+}
+
+template <typename Heap, typename InputIt>
+void insertRange(Heap &heap, InputIt first, InputIt last, std::false_type)
+{
+    for (; first != last; ++first)
+        heap.insert(first->first, first->second);
+}
+
+/**
+ * @brief Secuencia de operaciones al azar sobre HeapTree<long long, string, Engine> y el modelo.
+ * @return false en la primera diferencia.
+ */
+template <typename Engine>
+bool randomOps(unsigned int seed, int steps)
+{
+    typedef HeapTree<long long, string, Engine> Heap;
+    mt19937 rng(seed);
+    unsigned int nextValue = 0;
+    // RadixHeap solo acepta prioridades que no superan el último máximo visto
+    long long ceiling = IsMonotone<Engine>::value ? 1000000000LL : LLONG_MAX;
+
+    auto randomPriority = [&]() -> long long {
+        if (IsMonotone<Engine>::value)
+            return ceiling - static_cast<long long>(rng() % 1000);
+        return static_cast<long long>(rng() % 500) - 250; // muchos empates
+    };
+    auto randomItems = [&](unsigned int n) {
+        vector<pair<long long, string>> items;
+        for (unsigned int i = 0; i < n; i++)
+            items.emplace_back(randomPriority(), "v" + to_string(nextValue++));
+        return items;
+    };
+
+    vector<pair<long long, string>> initial = randomItems(rng() % 50);
+    Heap heap(initial.begin(), initial.end());
+    Model model;
+    for (auto &e : initial)
+        model.insert(e.first, e.second);
+
+    for (int step = 0; step < steps; step++)
+    {
+        unsigned int op = rng() % 20;
+        if (op < 8)
+        {
+            auto e = randomItems(1)[0];
+            heap.insert(e.first, e.second);
+            model.insert(e.first, e.second);
+        }
+        else if (op < 13)
+        {
+            if (model.live.empty())
+                continue;
+            auto e = heap.extractMax();
+            if (!model.extract(e))
+                return false;
+            ceiling = e.first;
+        }
+        else if (op == 13)
+        {
+            if (model.live.empty())
+                continue;
+            long long top = heap.max().first;
+            if (top != model.priorities.top() || model.live.at(heap.max().second) != top)
+                return false;
+            ceiling = top;
+        }
+        else if (op == 14 || op == 15)
+        {
+            vector<pair<long long, string>> items = randomItems(rng() % 40);
+            Heap other(items.begin(), items.end());
+            for (auto &e : items)
+                model.insert(e.first, e.second);
+            if (op == 14)
+            {
+                heap.merge(std::move(other));
+                if (!other.isEmpty())
+                    return false;
+            }
+            else
+            {
+                heap.merge(static_cast<const Heap &>(other));
+                if (other.size() != items.size())
+                    return false;
+            }
+        }
+        else if (op == 16)
+        {
+            vector<pair<long long, string>> items = randomItems(rng() % (min(heap.size(), 100u) * 2 + 2)); // a veces más grande que el heap (Floyd)
+            insertRange(heap, items.begin(), items.end(), HasInsertBatch<Engine>());
+            for (auto &e : items)
+                model.insert(e.first, e.second);
+        }
+        else if (op == 17 || op == 18)
+        {
+            unsigned int k = rng() % 10;
+            vector<pair<long long, string>> top = heap.extractTopK(k);
+            if (top.size() != min<size_t>(k, model.live.size()))
+                return false;
+            for (auto &e : top)
+            {
+                if (!model.extract(e))
+                    return false;
+                ceiling = e.first;
+            }
+        }
+        else if (rng() % 10 == 0)
+        {
+            heap.clear();
+            model.clear();
+        }
+
+        if (heap.size() != model.live.size() || heap.isEmpty() != model.live.empty())
+            return false;
+    }
+
+    // Vaciar el heap: debe salir en orden no creciente
+    while (!heap.isEmpty())
+    {
+        if (!model.extract(heap.extractMax()))
+            return false;
+    }
+    return model.live.empty();
+}
+
+/**
+ * @brief Dijkstra con IndexedHeapTree (increaseKey sobre distancias negadas) y con priority_queue perezoso.
+ */
+bool dijkstraMatches(unsigned int seed)
+{
+    mt19937 rng(seed);
+    const unsigned int n = 300;
+    vector<vector<pair<unsigned int, long long>>> graph(n);
+    for (unsigned int e = 0; e < n * 6; e++)
+        graph[rng() % n].push_back({rng() % n, static_cast<long long>(rng() % 100)});
+
+    const long long INF = LLONG_MAX;
+
+    // Referencia: priority_queue con entradas duplicadas que se descartan al salir
+    vector<long long> expected(n, INF);
+    priority_queue<pair<long long, unsigned int>, vector<pair<long long, unsigned int>>,
+                   greater<pair<long long, unsigned int>>>
+        pq;
+    expected[0] = 0;
+    pq.push({0, 0});
+    while (!pq.empty())
+    {
+        auto top = pq.top();
+        pq.pop();
+        if (top.first != expected[top.second])
+            continue;
+        for (auto &edge : graph[top.second])
+        {
+            if (top.first + edge.second < expected[edge.first])
+            {
+                expected[edge.first] = top.first + edge.second;
+                pq.push({expected[edge.first], edge.first});
+            }
+        }
+    }
+
+    // Heap indexado: un elemento por vértice, sin duplicados
+    typedef IndexedHeapTree<long long, unsigned int> Heap;
+    Heap heap;
+    vector<long long> dist(n, INF);
+    vector<Heap::Handle> handle(n);
+    vector<bool> queued(n, false);
+    dist[0] = 0;
+    handle[0] = heap.insert(0, 0);
+    queued[0] = true;
+    unsigned int maxSize = 0;
+    while (!heap.isEmpty())
+    {
+        maxSize = max(maxSize, heap.size());
+        auto top = heap.extractMax();
+        unsigned int u = top.second;
+        if (-top.first != dist[u] || heap.contains(handle[u]))
+            return false;
+        for (auto &edge : graph[u])
+        {
+            unsigned int v = edge.first;
+            long long candidate = dist[u] + edge.second;
+            if (candidate >= dist[v])
+                continue;
+            dist[v] = candidate;
+            if (queued[v] && heap.contains(handle[v]))
+            {
+                heap.increaseKey(handle[v], -candidate);
+            }
+            else
+            {
+                handle[v] = heap.insert(-candidate, v);
+                queued[v] = true;
+            }
+        }
+    }
+    return dist == expected && maxSize <= n;
+}
+
+int main()
+{
+    cout << "\n╔══════════════════════════════════════════════════════════════════╗\n";
+    cout << "║                     PRUEBAS DE HEAPTREE                          ║\n";
+    cout << "╚══════════════════════════════════════════════════════════════════╝\n";
+
+    // ==================== PRUEBA 1: motores contra priority_queue ====================
+    printHeader("PRUEBA 1: Cada motor contra std::priority_queue (operaciones al azar)");
+
+    {
+        bool ok = true;
+        for (unsigned int seed = 1; seed <= 10 && ok; seed++)
+            ok = randomOps<DaryHeap<2>>(seed, 2000);
+        printTest("DaryHeap<2>: insert / extractMax / merge / insertBatch / extractTopK", ok);
+
+        ok = true;
+        for (unsigned int seed = 1; seed <= 10 && ok; seed++)
+            ok = randomOps<DaryHeap<4>>(seed, 2000);
+        printTest("DaryHeap<4>", ok);
+
+        ok = true;
+        for (unsigned int seed = 1; seed <= 10 && ok; seed++)
+            ok = randomOps<DaryHeap<8>>(seed, 2000);
+        printTest("DaryHeap<8>", ok);
+
+        ok = true;
+        for (unsigned int seed = 1; seed <= 10 && ok; seed++)
+            ok = randomOps<PairingHeap>(seed, 2000);
+        printTest("PairingHeap", ok);
+
+        ok = true;
+        for (unsigned int seed = 1; seed <= 10 && ok; seed++)
+            ok = randomOps<RadixHeap>(seed, 2000);
+        printTest("RadixHeap (prioridades monótonas)", ok);
+
+        ok = true;
+        for (unsigned int seed = 1; seed <= 10 && ok; seed++)
+            ok = randomOps<SoaDaryHeap<2>>(seed, 2000) && randomOps<SoaDaryHeap<4>>(seed, 2000);
+        printTest("SoaDaryHeap<2> y SoaDaryHeap<4>", ok);
+    }
+
+    // ==================== PRUEBA 2: casos borde ====================
+    printHeader("PRUEBA 2: Casos borde");
+
+    {
+        HeapTree<int, string> empty;
+        bool threw = false;
+        try
+        {
+            empty.extractMax();
+        }
+        catch (const runtime_error &)
+        {
+            threw = true;
+        }
+        printTest("extractMax en un heap vacío lanza runtime_error", threw);
+        printTest("extractTopK con k mayor que el tamaño", empty.extractTopK(5).empty());
+
+        HeapTree<int, string> self;
+        for (int i = 0; i < 10; i++)
+            self.insert(i, to_string(i));
+        self.merge(static_cast<const HeapTree<int, string> &>(self));
+        self.merge(std::move(self));
+        printTest("merge consigo mismo: copia duplica, movimiento no hace nada", self.size() == 20 && self.max().first == 9);
+
+        HeapTree<int, string, SoaDaryHeap<4>> soaSelf;
+        for (int i = 0; i < 10; i++)
+            soaSelf.insert(i, to_string(i));
+        soaSelf.merge(static_cast<const HeapTree<int, string, SoaDaryHeap<4>> &>(soaSelf));
+        auto top = soaSelf.extractTopK(3);
+        printTest("SoaDaryHeap: merge consigo mismo y extractTopK", soaSelf.size() == 17 && top[0].first == 9 &&
+                                                                        top[1].first == 9 && top[2].first == 8 &&
+                                                                        top[2].second == "8");
+
+        HeapTree<long long, int, RadixHeap> radix;
+        radix.insert(100, 0);
+        radix.extractMax();
+        threw = false;
+        try
+        {
+            radix.insert(101, 1);
+        }
+        catch (const invalid_argument &)
+        {
+            threw = true;
+        }
+        printTest("RadixHeap rechaza una prioridad mayor que el último máximo", threw && radix.isEmpty());
+    }
+
+    // ==================== PRUEBA 3: IndexedHeapTree ====================
+    printHeader("PRUEBA 3: IndexedHeapTree (update / erase / handles viejos)");
+
+    {
+        typedef IndexedHeapTree<long long, unsigned int> Heap;
+        mt19937 rng(99);
+        Heap heap;
+        // Modelo perezoso: priority_queue con (prioridad, id) y la prioridad actual de cada id vivo
+        priority_queue<pair<long long, unsigned int>> pq;
+        map<unsigned int, long long> current;
+        map<unsigned int, Heap::Handle> handles;
+        vector<Heap::Handle> stale;
+        unsigned int nextId = 0;
+        bool ok = true;
+
+        auto modelTop = [&]() -> long long {
+            while (current.count(pq.top().second) == 0 || current[pq.top().second] != pq.top().first)
+                pq.pop();
+            return pq.top().first;
+        };
+        auto forget = [&](unsigned int id) {
+            current.erase(id);
+            stale.push_back(handles[id]);
+            handles.erase(id);
+        };
+        auto randomId = [&]() {
+            auto it = handles.begin();
+            std::advance(it, rng() % handles.size());
+            return it->first;
+        };
+
+        for (int step = 0; step < 20000 && ok; step++)
+        {
+            unsigned int op = rng() % 10;
+            long long p = static_cast<long long>(rng() % 1000);
+            if (op < 3 || handles.empty())
+            {
+                unsigned int id = nextId++;
+                handles[id] = heap.insert(p, id);
+                current[id] = p;
+                pq.push({p, id});
+            }
+            else if (op < 5)
+            {
+                auto e = heap.extractMax();
+                ok = e.first == modelTop() && current.count(e.second) == 1 && current[e.second] == e.first;
+                forget(e.second);
+            }
+            else if (op < 8)
+            {
+                unsigned int id = randomId();
+                if (op == 5 && p >= current[id])
+                    heap.increaseKey(handles[id], p);
+                else if (op == 6 && p <= current[id])
+                    heap.decreaseKey(handles[id], p);
+                else
+                    heap.update(handles[id], p);
+                current[id] = p;
+                pq.push({p, id});
+                ok = heap.priority(handles[id]) == p && heap.value(handles[id]) == id;
+            }
+            else if (op == 8)
+            {
+                unsigned int id = randomId();
+                auto e = heap.erase(handles[id]);
+                ok = e.second == id && e.first == current[id];
+                forget(id);
+            }
+            else if (!stale.empty())
+            {
+                // Un handle viejo no debe ver ni tocar al elemento que reusó su slot
+                Heap::Handle old = stale[rng() % stale.size()];
+                bool threw = false;
+                try
+                {
+                    heap.update(old, p);
+                }
+                catch (const out_of_range &)
+                {
+                    threw = true;
+                }
+                ok = threw && !heap.contains(old);
+            }
+            ok = ok && heap.size() == current.size() && (current.empty() || heap.max().first == modelTop());
+        }
+        printTest("20000 operaciones al azar contra priority_queue con borrado perezoso", ok);
+
+        Heap reuse;
+        Heap::Handle a = reuse.insert(5, 1);
+        reuse.extractMax();
+        Heap::Handle b = reuse.insert(3, 2);
+        printTest("Un slot reusado no revive el handle viejo", a.slot == b.slot && a != b && !reuse.contains(a) &&
+                                                              reuse.contains(b));
+        reuse.clear();
+        Heap::Handle c = reuse.insert(7, 3);
+        printTest("clear() invalida los handles aunque los slots se reusen", !reuse.contains(b) && reuse.contains(c) &&
+                                                                               reuse.maxHandle() == c);
+        bool threw = false;
+        try
+        {
+            reuse.decreaseKey(c, 10);
+        }
+        catch (const invalid_argument &)
+        {
+            threw = true;
+        }
+        printTest("decreaseKey con una prioridad mayor lanza invalid_argument", threw && reuse.priority(c) == 7);
+    }
+
+    {
+        bool ok = true;
+        for (unsigned int seed = 1; seed <= 5 && ok; seed++)
+            ok = dijkstraMatches(seed);
+        printTest("Dijkstra con increaseKey da las mismas distancias que con priority_queue", ok);
+    }
+
+    cout << "\n" << (failures == 0 ? "Todas las pruebas pasaron" : "Hay pruebas que fallaron") << endl;
+    return failures == 0 ? 0 : 1;
+}
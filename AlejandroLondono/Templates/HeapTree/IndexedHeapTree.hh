@@ -0,0 +1,350 @@
+#ifndef INDEXED_HEAP_TREE_HH
+#define INDEXED_HEAP_TREE_HH
+
+#include "DarySift.hh"
+
+#include <iostream>
+#include <vector>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+/*Diferencias con HeapTree:
+
+1. Handles estables
+
+Qué es: insert devuelve un Handle (un entero) que identifica al elemento mientras esté en el heap
+Por qué: Las posiciones cambian en cada sift, así que no sirven para buscar
+un elemento después. Con el handle se puede cambiar su prioridad o borrarlo
+sin reinsertarlo ni dejar duplicados.
+
+2. vector<unsigned int> pos
+
+Qué es: pos[slot del handle] = posición actual del elemento en heap (o NONE si ya salió)
+Por qué: Encontrar el elemento en O(1). Cada vez que un sift mueve un
+elemento se actualiza su entrada en pos.
+
+3. Handles libres con generación
+
+Qué es: Los slots de elementos extraídos o borrados se reutilizan en inserts
+posteriores, y cada reuso incrementa la generación del slot
+Por qué: pos no crece sin límite en un scheduler que inserta y extrae todo el
+tiempo, y un handle viejo (de un elemento que ya salió) no coincide con la
+generación actual: contains devuelve false y update / erase lanzan en vez de
+modificar al elemento que ahora ocupa el slot.*/
+
+/**
+ * @brief d-ary max-heap whose elements can be updated or erased through stable handles.
+ *
+ * Same layout and hole-based sifts as HeapTree, plus a handle -> position
+ * table. Since it is a max-heap, increaseKey moves an element towards the
+ * root and decreaseKey moves it towards the leaves. For a min-priority
+ * scheduler (e.g. Dijkstra) store negated priorities or a reversed key type.
+ *
+ * @tparam Priority Type of the priorities (must support operator<).
+ * @tparam Value Type of the values stored with each priority.
+ * @tparam Arity Number of children per node.
+ */
+template <typename Priority, typename Value, unsigned int Arity = 4>
+class IndexedHeapTree
+{
+    static_assert(Arity >= 2, "IndexedHeapTree needs at least 2 children per node");
+
+public:
+    /**
+     * @brief Stable identifier of an element while it is in the heap.
+     *
+     * Slots are reused after an element leaves the heap; the generation tells
+     * a stale handle apart from the one of the element that reused its slot.
+     */
+    struct Handle
+    {
+        unsigned int slot;       ///< Index in pos.
+        unsigned int generation; ///< Value of gen[slot] when the handle was issued.
+
+        bool operator==(const Handle &other) const { return slot == other.slot && generation == other.generation; }
+        bool operator!=(const Handle &other) const { return !(*this == other); }
+    };
+
+private:
+    static constexpr unsigned int NONE = static_cast<unsigned int>(-1); ///< pos value of a free slot.
+
+    /**
+     * @brief Element of the heap with the slot of the handle that identifies it.
+     */
+    struct Entry
+    {
+        Priority priority;
+        Value value;
+        unsigned int slot;
+    };
+
+    vector<Entry> heap;             ///< Elements in level order.
+    vector<unsigned int> pos;       ///< pos[slot] = index in heap, or NONE.
+    vector<unsigned int> gen;       ///< gen[slot] = generation of the slot, bumped when its element leaves.
+    vector<unsigned int> freeSlots; ///< Slots available for reuse.
+
+    typedef DarySift<Arity> Sift;
+
+    static bool lessPriority(const Entry &a, const Entry &b) { return a.priority < b.priority; }
+
+    /**
+     * @brief Write an entry at position i and record its new position.
+     */
+    void place(unsigned int i, Entry &&e)
+    {
+        pos[e.slot] = i;
+        heap[i] = std::move(e);
+    }
+
+    /**
+     * @brief Move the element at i up until its parent is not smaller.
+     * @param i Position of the element.
+     */
+    void heapifyUp(unsigned int i)
+    {
+        Sift::up(heap, i, lessPriority, [this](unsigned int j, Entry &&e) { place(j, std::move(e)); });
+    }
+
+    /**
+     * @brief Move the element at i down until no child is greater.
+     * @param i Position of the element.
+     */
+    void heapifyDown(unsigned int i)
+    {
+        Sift::down(heap, i, lessPriority, [this](unsigned int j, Entry &&e) { place(j, std::move(e)); });
+    }
+
+    /**
+     * @brief Position of a live handle.
+     * @throws std::out_of_range if the handle is not in the heap.
+     */
+    unsigned int positionOf(Handle h) const
+    {
+        if (!contains(h))
+            throw out_of_range("Handle is not in the heap");
+        return pos[h.slot];
+    }
+
+    /**
+     * @brief Mark a slot as free; handles issued for it become stale.
+     */
+    void releaseSlot(unsigned int slot)
+    {
+        pos[slot] = NONE;
+        gen[slot]++;
+        freeSlots.push_back(slot);
+    }
+
+    /**
+     * @brief Remove the element at position i and free its handle.
+     * @return The removed entry.
+     */
+    Entry removeAt(unsigned int i)
+    {
+        Entry removed = std::move(heap[i]);
+        releaseSlot(removed.slot);
+
+        unsigned int lastIdx = heap.size() - 1;
+        if (i != lastIdx)
+        {
+            // El último ocupa el hueco y puede tener que subir o bajar
+            place(i, std::move(heap[lastIdx]));
+            heap.pop_back();
+            if (i > 0 && heap[Sift::parent(i)].priority < heap[i].priority)
+                heapifyUp(i);
+            else
+                heapifyDown(i);
+        }
+        else
+        {
+            heap.pop_back();
+        }
+        return removed;
+    }
+
+public:
+    IndexedHeapTree() {}
+
+    /**
+     * @brief Insert a value with the given priority.
+     * @param p Priority of the value.
+     * @param v Value to insert.
+     * @return Handle to refer to the element until it leaves the heap.
+     */
+    Handle insert(const Priority &p, const Value &v)
+    {
+        unsigned int slot;
+        if (!freeSlots.empty())
+        {
+            slot = freeSlots.back();
+            freeSlots.pop_back();
+        }
+        else
+        {
+            slot = pos.size();
+            pos.push_back(NONE);
+            gen.push_back(0);
+        }
+        heap.push_back(Entry{p, v, slot});
+        pos[slot] = heap.size() - 1;
+        heapifyUp(heap.size() - 1);
+        return Handle{slot, gen[slot]};
+    }
+
+    /**
+     * @brief Get the element with the greatest priority without removing it.
+     * @return The (priority, value) pair at the root.
+     * @throws std::runtime_error if the heap is empty.
+     */
+    pair<Priority, Value> max() const
+    {
+        if (heap.empty())
+            throw runtime_error("HeapTree is empty");
+        return {heap[0].priority, heap[0].value};
+    }
+
+    /**
+     * @brief Handle of the element with the greatest priority.
+     * @throws std::runtime_error if the heap is empty.
+     */
+    Handle maxHandle() const
+    {
+        if (heap.empty())
+            throw runtime_error("HeapTree is empty");
+        return Handle{heap[0].slot, gen[heap[0].slot]};
+    }
+
+    /**
+     * @brief Remove and return the element with the greatest priority. Its handle becomes invalid.
+     * @return The (priority, value) pair that was at the root.
+     * @throws std::runtime_error if the heap is empty.
+     */
+    pair<Priority, Value> extractMax()
+    {
+        if (heap.empty())
+            throw runtime_error("HeapTree is empty");
+        Entry e = removeAt(0);
+        return {std::move(e.priority), std::move(e.value)};
+    }
+
+    /**
+     * @brief Raise the priority of an element (moves it towards the root).
+     * @param h Handle of the element.
+     * @param p New priority, not smaller than the current one.
+     * @throws std::out_of_range if the handle is not in the heap.
+     * @throws std::invalid_argument if p is smaller than the current priority.
+     */
+    void increaseKey(Handle h, const Priority &p)
+    {
+        unsigned int i = positionOf(h);
+        if (p < heap[i].priority)
+            throw invalid_argument("increaseKey: new priority is smaller than the current one");
+        heap[i].priority = p;
+        heapifyUp(i);
+    }
+
+    /**
+     * @brief Lower the priority of an element (moves it towards the leaves).
+     * @param h Handle of the element.
+     * @param p New priority, not greater than the current one.
+     * @throws std::out_of_range if the handle is not in the heap.
+     * @throws std::invalid_argument if p is greater than the current priority.
+     */
+    void decreaseKey(Handle h, const Priority &p)
+    {
+        unsigned int i = positionOf(h);
+        if (heap[i].priority < p)
+            throw invalid_argument("decreaseKey: new priority is greater than the current one");
+        heap[i].priority = p;
+        heapifyDown(i);
+    }
+
+    /**
+     * @brief Change the priority of an element in either direction.
+     * @param h Handle of the element.
+     * @param p New priority.
+     * @throws std::out_of_range if the handle is not in the heap.
+     */
+    void update(Handle h, const Priority &p)
+    {
+        unsigned int i = positionOf(h);
+        bool up = heap[i].priority < p;
+        heap[i].priority = p;
+        if (up)
+            heapifyUp(i);
+        else
+            heapifyDown(i);
+    }
+
+    /**
+     * @brief Remove an element from anywhere in the heap. Its handle becomes invalid.
+     * @param h Handle of the element.
+     * @return The removed (priority, value) pair.
+     * @throws std::out_of_range if the handle is not in the heap.
+     */
+    pair<Priority, Value> erase(Handle h)
+    {
+        Entry e = removeAt(positionOf(h));
+        return {std::move(e.priority), std::move(e.value)};
+    }
+
+    /**
+     * @brief Check if a handle refers to an element currently in the heap.
+     * @return false for handles of elements that were extracted or erased, even if their slot was reused.
+     */
+    bool contains(Handle h) const
+    {
+        return h.slot < pos.size() && pos[h.slot] != NONE && gen[h.slot] == h.generation;
+    }
+
+    /**
+     * @brief Priority of an element.
+     * @throws std::out_of_range if the handle is not in the heap.
+     */
+    const Priority &priority(Handle h) const
+    {
+        return heap[positionOf(h)].priority;
+    }
+
+    /**
+     * @brief Value of an element.
+     * @throws std::out_of_range if the handle is not in the heap.
+     */
+    Value &value(Handle h)
+    {
+        return heap[positionOf(h)].value;
+    }
+
+    /**
+     * @brief Value of an element (const version).
+     * @throws std::out_of_range if the handle is not in the heap.
+     */
+    const Value &value(Handle h) const
+    {
+        return heap[positionOf(h)].value;
+    }
+
+    unsigned int size() const { return heap.size(); }
+    bool isEmpty() const { return heap.empty(); }
+
+    /**
+     * @brief Remove all elements. Every handle becomes invalid.
+     */
+    void clear()
+    {
+        for (const Entry &e : heap)
+            releaseSlot(e.slot);
+        heap.clear();
+    }
+
+    void printHeap() const
+    {
+        for (auto &e : heap)
+            cout << "(" << e.priority << ", " << e.value << ") ";
+        cout << "\n";
+    }
+};
+
+#endif
@@ -0,0 +1,296 @@
+#ifndef PAIRING_HEAP_HH
+#define PAIRING_HEAP_HH
+
+#include <iostream>
+#include <vector>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+/*1. Árbol con hijos enlazados (child / sibling)
+
+Qué es: Cada nodo apunta a su primer hijo y a su siguiente hermano
+Por qué: Un nodo puede tener cualquier cantidad de hijos y agregar uno es
+enlazarlo al frente de la lista, en O(1).
+
+2. meld
+
+Qué es: Unir dos árboles: el de menor prioridad pasa a ser el primer hijo del otro
+Por qué: insert y merge son solo un meld, así que cuestan O(1) sin importar
+el tamaño de los heaps. Es lo que conviene cuando se unen heaps seguido.
+
+3. extractMax en dos pasadas
+
+Qué es: Los hijos de la raíz se unen de a pares de izquierda a derecha, y
+luego los resultados de derecha a izquierda
+Por qué: Es lo que le da a extractMax su costo amortizado O(log n). Se hace
+con un vector auxiliar en vez de recursión para no depender de la
+profundidad de la pila.*/
+
+/**
+ * @brief Max pairing heap of (priority, value) pairs.
+ *
+ * Engine of HeapTree for meld-heavy workloads (see PairingHeap below):
+ * insert and merge are O(1), extractMax is O(log n) amortized.
+ *
+ * @tparam Priority Type of the priorities (must support operator<).
+ * @tparam Value Type of the values stored with each priority.
+ */
+template <typename Priority, typename Value>
+class PairingHeapEngine
+{
+private:
+    /**
+     * @brief Node of the heap.
+     */
+    struct Node
+    {
+        pair<Priority, Value> elem; ///< Priority and value.
+        Node *child;                ///< First child.
+        Node *sibling;              ///< Next sibling in the parent's list of children.
+
+        Node(const Priority &p, const Value &v) : elem(p, v), child(nullptr), sibling(nullptr) {}
+    };
+
+    Node *root;              ///< Node with the greatest priority.
+    unsigned int sz;         ///< Number of elements.
+    vector<Node *> scratch;  ///< Buffer reused by extractMax and the tree walks.
+
+    /**
+     * @brief Join two trees; the root with the smaller priority becomes a child of the other.
+     * @return Root of the resulting tree.
+     */
+    static Node *meld(Node *a, Node *b)
+    {
+        if (a == nullptr)
+            return b;
+        if (b == nullptr)
+            return a;
+        if (a->elem.first < b->elem.first)
+            swap(a, b);
+        b->sibling = a->child;
+        a->child = b;
+        return a;
+    }
+
+    /**
+     * @brief Two-pass pairing of a list of siblings.
+     * @param first First node of the list.
+     * @return Root of the single resulting tree.
+     */
+    Node *mergePairs(Node *first)
+    {
+        scratch.clear();
+        // Primera pasada: unir de a pares, de izquierda a derecha
+        while (first != nullptr)
+        {
+            Node *a = first;
+            Node *b = a->sibling;
+            first = (b != nullptr) ? b->sibling : nullptr;
+            a->sibling = nullptr;
+            if (b != nullptr)
+                b->sibling = nullptr;
+            scratch.push_back(meld(a, b));
+        }
+        // Segunda pasada: unir los resultados de derecha a izquierda
+        Node *result = nullptr;
+        for (unsigned int i = scratch.size(); i-- > 0;)
+            result = meld(scratch[i], result);
+        return result;
+    }
+
+    /**
+     * @brief Collect every node of the tree into scratch (preorder, without recursion).
+     */
+    void collectNodes(Node *start)
+    {
+        scratch.clear();
+        if (start == nullptr)
+            return;
+        scratch.push_back(start);
+        for (unsigned int i = 0; i < scratch.size(); i++)
+        {
+            for (Node *c = scratch[i]->child; c != nullptr; c = c->sibling)
+                scratch.push_back(c);
+        }
+    }
+
+    /**
+     * @brief Free every node of the tree.
+     */
+    void destroy()
+    {
+        collectNodes(root);
+        for (Node *n : scratch)
+            delete n;
+        scratch.clear();
+        root = nullptr;
+        sz = 0;
+    }
+
+    /**
+     * @brief Insert copies of every element of another heap.
+     */
+    void copyFrom(const PairingHeapEngine &other)
+    {
+        // other.scratch no se puede usar porque other es const
+        vector<Node *> pending;
+        if (other.root != nullptr)
+            pending.push_back(other.root);
+        while (!pending.empty())
+        {
+            Node *n = pending.back();
+            pending.pop_back();
+            insert(n->elem.first, n->elem.second);
+            for (Node *c = n->child; c != nullptr; c = c->sibling)
+                pending.push_back(c);
+        }
+    }
+
+public:
+    PairingHeapEngine() : root(nullptr), sz(0) {}
+
+    /**
+     * @brief Build a heap from a range of (priority, value) pairs in O(n).
+     */
+    template <typename InputIt>
+    PairingHeapEngine(InputIt first, InputIt last) : root(nullptr), sz(0)
+    {
+        for (; first != last; ++first)
+            insert(first->first, first->second);
+    }
+
+    PairingHeapEngine(const PairingHeapEngine &other) : root(nullptr), sz(0)
+    {
+        copyFrom(other);
+    }
+
+    PairingHeapEngine(PairingHeapEngine &&other) noexcept : root(other.root), sz(other.sz)
+    {
+        other.root = nullptr;
+        other.sz = 0;
+    }
+
+    PairingHeapEngine &operator=(const PairingHeapEngine &other)
+    {
+        if (this != &other)
+        {
+            destroy();
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    PairingHeapEngine &operator=(PairingHeapEngine &&other) noexcept
+    {
+        if (this != &other)
+        {
+            destroy();
+            root = other.root;
+            sz = other.sz;
+            other.root = nullptr;
+            other.sz = 0;
+        }
+        return *this;
+    }
+
+    ~PairingHeapEngine()
+    {
+        destroy();
+    }
+
+    /**
+     * @brief Insert a value with the given priority in O(1).
+     * @param p Priority of the value.
+     * @param v Value to insert.
+     */
+    void insert(const Priority &p, const Value &v)
+    {
+        root = meld(root, new Node(p, v));
+        sz++;
+    }
+
+    /**
+     * @brief Move all the elements of another heap into this one in O(1).
+     * @param other Heap to merge; it is left empty.
+     */
+    void merge(PairingHeapEngine &&other)
+    {
+        if (this == &other)
+            return;
+        root = meld(root, other.root);
+        sz += other.sz;
+        other.root = nullptr;
+        other.sz = 0;
+    }
+
+    /**
+     * @brief Copy all the elements of another heap into this one.
+     * @param other Heap to merge; it is not modified.
+     */
+    void merge(const PairingHeapEngine &other)
+    {
+        PairingHeapEngine copy(other);
+        merge(std::move(copy));
+    }
+
+    /**
+     * @brief Get the element with the greatest priority without removing it.
+     * @throws std::runtime_error if the heap is empty.
+     */
+    const pair<Priority, Value> &max() const
+    {
+        if (root == nullptr)
+            throw runtime_error("HeapTree is empty");
+        return root->elem;
+    }
+
+    /**
+     * @brief Remove and return the element with the greatest priority.
+     * @throws std::runtime_error if the heap is empty.
+     */
+    pair<Priority, Value> extractMax()
+    {
+        if (root == nullptr)
+            throw runtime_error("HeapTree is empty");
+
+        Node *old = root;
+        pair<Priority, Value> maxElem = std::move(old->elem);
+        root = mergePairs(old->child);
+        delete old;
+        sz--;
+        return maxElem;
+    }
+
+    unsigned int size() const { return sz; }
+    bool isEmpty() const { return sz == 0; }
+    void clear() { destroy(); }
+
+    void printHeap() const
+    {
+        vector<Node *> pending;
+        if (root != nullptr)
+            pending.push_back(root);
+        while (!pending.empty())
+        {
+            Node *n = pending.back();
+            pending.pop_back();
+            cout << "(" << n->elem.first << ", " << n->elem.second << ") ";
+            for (Node *c = n->child; c != nullptr; c = c->sibling)
+                pending.push_back(c);
+        }
+        cout << "\n";
+    }
+};
+
+/**
+ * @brief HeapTree policy that selects a PairingHeapEngine.
+ */
+struct PairingHeap
+{
+    template <typename Priority, typename Value>
+    using Heap = PairingHeapEngine<Priority, Value>;
+};
+
+#endif
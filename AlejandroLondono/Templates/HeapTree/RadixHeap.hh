@@ -0,0 +1,248 @@
+#ifndef RADIX_HEAP_HH
+#define RADIX_HEAP_HH
+
+#include <iostream>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+/*1. Heap monótono
+
+Qué es: Nunca se inserta una prioridad mayor que el último máximo visto con max o extractMax (last)
+Por qué: Es el caso de timestamps o distancias que se procesan en orden. Con
+esa garantía no hace falta un árbol: alcanza con agrupar los elementos según
+qué tan lejos están de last.
+
+2. Buckets por bit más alto distinto de last
+
+Qué es: buckets[0] tiene los elementos con prioridad == last; buckets[i]
+(i >= 1) los que difieren de last por primera vez en el bit i - 1
+Por qué: insert es O(1): calcular el bucket y hacer push_back.
+
+3. Redistribución al vaciarse buckets[0]
+
+Qué es: Se toma el primer bucket no vacío, su máximo pasa a ser last, y sus
+elementos se reparten en buckets más bajos
+Por qué: Cada elemento solo baja de bucket, así que se mueve a lo sumo una
+vez por bit: extractMax cuesta O(log C) amortizado (C = rango de prioridades)
+y no depende de n.*/
+
+/**
+ * @brief Monotone max radix heap of (priority, value) pairs.
+ *
+ * Engine of HeapTree for monotone workloads (see RadixHeap below): every
+ * inserted priority must be <= the last maximum returned by max() or
+ * extractMax(). Priorities must be integers.
+ *
+ * @tparam Priority Integral type of the priorities.
+ * @tparam Value Type of the values stored with each priority.
+ */
+template <typename Priority, typename Value>
+class RadixHeapEngine
+{
+    static_assert(is_integral<Priority>::value, "RadixHeapEngine needs integral priorities");
+
+private:
+    typedef typename make_unsigned<Priority>::type Key; ///< Priority mapped to an unsigned key that keeps the order.
+
+    static const unsigned int BITS = numeric_limits<Key>::digits; ///< Bits of a key.
+
+    // buckets y last son mutable porque max() puede tener que redistribuir
+    mutable vector<pair<Priority, Value>> buckets[BITS + 1]; ///< Elements grouped by distance to last.
+    mutable Key last;                                         ///< Key of the last maximum seen (upper bound for inserts).
+    unsigned int sz;                                          ///< Number of elements.
+
+    /**
+     * @brief Map a priority to an unsigned key with the same order.
+     */
+    static Key toKey(const Priority &p)
+    {
+        // Con signo: invertir el bit de signo para que los negativos queden abajo
+        if (is_signed<Priority>::value)
+            return static_cast<Key>(p) ^ (Key(1) << (BITS - 1));
+        return static_cast<Key>(p);
+    }
+
+    /**
+     * @brief Number of significant bits of x (0 for x == 0).
+     */
+    static unsigned int bitLength(Key x)
+    {
+        unsigned int n = 0;
+        while (x >= 256)
+        {
+            x >>= 8;
+            n += 8;
+        }
+        while (x != 0)
+        {
+            x >>= 1;
+            n++;
+        }
+        return n;
+    }
+
+    /**
+     * @brief Bucket of a key relative to last.
+     */
+    unsigned int bucketOf(Key k) const
+    {
+        return bitLength(k ^ last);
+    }
+
+    /**
+     * @brief Make sure buckets[0] holds the maximum, redistributing the first non-empty bucket.
+     */
+    void refill() const
+    {
+        if (!buckets[0].empty())
+            return;
+
+        unsigned int i = 1;
+        while (buckets[i].empty())
+            i++;
+
+        // El máximo del bucket pasa a ser el nuevo last
+        Key newLast = toKey(buckets[i][0].first);
+        for (const auto &e : buckets[i])
+        {
+            Key k = toKey(e.first);
+            if (newLast < k)
+                newLast = k;
+        }
+        last = newLast;
+
+        for (auto &e : buckets[i])
+            buckets[bitLength(toKey(e.first) ^ last)].push_back(std::move(e));
+        buckets[i].clear();
+    }
+
+public:
+    RadixHeapEngine() : last(numeric_limits<Key>::max()), sz(0) {}
+
+    /**
+     * @brief Build a heap from a range of (priority, value) pairs in O(n).
+     */
+    template <typename InputIt>
+    RadixHeapEngine(InputIt first, InputIt end) : RadixHeapEngine()
+    {
+        for (; first != end; ++first)
+            insert(first->first, first->second);
+    }
+
+    /**
+     * @brief Insert a value with the given priority in O(1).
+     * @param p Priority of the value; must not exceed the last maximum seen.
+     * @param v Value to insert.
+     * @throws std::invalid_argument if p is greater than the last maximum seen.
+     */
+    void insert(const Priority &p, const Value &v)
+    {
+        Key k = toKey(p);
+        if (last < k)
+            throw invalid_argument("RadixHeap: priority is greater than the last maximum seen");
+        buckets[bucketOf(k)].emplace_back(p, v);
+        sz++;
+    }
+
+    /**
+     * @brief Move all the elements of another heap into this one.
+     * @param other Heap to merge; it is left empty.
+     * @throws std::invalid_argument if other has a priority greater than the last maximum seen of this heap.
+     */
+    void merge(RadixHeapEngine &&other)
+    {
+        if (this == &other)
+            return;
+        merge(static_cast<const RadixHeapEngine &>(other));
+        other.clear();
+    }
+
+    /**
+     * @brief Copy all the elements of another heap into this one.
+     * @param other Heap to merge; it is not modified.
+     * @throws std::invalid_argument if other has a priority greater than the last maximum seen of this heap.
+     */
+    void merge(const RadixHeapEngine &other)
+    {
+        if (this == &other)
+        {
+            RadixHeapEngine copy(other);
+            merge(copy);
+            return;
+        }
+        if (other.sz > 0 && last < toKey(other.max().first))
+            throw invalid_argument("RadixHeap: priority is greater than the last maximum seen");
+        for (unsigned int b = 0; b <= BITS; b++)
+        {
+            for (const auto &e : other.buckets[b])
+                insert(e.first, e.second);
+        }
+    }
+
+    /**
+     * @brief Get the element with the greatest priority without removing it.
+     * @throws std::runtime_error if the heap is empty.
+     */
+    const pair<Priority, Value> &max() const
+    {
+        if (sz == 0)
+            throw runtime_error("HeapTree is empty");
+        refill();
+        return buckets[0].back();
+    }
+
+    /**
+     * @brief Remove and return the element with the greatest priority.
+     * @throws std::runtime_error if the heap is empty.
+     */
+    pair<Priority, Value> extractMax()
+    {
+        if (sz == 0)
+            throw runtime_error("HeapTree is empty");
+        refill();
+        pair<Priority, Value> maxElem = std::move(buckets[0].back());
+        buckets[0].pop_back();
+        sz--;
+        return maxElem;
+    }
+
+    unsigned int size() const { return sz; }
+    bool isEmpty() const { return sz == 0; }
+
+    /**
+     * @brief Remove all elements. The monotone bound is reset, so any priority can be inserted again.
+     */
+    void clear()
+    {
+        for (unsigned int b = 0; b <= BITS; b++)
+            buckets[b].clear();
+        last = numeric_limits<Key>::max();
+        sz = 0;
+    }
+
+    void printHeap() const
+    {
+        for (unsigned int b = 0; b <= BITS; b++)
+        {
+            for (const auto &e : buckets[b])
+                cout << "(" << e.first << ", " << e.second << ") ";
+        }
+        cout << "\n";
+    }
+};
+
+/**
+ * @brief HeapTree policy that selects a RadixHeapEngine (monotone, integral priorities).
+ */
+struct RadixHeap
+{
+    template <typename Priority, typename Value>
+    using Heap = RadixHeapEngine<Priority, Value>;
+};
+
+#endif
@@ -0,0 +1,331 @@
+#ifndef SOA_HEAP_TREE_HH
+#define SOA_HEAP_TREE_HH
+
+#include "DarySift.hh"
+
+#include <iostream>
+#include <vector>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+/*Diferencias con HeapTree:
+
+1. vector<Key> heap (prioridad + índice)
+
+Qué es: El heap guarda solo la prioridad y el número de slot donde está el valor
+Por qué: Los sifts comparan y mueven prioridades. Si el valor viaja con la
+prioridad (pair<Priority, Value>), un string largo se mueve en cada nivel y
+ocupa caché que la comparación no usa. Con int + unsigned int cada Key son
+8 bytes, así que un heap de 10M elementos ocupa 80 MB en vez de 400 MB o más.
+
+2. vector<Value> payloads
+
+Qué es: Arreglo aparte con los valores; un valor no se mueve mientras está en el heap
+Por qué: Solo se toca al insertar y al extraer.
+
+3. vector<unsigned int> freeSlots
+
+Qué es: Slots de payloads que quedaron libres después de un extractMax
+Por qué: Reutilizarlos en el siguiente insert en vez de hacer crecer payloads.
+
+4. Motor de HeapTree
+
+Qué es: SoaDaryHeap<d> es una política más para HeapTree, igual que DaryHeap<d>
+Por qué: HeapTree<int, string, SoaDaryHeap<4>> tiene la misma interfaz
+(insertBatch, merge, extractTopK) que los otros motores. SoaHeapTree<P, V>
+queda como nombre corto del motor solo.*/
+
+/**
+ * @brief Max-heap that keeps priorities and values in separate arrays (structure of arrays).
+ *
+ * Engine of HeapTree (see SoaDaryHeap below) with the same d-ary layout and
+ * hole-based sifts as DaryHeapEngine, but the heap only holds (priority, slot)
+ * keys. Values live in a side array and are looked up by slot, so sifts never
+ * move a value. Since no pair is stored, max() returns a copy; maxPriority()
+ * and maxValue() return references.
+ *
+ * @tparam Priority Type of the priorities (must support operator<).
+ * @tparam Value Type of the values stored with each priority.
+ * @tparam Arity Number of children per node.
+ */
+template <typename Priority, typename Value, unsigned int Arity = 4>
+class SoaHeapEngine
+{
+    static_assert(Arity >= 2, "SoaHeapEngine needs at least 2 children per node");
+
+private:
+    /**
+     * @brief Element of the heap: a priority and the slot of its value.
+     */
+    struct Key
+    {
+        Priority priority;
+        unsigned int slot;
+    };
+
+    vector<Key> heap;               ///< Keys in level order.
+    vector<Value> payloads;         ///< Values, indexed by Key::slot.
+    vector<unsigned int> freeSlots; ///< Slots of payloads that are not in use.
+
+    typedef DarySift<Arity> Sift;
+
+    static bool lessPriority(const Key &a, const Key &b) { return a.priority < b.priority; }
+
+    /**
+     * @brief Move the key at i up until its parent is not smaller.
+     * @param i Position of the key.
+     */
+    void heapifyUp(unsigned int i)
+    {
+        Sift::up(heap, i, lessPriority, [this](unsigned int j, Key &&k) { heap[j] = std::move(k); });
+    }
+
+    /**
+     * @brief Move the key at i down until no child is greater.
+     * @param i Position of the key.
+     */
+    void heapifyDown(unsigned int i)
+    {
+        Sift::down(heap, i, lessPriority, [this](unsigned int j, Key &&k) { heap[j] = std::move(k); });
+    }
+
+    /**
+     * @brief Store a value in a free slot (or a new one).
+     * @return Slot where the value was stored.
+     */
+    template <typename V>
+    unsigned int storePayload(V &&v)
+    {
+        if (!freeSlots.empty())
+        {
+            unsigned int slot = freeSlots.back();
+            freeSlots.pop_back();
+            payloads[slot] = std::forward<V>(v);
+            return slot;
+        }
+        payloads.push_back(std::forward<V>(v));
+        return payloads.size() - 1;
+    }
+
+    /**
+     * @brief Restore the heap after appending the keys from position oldSize on.
+     * @param oldSize Number of keys that already formed a heap.
+     * @note Same rule as DaryHeapEngine: Floyd's heapify when the batch is at least as large as the heap.
+     */
+    void fixAppended(unsigned int oldSize)
+    {
+        if (heap.size() - oldSize >= oldSize)
+        {
+            if (heap.size() < 2)
+                return;
+            for (unsigned int i = Sift::parent(heap.size() - 1) + 1; i-- > 0;)
+                heapifyDown(i);
+        }
+        else
+        {
+            for (unsigned int i = oldSize; i < heap.size(); i++)
+                heapifyUp(i);
+        }
+    }
+
+public:
+    SoaHeapEngine() {}
+
+    /**
+     * @brief Build a heap from a range of (priority, value) pairs in O(n).
+     * @param first Iterator to the first pair.
+     * @param last Iterator past the last pair.
+     */
+    template <typename InputIt>
+    SoaHeapEngine(InputIt first, InputIt last)
+    {
+        insertBatch(first, last);
+    }
+
+    /**
+     * @brief Insert a value with the given priority.
+     * @param p Priority of the value.
+     * @param v Value to insert.
+     */
+    void insert(const Priority &p, const Value &v)
+    {
+        unsigned int slot = storePayload(v);
+        heap.push_back(Key{p, slot});
+        heapifyUp(heap.size() - 1);
+    }
+
+    /**
+     * @brief Insert a value with the given priority, moving the value.
+     * @param p Priority of the value.
+     * @param v Value to move into the heap.
+     */
+    void insert(const Priority &p, Value &&v)
+    {
+        unsigned int slot = storePayload(std::move(v));
+        heap.push_back(Key{p, slot});
+        heapifyUp(heap.size() - 1);
+    }
+
+    /**
+     * @brief Insert a range of (priority, value) pairs.
+     * @param first Iterator to the first pair.
+     * @param last Iterator past the last pair.
+     * @note Uses Floyd's heapify when the batch is at least as large as the heap.
+     */
+    template <typename InputIt>
+    void insertBatch(InputIt first, InputIt last)
+    {
+        unsigned int oldSize = heap.size();
+        for (; first != last; ++first)
+        {
+            unsigned int slot = storePayload(first->second);
+            heap.push_back(Key{first->first, slot});
+        }
+        fixAppended(oldSize);
+    }
+
+    /**
+     * @brief Move all the elements of another heap into this one.
+     * @param other Heap to merge; it is left empty.
+     */
+    void merge(SoaHeapEngine &&other)
+    {
+        if (this == &other)
+            return;
+        // Anexar siempre el heap más chico al más grande
+        if (heap.size() < other.heap.size())
+        {
+            heap.swap(other.heap);
+            payloads.swap(other.payloads);
+            freeSlots.swap(other.freeSlots);
+        }
+        unsigned int oldSize = heap.size();
+        for (Key &k : other.heap)
+        {
+            unsigned int slot = storePayload(std::move(other.payloads[k.slot]));
+            heap.push_back(Key{std::move(k.priority), slot});
+        }
+        other.clear();
+        fixAppended(oldSize);
+    }
+
+    /**
+     * @brief Copy all the elements of another heap into this one.
+     * @param other Heap to merge; it is not modified.
+     */
+    void merge(const SoaHeapEngine &other)
+    {
+        vector<pair<Priority, Value>> items;
+        items.reserve(other.heap.size());
+        for (const Key &k : other.heap)
+            items.emplace_back(k.priority, other.payloads[k.slot]);
+        insertBatch(items.begin(), items.end()); // other puede ser *this
+    }
+
+    /**
+     * @brief Get the element with the greatest priority without removing it.
+     * @return Copy of the (priority, value) pair at the root.
+     * @throws std::runtime_error if the heap is empty.
+     */
+    pair<Priority, Value> max() const
+    {
+        return {maxPriority(), maxValue()};
+    }
+
+    /**
+     * @brief Greatest priority in the heap.
+     * @throws std::runtime_error if the heap is empty.
+     */
+    const Priority &maxPriority() const
+    {
+        if (heap.empty())
+            throw runtime_error("HeapTree is empty");
+        return heap[0].priority;
+    }
+
+    /**
+     * @brief Value with the greatest priority.
+     * @throws std::runtime_error if the heap is empty.
+     */
+    const Value &maxValue() const
+    {
+        if (heap.empty())
+            throw runtime_error("HeapTree is empty");
+        return payloads[heap[0].slot];
+    }
+
+    /**
+     * @brief Remove and return the element with the greatest priority.
+     * @return The (priority, value) pair that was at the root.
+     * @throws std::runtime_error if the heap is empty.
+     */
+    pair<Priority, Value> extractMax()
+    {
+        if (heap.empty())
+            throw runtime_error("HeapTree is empty");
+
+        Key top = std::move(heap[0]);
+        pair<Priority, Value> maxElem(std::move(top.priority), std::move(payloads[top.slot]));
+        freeSlots.push_back(top.slot);
+
+        if (heap.size() > 1)
+        {
+            heap[0] = std::move(heap.back());
+            heap.pop_back();
+            heapifyDown(0);
+        }
+        else
+        {
+            heap.pop_back();
+        }
+        return maxElem;
+    }
+
+    /**
+     * @brief Reserve memory for at least n elements.
+     * @param n Number of elements.
+     */
+    void reserve(unsigned int n)
+    {
+        heap.reserve(n);
+        payloads.reserve(n);
+    }
+
+    unsigned int size() const { return heap.size(); }
+    bool isEmpty() const { return heap.empty(); }
+
+    void clear()
+    {
+        heap.clear();
+        payloads.clear();
+        freeSlots.clear();
+    }
+
+    void printHeap() const
+    {
+        for (auto &k : heap)
+            cout << "(" << k.priority << ", " << payloads[k.slot] << ") ";
+        cout << "\n";
+    }
+};
+
+/**
+ * @brief Standalone name for the engine (without HeapTree's extractTopK).
+ */
+template <typename Priority, typename Value, unsigned int Arity = 4>
+using SoaHeapTree = SoaHeapEngine<Priority, Value, Arity>;
+
+/**
+ * @brief HeapTree policy that selects a SoaHeapEngine with the given arity.
+ * @tparam Arity Number of children per node.
+ */
+template <unsigned int Arity>
+struct SoaDaryHeap
+{
+    template <typename Priority, typename Value>
+    using Heap = SoaHeapEngine<Priority, Value, Arity>;
+};
+
+#endif
@@ -0,0 +1,329 @@
+#ifndef MPMC_CIRCULAR_QUEUE_HH
+#define MPMC_CIRCULAR_QUEUE_HH
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+
+using namespace std;
+
+/*Diferencias con SpscCircularQueue:
+
+1. Cada slot tiene su propio número de secuencia (Cell::seq)
+
+Qué es: Un contador atómico por posición del buffer
+Por qué: Con varios productores ya no basta con que cada hilo escriba "su"
+índice. El número de secuencia dice en qué estado está el slot:
+    seq == pos         → libre, el productor que reserve pos puede escribir
+    seq == pos + 1     → lleno, el consumidor que reserve pos puede leer
+    seq == pos + cap   → liberado por el consumidor, listo para la siguiente vuelta
+Ejemplo: cap = 4, slot 1 recién creado → seq = 1; tras escribir pos = 1 → seq = 2;
+tras leerlo → seq = 5 (lo usará el productor de pos = 5)
+
+2. Reserva con compare_exchange sobre enqueuePos / dequeuePos
+
+Qué es: Los productores compiten por enqueuePos y los consumidores por dequeuePos
+Por qué: El CAS asigna cada posición a un único hilo; después ese hilo
+escribe o lee el slot sin competir con nadie más.
+
+3. Espera sin locks
+
+Qué es: Las variantes bloqueantes reintentan con una espera activa corta y luego yield
+Por qué: No hay mutex ni condition_variable que serialicen las operaciones.*/
+
+/**
+ * @brief Bounded lock-free multi-producer/multi-consumer circular queue.
+ *
+ * Based on D. Vyukov's bounded MPMC queue: every slot carries a sequence
+ * number that tells producers and consumers whether it is free or full for
+ * the current lap, so any number of threads may enqueue and dequeue at the
+ * same time. Each operation comes in three flavours: blocking (enqueue,
+ * dequeue), non-blocking (try_enqueue, try_dequeue) and timed
+ * (try_enqueue_for, try_dequeue_for).
+ *
+ * @tparam T Type of elements stored in the queue (must be default-constructible).
+ */
+template <typename T>
+class MpmcCircularQueue
+{
+private:
+    static const std::size_t CACHE_LINE = 64; ///< Assumed cache line size in bytes.
+
+    /**
+     * @brief A slot of the buffer with its sequence number.
+     */
+    struct Cell
+    {
+        std::atomic<std::size_t> seq; ///< Lap state of the slot (see above).
+        T data;                       ///< Stored element.
+    };
+
+    Cell *cells;      ///< Underlying circular array of slots.
+    std::size_t cap;  ///< Capacity of the queue (power of two).
+    std::size_t mask; ///< cap - 1, used instead of % cap.
+
+    alignas(CACHE_LINE) std::atomic<std::size_t> enqueuePos; ///< Next position to be claimed by a producer.
+    alignas(CACHE_LINE) std::atomic<std::size_t> dequeuePos; ///< Next position to be claimed by a consumer.
+
+    /**
+     * @brief Smallest power of two greater than or equal to n.
+     * @param n Requested capacity.
+     * @return Rounded capacity.
+     * @throws std::invalid_argument if n is less than 2.
+     */
+    static std::size_t roundUpPow2(unsigned int n)
+    {
+        // Con cap = 1 los estados "lleno" (pos + 1) y "libre para la vuelta siguiente" (pos + cap) coinciden
+        if (n < 2)
+            throw invalid_argument("Capacity must be at least 2");
+        std::size_t p = 1;
+        while (p < n)
+            p <<= 1;
+        return p;
+    }
+
+    /**
+     * @brief Wait a little before retrying a blocked operation.
+     * @param spins Number of consecutive failed attempts so far (updated).
+     */
+    static void backoff(unsigned int &spins)
+    {
+        // Primero reintentar enseguida; si sigue bloqueada, ceder el núcleo
+        if (++spins > 64)
+            std::this_thread::yield();
+    }
+
+public:
+    /**
+     * @brief Constructor with capacity.
+     * @param capacity Maximum number of elements; it is rounded up to a power of two.
+     * @throws std::invalid_argument if capacity is less than 2.
+     */
+    explicit MpmcCircularQueue(unsigned int capacity)
+        : cells(nullptr), cap(roundUpPow2(capacity)), mask(cap - 1), enqueuePos(0), dequeuePos(0)
+    {
+        cells = new Cell[cap];
+        for (std::size_t i = 0; i < cap; i++)
+        {
+            cells[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Los índices atómicos no se pueden copiar de forma segura mientras otros hilos los usan
+    MpmcCircularQueue(const MpmcCircularQueue<T> &other) = delete;
+    MpmcCircularQueue<T> &operator=(const MpmcCircularQueue<T> &other) = delete;
+
+    /**
+     * @brief Destructor. Frees the buffer.
+     * @note No thread may be using the queue at this point.
+     */
+    ~MpmcCircularQueue()
+    {
+        delete[] cells;
+    }
+
+    // ==================== PRODUCTORES ====================
+
+    /**
+     * @brief Try to add an element to the rear of the queue.
+     * @param val Value to add.
+     * @return true if it was added, false if the queue is full.
+     */
+    bool try_enqueue(const T &val)
+    {
+        std::size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Cell &cell = cells[pos & mask];
+            std::size_t seq = cell.seq.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0)
+            {
+                // Slot libre para esta vuelta: intentar reservarlo
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    cell.data = val;
+                    cell.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+                // Si falla, pos ya tiene el valor actual de enqueuePos
+            }
+            else if (diff < 0)
+            {
+                // El consumidor de la vuelta anterior aún no libera el slot: cola llena
+                return false;
+            }
+            else
+            {
+                // Otro productor ya tomó pos; reintentar con la posición actual
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Add an element to the rear of the queue, waiting while it is full.
+     * @param val Value to add to the queue.
+     */
+    void enqueue(const T &val)
+    {
+        unsigned int spins = 0;
+        while (!try_enqueue(val))
+            backoff(spins);
+    }
+
+    /**
+     * @brief Add an element, waiting at most the given time while the queue is full.
+     * @param val Value to add.
+     * @param timeout Maximum time to wait.
+     * @return true if it was added, false if the timeout expired.
+     */
+    template <typename Rep, typename Period>
+    bool try_enqueue_for(const T &val, const std::chrono::duration<Rep, Period> &timeout)
+    {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        unsigned int spins = 0;
+        while (!try_enqueue(val))
+        {
+            if (std::chrono::steady_clock::now() >= deadline)
+                return false;
+            backoff(spins);
+        }
+        return true;
+    }
+
+    // ==================== CONSUMIDORES ====================
+
+    /**
+     * @brief Try to remove the front element.
+     * @param out Receives the removed element.
+     * @return true if an element was removed, false if the queue is empty.
+     */
+    bool try_dequeue(T &out)
+    {
+        std::size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Cell &cell = cells[pos & mask];
+            std::size_t seq = cell.seq.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0)
+            {
+                // Slot lleno para esta vuelta: intentar reservarlo
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    out = std::move(cell.data);
+                    // Dejar el slot listo para el productor de la vuelta siguiente
+                    cell.seq.store(pos + cap, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                // El productor de esta vuelta aún no escribe el slot: cola vacía
+                return false;
+            }
+            else
+            {
+                // Otro consumidor ya tomó pos; reintentar con la posición actual
+                pos = dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Remove the front element, waiting while the queue is empty.
+     * @param out Receives the removed element.
+     */
+    void dequeue(T &out)
+    {
+        unsigned int spins = 0;
+        while (!try_dequeue(out))
+            backoff(spins);
+    }
+
+    /**
+     * @brief Remove the front element, waiting at most the given time while the queue is empty.
+     * @param out Receives the removed element.
+     * @param timeout Maximum time to wait.
+     * @return true if an element was removed, false if the timeout expired.
+     */
+    template <typename Rep, typename Period>
+    bool try_dequeue_for(T &out, const std::chrono::duration<Rep, Period> &timeout)
+    {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        unsigned int spins = 0;
+        while (!try_dequeue(out))
+        {
+            if (std::chrono::steady_clock::now() >= deadline)
+                return false;
+            backoff(spins);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Copy the front element without removing it.
+     * @param out Receives a copy of the front element.
+     * @return true if the queue had a front element, false if it is empty.
+     * @note Producers may keep running, but no other consumer may run at the
+     *       same time: a concurrent dequeue could recycle the slot while it is read.
+     */
+    bool front(T &out) const
+    {
+        std::size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        const Cell &cell = cells[pos & mask];
+        if (cell.seq.load(std::memory_order_acquire) != pos + 1)
+            return false;
+        out = cell.data;
+        return true;
+    }
+
+    // ==================== CONSULTAS ====================
+
+    /**
+     * @brief Get the number of elements in the queue.
+     * @return Number of elements. While other threads are running this is only a snapshot.
+     */
+    unsigned int size() const
+    {
+        // Leer primero dequeuePos para que tail - head nunca sea "negativo"
+        std::size_t head = dequeuePos.load(std::memory_order_acquire);
+        std::size_t tail = enqueuePos.load(std::memory_order_acquire);
+        std::size_t n = tail - head;
+        if (n > cap) // Entre las dos lecturas otros hilos pudieron avanzar ambos índices
+            n = cap;
+        return static_cast<unsigned int>(n);
+    }
+
+    /**
+     * @brief Check if the queue is empty (snapshot).
+     * @return true if the queue is empty, false otherwise.
+     */
+    bool isEmpty() const
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Check if the queue is full (snapshot).
+     * @return true if the queue is full, false otherwise.
+     */
+    bool isFull() const
+    {
+        return size() == cap;
+    }
+
+    /**
+     * @brief Get the maximum capacity of the queue.
+     * @return The maximum number of elements the queue can hold.
+     */
+    unsigned int capacity() const
+    {
+        return static_cast<unsigned int>(cap);
+    }
+};
+
+#endif
@@ -0,0 +1,298 @@
+#ifndef SPSC_CIRCULAR_QUEUE_HH
+#define SPSC_CIRCULAR_QUEUE_HH
+#include "Array.hh"
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+
+/*Diferencias con CircularQueue:
+
+1. No hay sz compartido
+
+Qué es: El tamaño se calcula como tail - head
+Por qué: Un contador que modifican los dos hilos necesitaría un lock o un
+atomic read-modify-write en cada operación. Así cada hilo escribe solo su índice.
+
+2. head y tail son contadores que solo crecen
+
+Qué es: Nunca se reducen con % cap; la posición real es índice & (cap - 1)
+Por qué: Con cap potencia de dos la máscara reemplaza la división, y
+"lleno" (tail - head == cap) se distingue de "vacío" (tail == head) sin
+desperdiciar un slot.
+
+3. Cada índice en su propia línea de caché
+
+Qué es: head (consumidor) y tail (productor) están separados por 64 bytes
+Por qué: Si comparten línea, cada escritura de un hilo invalida la caché del
+otro aunque no lean la misma variable (false sharing).
+
+4. Copias locales del índice del otro hilo (cachedHead / cachedTail)
+
+Qué es: El productor recuerda el último head que leyó, y el consumidor el último tail
+Por qué: Solo se vuelve a leer el atomic del otro hilo cuando la copia dice
+"lleno" o "vacío", lo que ahorra tráfico entre núcleos.*/
+
+/**
+ * @brief Lock-free single-producer/single-consumer circular queue.
+ *
+ * Exactly one thread may call the producer operations (enqueue, try_enqueue,
+ * try_enqueue_bulk) and exactly one thread the consumer operations (dequeue,
+ * try_dequeue, try_dequeue_bulk, front). The producer publishes elements
+ * with a release store on tail and the consumer observes them with an
+ * acquire load, so no locks are needed.
+ *
+ * @tparam T Type of elements stored in the queue (must be default-constructible).
+ */
+template <typename T>
+class SpscCircularQueue
+{
+private:
+    static const std::size_t CACHE_LINE = 64; ///< Assumed cache line size in bytes.
+
+    Array<T> buffer;   ///< Underlying array to store queue elements.
+    std::size_t cap;   ///< Capacity of the queue (power of two).
+    std::size_t mask;  ///< cap - 1, used instead of % cap.
+
+    // Lado del consumidor
+    alignas(CACHE_LINE) std::atomic<std::size_t> head; ///< Next position to read (written by the consumer).
+    std::size_t cachedTail;                            ///< Consumer's last seen value of tail.
+
+    // Lado del productor
+    alignas(CACHE_LINE) std::atomic<std::size_t> tail; ///< Next position to write (written by the producer).
+    std::size_t cachedHead;                            ///< Producer's last seen value of head.
+
+    static const unsigned int MAX_CAPACITY = ~0u / 2 + 1; ///< Largest power of two that fits in unsigned int.
+
+    /**
+     * @brief Smallest power of two greater than or equal to n.
+     * @param n Requested capacity.
+     * @return Rounded capacity.
+     * @throws std::invalid_argument if n is 0.
+     * @throws std::length_error if n is greater than MAX_CAPACITY.
+     */
+    static unsigned int roundUpPow2(unsigned int n)
+    {
+        if (n == 0)
+            throw invalid_argument("Capacity must be greater than 0");
+        if (n > MAX_CAPACITY)
+            throw length_error("Capacity too large");
+        unsigned int p = 1;
+        while (p < n)
+            p <<= 1;
+        return p;
+    }
+
+    /**
+     * @brief Free slots as seen by the producer, refreshing cachedHead if needed.
+     * @param t Current tail.
+     * @param wanted Number of slots the producer would like.
+     * @return Number of free slots (may be less than wanted).
+     */
+    std::size_t freeSlots(std::size_t t, std::size_t wanted)
+    {
+        std::size_t available = cap - (t - cachedHead);
+        if (available < wanted)
+        {
+            cachedHead = head.load(std::memory_order_acquire);
+            available = cap - (t - cachedHead);
+        }
+        return available;
+    }
+
+    /**
+     * @brief Ready elements as seen by the consumer, refreshing cachedTail if needed.
+     * @param h Current head.
+     * @param wanted Number of elements the consumer would like.
+     * @return Number of ready elements (may be less than wanted).
+     */
+    std::size_t readyItems(std::size_t h, std::size_t wanted)
+    {
+        std::size_t available = cachedTail - h;
+        if (available < wanted)
+        {
+            cachedTail = tail.load(std::memory_order_acquire);
+            available = cachedTail - h;
+        }
+        return available;
+    }
+
+public:
+    /**
+     * @brief Constructor with capacity.
+     * @param capacity Maximum number of elements; it is rounded up to a power of two.
+     * @throws std::invalid_argument if capacity is 0.
+     * @throws std::length_error if capacity is greater than 2^31.
+     */
+    explicit SpscCircularQueue(unsigned int capacity)
+        : buffer(roundUpPow2(capacity)), cap(buffer.capacity()), mask(cap - 1),
+          head(0), cachedTail(0), tail(0), cachedHead(0)
+    {
+        // Cuerpo vacío - todo se hace en lista de inicialización
+    }
+
+    // Los índices atómicos no se pueden copiar de forma segura mientras otro hilo los usa
+    SpscCircularQueue(const SpscCircularQueue<T> &other) = delete;
+    SpscCircularQueue<T> &operator=(const SpscCircularQueue<T> &other) = delete;
+
+    ~SpscCircularQueue() = default;
+
+    // ==================== PRODUCTOR ====================
+
+    /**
+     * @brief Try to add an element to the rear of the queue.
+     * @param val Value to add.
+     * @return true if it was added, false if the queue is full.
+     */
+    bool try_enqueue(const T &val)
+    {
+        std::size_t t = tail.load(std::memory_order_relaxed);
+        if (freeSlots(t, 1) == 0)
+            return false;
+
+        buffer[t & mask] = val;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Add up to n elements with a single publication of tail.
+     * @param items Pointer to the elements to add.
+     * @param n Number of elements in items.
+     * @return Number of elements actually added (0 if the queue is full).
+     */
+    unsigned int try_enqueue_bulk(const T *items, unsigned int n)
+    {
+        std::size_t t = tail.load(std::memory_order_relaxed);
+        std::size_t available = freeSlots(t, n);
+        unsigned int count = (available < n) ? static_cast<unsigned int>(available) : n;
+
+        for (unsigned int i = 0; i < count; i++)
+        {
+            buffer[(t + i) & mask] = items[i];
+        }
+        if (count > 0)
+            tail.store(t + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * @brief Add an element to the rear of the queue.
+     * @param val Value to add to the queue.
+     * @throws std::overflow_error if the queue is full.
+     */
+    void enqueue(const T &val)
+    {
+        if (!try_enqueue(val))
+            throw std::overflow_error("Queue is full");
+    }
+
+    // ==================== CONSUMIDOR ====================
+
+    /**
+     * @brief Try to remove the front element.
+     * @param out Receives the removed element.
+     * @return true if an element was removed, false if the queue is empty.
+     */
+    bool try_dequeue(T &out)
+    {
+        std::size_t h = head.load(std::memory_order_relaxed);
+        if (readyItems(h, 1) == 0)
+            return false;
+
+        out = buffer[h & mask];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove up to n elements with a single publication of head.
+     * @param out Pointer to where the elements are written.
+     * @param n Maximum number of elements to remove.
+     * @return Number of elements actually removed (0 if the queue is empty).
+     */
+    unsigned int try_dequeue_bulk(T *out, unsigned int n)
+    {
+        std::size_t h = head.load(std::memory_order_relaxed);
+        std::size_t available = readyItems(h, n);
+        unsigned int count = (available < n) ? static_cast<unsigned int>(available) : n;
+
+        for (unsigned int i = 0; i < count; i++)
+        {
+            out[i] = buffer[(h + i) & mask];
+        }
+        if (count > 0)
+            head.store(h + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * @brief Remove the front element from the queue.
+     * @throws std::underflow_error if the queue is empty.
+     */
+    void dequeue()
+    {
+        std::size_t h = head.load(std::memory_order_relaxed);
+        if (readyItems(h, 1) == 0)
+            throw std::underflow_error("queue is empty");
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Get the front element of the queue without removing it.
+     * @return Reference to the front element (valid until the consumer dequeues it).
+     * @throws std::underflow_error if the queue is empty.
+     */
+    T &front()
+    {
+        std::size_t h = head.load(std::memory_order_relaxed);
+        if (readyItems(h, 1) == 0)
+            throw std::underflow_error("queue is empty");
+        return buffer[h & mask];
+    }
+
+    // ==================== CONSULTAS ====================
+
+    /**
+     * @brief Get the number of elements in the queue.
+     * @return Number of elements. While both threads are running this is only a snapshot.
+     */
+    unsigned int size() const
+    {
+        std::size_t h = head.load(std::memory_order_acquire);
+        std::size_t t = tail.load(std::memory_order_acquire);
+        return static_cast<unsigned int>(t - h);
+    }
+
+    /**
+     * @brief Check if the queue is empty (snapshot).
+     * @return true if the queue is empty, false otherwise.
+     */
+    bool isEmpty() const
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Check if the queue is full (snapshot).
+     * @return true if the queue is full, false otherwise.
+     */
+    bool isFull() const
+    {
+        return size() == cap;
+    }
+
+    /**
+     * @brief Get the maximum capacity of the queue.
+     * @return The maximum number of elements the queue can hold.
+     */
+    unsigned int capacity() const
+    {
+        return static_cast<unsigned int>(cap);
+    }
+};
+
+#endif
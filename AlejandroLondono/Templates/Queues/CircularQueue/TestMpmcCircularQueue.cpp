@@ -0,0 +1,140 @@
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "MpmcCircularQueue.hh"
+
+// Compilar con: g++ -O2 -std=c++17 -pthread TestMpmcCircularQueue.cpp -o TestMpmcCircularQueue
+
+using namespace std;
+
+void testBasicOperations() {
+    cout << "\n=== TEST: Basic Operations (single thread) ===" << endl;
+
+    MpmcCircularQueue<int> q(3);  // Se redondea a 4
+    cout << "Capacity (3 rounded up): " << q.capacity() << endl;
+    cout << "Queue is empty: " << (q.isEmpty() ? "true" : "false") << endl;
+
+    q.enqueue(10);
+    q.enqueue(20);
+    int value = 0;
+    q.front(value);
+    cout << "Size: " << q.size() << ", Front: " << value << endl;
+
+    q.dequeue(value);
+    cout << "Dequeued: " << value << endl;
+    q.try_dequeue(value);
+    cout << "try_dequeue: " << value << endl;
+    cout << "try_dequeue on empty queue: " << (q.try_dequeue(value) ? "true" : "false") << endl;
+    cout << "front on empty queue: " << (q.front(value) ? "true" : "false") << endl;
+
+    for (int i = 0; i < 4; i++) {
+        q.enqueue(i);
+    }
+    cout << "Queue is full: " << (q.isFull() ? "true" : "false") << endl;
+    cout << "try_enqueue on full queue: " << (q.try_enqueue(99) ? "true" : "false") << endl;
+}
+
+void testTimedOperations() {
+    cout << "\n=== TEST: Timed Operations ===" << endl;
+
+    MpmcCircularQueue<int> q(2);
+    int value = 0;
+
+    auto start = chrono::steady_clock::now();
+    bool got = q.try_dequeue_for(value, chrono::milliseconds(20));
+    double waited = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << "try_dequeue_for on empty queue: " << (got ? "true" : "false")
+         << " (waited >= 20 ms: " << (waited >= 20 ? "true" : "false") << ")" << endl;
+
+    q.enqueue(1);
+    q.enqueue(2);
+    cout << "try_enqueue_for on full queue: "
+         << (q.try_enqueue_for(3, chrono::milliseconds(5)) ? "true" : "false") << endl;
+
+    // Un consumidor libera un slot mientras el productor espera
+    thread consumer([&]() {
+        this_thread::sleep_for(chrono::milliseconds(5));
+        int out;
+        q.dequeue(out);
+    });
+    cout << "try_enqueue_for while a consumer frees a slot: "
+         << (q.try_enqueue_for(3, chrono::seconds(5)) ? "true" : "false") << endl;
+    consumer.join();
+}
+
+void testStress() {
+    cout << "\n=== TEST: Stress (4 producers, 4 consumers) ===" << endl;
+
+    const int PRODUCERS = 4;
+    const int CONSUMERS = 4;
+    const unsigned long long PER_PRODUCER = 250000;
+    MpmcCircularQueue<unsigned long long> q(64);  // Pequeña para forzar muchas vueltas y esperas
+
+    atomic<unsigned long long> received(0);
+    atomic<unsigned long long> sum(0);
+    atomic<bool> orderOk(true);
+
+    vector<thread> threads;
+    for (int p = 0; p < PRODUCERS; p++) {
+        threads.emplace_back([&, p]() {
+            for (unsigned long long i = 0; i < PER_PRODUCER; i++) {
+                // Codificar el productor en los bits altos para verificar el orden FIFO por productor
+                q.enqueue((static_cast<unsigned long long>(p) << 32) | i);
+            }
+        });
+    }
+    for (int c = 0; c < CONSUMERS; c++) {
+        threads.emplace_back([&]() {
+            vector<long long> last(PRODUCERS, -1);
+            unsigned long long localSum = 0;
+            unsigned long long value;
+            while (received.load() < PRODUCERS * PER_PRODUCER) {
+                if (!q.try_dequeue_for(value, chrono::milliseconds(1))) {
+                    continue;
+                }
+                received++;
+                unsigned int producer = static_cast<unsigned int>(value >> 32);
+                long long seq = static_cast<long long>(value & 0xffffffffULL);
+                // Cada consumidor debe ver los elementos de un mismo productor en orden creciente
+                if (seq <= last[producer]) {
+                    orderOk = false;
+                }
+                last[producer] = seq;
+                localSum += value & 0xffffffffULL;
+            }
+            sum += localSum;
+        });
+    }
+    for (thread &t : threads) {
+        t.join();
+    }
+
+    unsigned long long expectedSum = PRODUCERS * (PER_PRODUCER * (PER_PRODUCER - 1) / 2);
+    cout << "Received: " << received.load() << " of " << PRODUCERS * PER_PRODUCER << endl;
+    cout << "Sum matches: " << (sum.load() == expectedSum ? "true" : "false") << endl;
+    cout << "Per-producer FIFO order: " << (orderOk.load() ? "true" : "false") << endl;
+    cout << "Queue is empty at the end: " << (q.isEmpty() ? "true" : "false") << endl;
+}
+
+int main() {
+    cout << "======================================" << endl;
+    cout << "    MPMC CIRCULAR QUEUE TEST SUITE    " << endl;
+    cout << "======================================" << endl;
+
+    try {
+        testBasicOperations();
+        testTimedOperations();
+        testStress();
+
+        cout << "\n======================================" << endl;
+        cout << "        ALL TESTS COMPLETED!          " << endl;
+        cout << "======================================" << endl;
+    } catch (const exception& e) {
+        cerr << "Unexpected error: " << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,164 @@
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include "SpscCircularQueue.hh"
+
+// Compilar con: g++ -O2 -std=c++17 -pthread TestSpscCircularQueue.cpp -o TestSpscCircularQueue
+
+using namespace std;
+
+void testBasicOperations() {
+    cout << "\n=== TEST: Basic Operations (single thread) ===" << endl;
+
+    SpscCircularQueue<int> q(5);  // Se redondea a 8
+    cout << "Capacity (5 rounded up): " << q.capacity() << endl;
+    cout << "Queue is empty: " << (q.isEmpty() ? "true" : "false") << endl;
+
+    q.enqueue(10);
+    q.enqueue(20);
+    q.enqueue(30);
+    cout << "Size after 3 enqueues: " << q.size() << ", Front: " << q.front() << endl;
+
+    int out = 0;
+    q.try_dequeue(out);
+    cout << "try_dequeue -> " << out << ", new front: " << q.front() << endl;
+    q.dequeue();
+    cout << "After dequeue, front: " << q.front() << ", size: " << q.size() << endl;
+    q.dequeue();
+
+    try {
+        q.dequeue();
+    } catch (const underflow_error& e) {
+        cout << "Dequeue on empty queue: " << e.what() << endl;
+    }
+
+    for (unsigned int i = 0; i < q.capacity(); i++) {
+        q.enqueue(static_cast<int>(i));
+    }
+    cout << "Queue is full: " << (q.isFull() ? "true" : "false") << endl;
+    cout << "try_enqueue on full queue: " << (q.try_enqueue(99) ? "true" : "false") << endl;
+    try {
+        q.enqueue(99);
+    } catch (const overflow_error& e) {
+        cout << "Enqueue on full queue: " << e.what() << endl;
+    }
+}
+
+void testCapacityLimits() {
+    cout << "\n=== TEST: Capacity Limits ===" << endl;
+
+    try {
+        SpscCircularQueue<char> q(0);
+        cout << "No exception for capacity 0 (unexpected)" << endl;
+    } catch (const invalid_argument& e) {
+        cout << "Capacity 0: " << e.what() << endl;
+    }
+
+    // Más de 2^31 no se puede redondear a una potencia de dos en unsigned int
+    try {
+        SpscCircularQueue<char> q(0x80000001u);
+        cout << "No exception for capacity 2^31 + 1 (unexpected), capacity: " << q.capacity() << endl;
+    } catch (const length_error& e) {
+        cout << "Capacity 2^31 + 1: " << e.what() << endl;
+    }
+}
+
+void testBulkOperations() {
+    cout << "\n=== TEST: Bulk Operations with Wraparound ===" << endl;
+
+    SpscCircularQueue<int> q(8);
+    int in[6] = {1, 2, 3, 4, 5, 6};
+    int out[8] = {0};
+
+    // Avanzar los índices para que el siguiente lote dé la vuelta al buffer
+    cout << "Enqueued: " << q.try_enqueue_bulk(in, 6) << endl;
+    cout << "Dequeued: " << q.try_dequeue_bulk(out, 5) << endl;
+
+    unsigned int added = q.try_enqueue_bulk(in, 6);
+    cout << "Enqueued across the end of the buffer: " << added << " (size " << q.size() << ")" << endl;
+    unsigned int extra = q.try_enqueue_bulk(in, 6);
+    cout << "Enqueue bulk with only 1 free slot: " << extra << endl;
+
+    unsigned int got = q.try_dequeue_bulk(out, 8);
+    cout << "Dequeued " << got << ": ";
+    for (unsigned int i = 0; i < got; i++) {
+        cout << out[i] << " ";
+    }
+    cout << endl;
+    cout << "Expected: 6 1 2 3 4 5 6 1" << endl;
+}
+
+void testProducerConsumer() {
+    cout << "\n=== TEST: Producer/Consumer Threads ===" << endl;
+
+    const unsigned long long N = 20000000ULL;
+    const unsigned int BATCH = 64;
+    SpscCircularQueue<unsigned long long> q(1024);
+
+    auto start = chrono::steady_clock::now();
+
+    thread producer([&]() {
+        unsigned long long batch[BATCH];
+        unsigned long long next = 0;
+        while (next < N) {
+            unsigned int n = 0;
+            while (n < BATCH && next + n < N) {
+                batch[n] = next + n;
+                n++;
+            }
+            unsigned int sent = 0;
+            while (sent < n) {
+                unsigned int k = q.try_enqueue_bulk(batch + sent, n - sent);
+                if (k == 0) {
+                    this_thread::yield();  // Cola llena: ceder el núcleo al consumidor
+                }
+                sent += k;
+            }
+            next += n;
+        }
+    });
+
+    unsigned long long expected = 0;
+    bool inOrder = true;
+    unsigned long long batch[BATCH];
+    while (expected < N) {
+        unsigned int got = q.try_dequeue_bulk(batch, BATCH);
+        if (got == 0) {
+            this_thread::yield();  // Cola vacía: ceder el núcleo al productor
+        }
+        for (unsigned int i = 0; i < got; i++) {
+            if (batch[i] != expected) {
+                inOrder = false;
+            }
+            expected++;
+        }
+    }
+    producer.join();
+
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "Messages: " << N << ", in order: " << (inOrder ? "true" : "false") << endl;
+    cout << "Throughput: " << (N / seconds / 1e6) << " M msg/s" << endl;
+    cout << "Queue is empty at the end: " << (q.isEmpty() ? "true" : "false") << endl;
+}
+
+int main() {
+    cout << "======================================" << endl;
+    cout << "    SPSC CIRCULAR QUEUE TEST SUITE    " << endl;
+    cout << "======================================" << endl;
+
+    try {
+        testBasicOperations();
+        testCapacityLimits();
+        testBulkOperations();
+        testProducerConsumer();
+
+        cout << "\n======================================" << endl;
+        cout << "        ALL TESTS COMPLETED!          " << endl;
+        cout << "======================================" << endl;
+    } catch (const exception& e) {
+        cerr << "Unexpected error: " << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,546 @@
+#ifndef LOCK_FREE_QUEUE_LIST_HH
+#define LOCK_FREE_QUEUE_LIST_HH
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+/*Diferencias con QueueList:
+
+1. Lista de Michael y Scott con nodo centinela
+
+Qué es: head apunta siempre a un nodo "dummy"; el frente real es head->next
+Por qué: Así enqueue solo toca tail y dequeue solo toca head, y cada uno se
+hace con un compare_exchange, sin mutex. Si un hilo ve tail atrasado
+(tail->next != nullptr) lo adelanta antes de seguir, ayudando al que se quedó a medias.
+
+2. Hazard pointers (slots)
+
+Qué es: Antes de leer un nodo compartido, el hilo publica su dirección en un slot
+Por qué: Otro hilo puede sacar ese nodo de la cola al mismo tiempo. Un nodo
+retirado solo se reutiliza cuando ningún slot lo anuncia, así nunca se lee
+memoria liberada ni ocurre ABA.
+
+3. Slots prestados por operación
+
+Qué es: Cada operación toma uno de MaxThreads slots y lo devuelve al terminar
+Por qué: No hace falta registrar hilos ni usar thread_local por cola. Cada
+hilo empieza buscando en "su" slot (hash de su id), así que casi nunca compite.
+
+4. Reciclaje de nodos
+
+Qué es: Cada slot guarda sus nodos retirados y una lista de nodos libres
+Por qué: Los nodos que ya nadie anuncia vuelven a usarse en el siguiente
+enqueue en vez de liberarse y pedirse de nuevo al heap. Como la lista libre
+es del slot y el slot lo tiene un solo hilo a la vez, no necesita atomics.
+
+5. Lote compartido (spare)
+
+Qué es: Cuando la lista libre de un slot se llena, se entrega entera a spare
+Por qué: Los nodos se retiran en los slots de los consumidores pero se piden
+en los de los productores. spare pasa un lote completo de un lado al otro con
+un solo CAS (al entregar) y un solo exchange (al tomar), sin ABA porque nunca
+se compara contra un nodo que pudo reciclarse.*/
+
+/**
+ * @brief Unbounded lock-free multi-producer/multi-consumer queue.
+ *
+ * Concurrent successor of QueueList: a Michael-Scott linked queue whose
+ * nodes are reclaimed with hazard pointers and recycled through per-slot
+ * free lists, so steady-state enqueue/dequeue does not touch the heap.
+ *
+ * @tparam T Type of elements stored in the queue (must be default-constructible).
+ * @tparam MaxThreads Number of hazard pointer slots, i.e. how many operations
+ *         can run at the same time without waiting for a free slot.
+ */
+template <typename T, unsigned int MaxThreads = 64>
+class LockFreeQueueList
+{
+private:
+    static const std::size_t CACHE_LINE = 64;                   ///< Assumed cache line size in bytes.
+    static const unsigned int HAZARDS = 2;                      ///< Hazard pointers per operation (head and head->next).
+    static const std::size_t SCAN_THRESHOLD = 2 * HAZARDS * MaxThreads; ///< Retired nodes that trigger a scan.
+    static const std::size_t MAX_FREE = SCAN_THRESHOLD;         ///< Maximum recycled nodes kept per slot.
+
+    /**
+     * @brief Node of the linked queue.
+     */
+    struct Node
+    {
+        T data;                   ///< Stored element (unused in the dummy node).
+        std::atomic<Node *> next; ///< Next node towards the rear.
+
+        Node() : data(), next(nullptr) {}
+    };
+
+    /**
+     * @brief Hazard pointer slot, borrowed by one operation at a time.
+     */
+    struct alignas(CACHE_LINE) Slot
+    {
+        std::atomic<bool> busy;             ///< true while an operation owns the slot.
+        std::atomic<Node *> hazard[HAZARDS]; ///< Nodes the owner is reading.
+        std::vector<Node *> retired;        ///< Nodes removed from the queue, waiting to be reclaimed.
+        Node *freeList;                     ///< Recycled nodes, linked through next.
+        std::size_t freeCount;              ///< Number of nodes in freeList.
+
+        Slot() : busy(false), freeList(nullptr), freeCount(0)
+        {
+            for (unsigned int i = 0; i < HAZARDS; i++)
+                hazard[i].store(nullptr, std::memory_order_relaxed);
+        }
+    };
+
+    alignas(CACHE_LINE) std::atomic<Node *> head; ///< Dummy node; the front element is head->next.
+    alignas(CACHE_LINE) std::atomic<Node *> tail; ///< Last node (or one behind it while an enqueue is in progress).
+    alignas(CACHE_LINE) std::atomic<long> count;  ///< Number of elements (approximate while threads are running).
+    alignas(CACHE_LINE) std::atomic<Node *> spare; ///< Batch of recycled nodes handed from one slot to another.
+    Slot *slots;                                  ///< MaxThreads hazard pointer slots.
+
+    // ==================== SLOTS ====================
+
+    /**
+     * @brief Take a free slot, starting at the one associated with this thread.
+     * @return Slot owned by the caller until releaseSlot.
+     */
+    Slot &acquireSlot()
+    {
+        // El índice inicial depende solo del hilo, así que se calcula una vez por hilo
+        static thread_local unsigned int start =
+            static_cast<unsigned int>(std::hash<std::thread::id>()(std::this_thread::get_id()) % MaxThreads);
+        for (;;)
+        {
+            for (unsigned int i = 0; i < MaxThreads; i++)
+            {
+                Slot &slot = slots[(start + i) % MaxThreads];
+                if (!slot.busy.load(std::memory_order_relaxed) && !slot.busy.exchange(true, std::memory_order_acquire))
+                    return slot;
+            }
+            // Más de MaxThreads operaciones en curso: esperar a que alguna termine
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @brief Clear the hazard pointers of a slot and give it back.
+     * @param slot Slot obtained with acquireSlot.
+     */
+    void releaseSlot(Slot &slot)
+    {
+        for (unsigned int i = 0; i < HAZARDS; i++)
+            slot.hazard[i].store(nullptr, std::memory_order_release);
+        slot.busy.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief Owns a slot for the lifetime of an operation, so it is released even if T throws.
+     */
+    struct SlotGuard
+    {
+        LockFreeQueueList &queue; ///< Queue the slot belongs to.
+        Slot &slot;               ///< Slot owned by the operation.
+
+        explicit SlotGuard(LockFreeQueueList &q) : queue(q), slot(q.acquireSlot()) {}
+        ~SlotGuard() { queue.releaseSlot(slot); }
+
+        SlotGuard(const SlotGuard &) = delete;
+        SlotGuard &operator=(const SlotGuard &) = delete;
+    };
+
+    /**
+     * @brief Publish a hazard pointer to the node currently stored in src.
+     * @param slot Slot of the caller.
+     * @param i Hazard index.
+     * @param src Shared pointer to read.
+     * @return Node that is now protected (it was still in src after publishing).
+     */
+    Node *protect(Slot &slot, unsigned int i, const std::atomic<Node *> &src)
+    {
+        Node *node = src.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            // seq_cst: la publicación debe ser visible antes de volver a leer src
+            slot.hazard[i].store(node, std::memory_order_seq_cst);
+            Node *again = src.load(std::memory_order_seq_cst);
+            if (again == node)
+                return node;
+            node = again;
+        }
+    }
+
+    // ==================== NODOS ====================
+
+    /**
+     * @brief Free a linked list of nodes.
+     * @param node First node of the list.
+     */
+    static void deleteChain(Node *node)
+    {
+        while (node != nullptr)
+        {
+            Node *next = node->next.load(std::memory_order_relaxed);
+            delete node;
+            node = next;
+        }
+    }
+
+    /**
+     * @brief Get a node from the slot's free list, from the shared batch, or from the heap.
+     * @param slot Slot of the caller.
+     * @return Node with next == nullptr.
+     */
+    Node *allocNode(Slot &slot)
+    {
+        if (slot.freeList == nullptr && spare.load(std::memory_order_relaxed) != nullptr)
+        {
+            // Tomar el lote entero que dejó otro slot
+            slot.freeList = spare.exchange(nullptr, std::memory_order_acquire);
+            for (Node *f = slot.freeList; f != nullptr; f = f->next.load(std::memory_order_relaxed))
+                slot.freeCount++;
+        }
+        Node *node = slot.freeList;
+        if (node == nullptr)
+            return new Node();
+        slot.freeList = node->next.load(std::memory_order_relaxed);
+        slot.freeCount--;
+        node->next.store(nullptr, std::memory_order_relaxed);
+        return node;
+    }
+
+    /**
+     * @brief Give back a node taken with allocNode that was never linked.
+     * @param slot Slot of the caller.
+     * @param node Node to return (its data is overwritten by the next enqueue).
+     */
+    void unallocNode(Slot &slot, Node *node)
+    {
+        if (slot.freeCount >= MAX_FREE)
+        {
+            delete node;
+            return;
+        }
+        node->next.store(slot.freeList, std::memory_order_relaxed);
+        slot.freeList = node;
+        slot.freeCount++;
+    }
+
+    /**
+     * @brief Put a node that nobody references into the slot's free list.
+     * @param slot Slot of the caller.
+     * @param node Node to recycle.
+     */
+    void recycleNode(Slot &slot, Node *node)
+    {
+        if (slot.freeCount >= MAX_FREE)
+        {
+            // Entregar la lista libre llena a quien la necesite (normalmente un productor)
+            Node *expected = nullptr;
+            if (spare.load(std::memory_order_relaxed) == nullptr &&
+                spare.compare_exchange_strong(expected, slot.freeList, std::memory_order_release, std::memory_order_relaxed))
+            {
+                slot.freeList = nullptr;
+                slot.freeCount = 0;
+            }
+            else
+            {
+                delete node;
+                return;
+            }
+        }
+        try
+        {
+            node->data = T();
+        }
+        catch (...)
+        {
+            // No se puede limpiar el dato: mejor liberar el nodo que dejar el scan a medias
+            delete node;
+            return;
+        }
+        node->next.store(slot.freeList, std::memory_order_relaxed);
+        slot.freeList = node;
+        slot.freeCount++;
+    }
+
+    /**
+     * @brief Retire a node removed from the queue; scan the hazard pointers when enough have piled up.
+     * @param slot Slot of the caller.
+     * @param node Node that is no longer reachable from head.
+     */
+    void retireNode(Slot &slot, Node *node)
+    {
+        slot.retired.push_back(node);
+        if (slot.retired.size() < SCAN_THRESHOLD)
+            return;
+
+        // Recolectar todos los nodos anunciados
+        std::vector<Node *> hazards;
+        hazards.reserve(MaxThreads * HAZARDS);
+        for (unsigned int s = 0; s < MaxThreads; s++)
+        {
+            for (unsigned int i = 0; i < HAZARDS; i++)
+            {
+                Node *h = slots[s].hazard[i].load(std::memory_order_seq_cst);
+                if (h != nullptr)
+                    hazards.push_back(h);
+            }
+        }
+        std::sort(hazards.begin(), hazards.end());
+
+        // Reciclar los que nadie anuncia; los demás esperan al siguiente scan
+        std::size_t kept = 0;
+        for (Node *r : slot.retired)
+        {
+            if (std::binary_search(hazards.begin(), hazards.end(), r))
+                slot.retired[kept++] = r;
+            else
+                recycleNode(slot, r);
+        }
+        slot.retired.resize(kept);
+    }
+
+    /**
+     * @brief Bookkeeping after a successful head CAS: the old dummy leaves the queue.
+     * @param slot Slot of the caller.
+     * @param first Old dummy node, now unreachable from head.
+     */
+    void finishDequeue(Slot &slot, Node *first)
+    {
+        count.fetch_sub(1, std::memory_order_relaxed);
+        slot.hazard[0].store(nullptr, std::memory_order_release);
+        slot.hazard[1].store(nullptr, std::memory_order_release);
+        retireNode(slot, first);
+    }
+
+    /**
+     * @brief Link an already filled node at the rear.
+     * @param slot Slot of the caller.
+     * @param node Node to link.
+     */
+    void linkNode(Slot &slot, Node *node)
+    {
+        for (;;)
+        {
+            Node *last = protect(slot, 0, tail);
+            Node *next = last->next.load(std::memory_order_acquire);
+            if (next != nullptr)
+            {
+                // tail está atrasado: ayudar a adelantarlo
+                tail.compare_exchange_weak(last, next, std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+            Node *expected = nullptr;
+            if (last->next.compare_exchange_weak(expected, node, std::memory_order_release, std::memory_order_relaxed))
+            {
+                tail.compare_exchange_strong(last, node, std::memory_order_release, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Default constructor. Initializes an empty queue.
+     */
+    LockFreeQueueList() : head(nullptr), tail(nullptr), count(0), spare(nullptr), slots(new Slot[MaxThreads])
+    {
+        Node *dummy = new Node();
+        head.store(dummy, std::memory_order_relaxed);
+        tail.store(dummy, std::memory_order_relaxed);
+    }
+
+    // No tiene sentido copiar una cola mientras otros hilos la modifican
+    LockFreeQueueList(const LockFreeQueueList &other) = delete;
+    LockFreeQueueList &operator=(const LockFreeQueueList &other) = delete;
+
+    /**
+     * @brief Destructor. Frees the queued, retired and recycled nodes.
+     * @note No thread may be using the queue at this point.
+     */
+    ~LockFreeQueueList()
+    {
+        deleteChain(head.load(std::memory_order_relaxed));
+        deleteChain(spare.load(std::memory_order_relaxed));
+        for (unsigned int s = 0; s < MaxThreads; s++)
+        {
+            for (Node *r : slots[s].retired)
+                delete r;
+            deleteChain(slots[s].freeList);
+        }
+        delete[] slots;
+    }
+
+    // ==================== OPERACIONES ====================
+
+    /**
+     * @brief Add an element to the rear of the queue.
+     * @param val Value to add to the queue.
+     * @note This operation never fails due to capacity limits (only memory limits).
+     * @note If copying val throws, the queue is left unchanged.
+     */
+    void enqueue(const T &val)
+    {
+        SlotGuard guard(*this);
+        Node *node = allocNode(guard.slot);
+        try
+        {
+            node->data = val;
+        }
+        catch (...)
+        {
+            // El nodo no llegó a enlazarse: devolverlo a la lista libre
+            unallocNode(guard.slot, node);
+            throw;
+        }
+        linkNode(guard.slot, node);
+        count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Add an element to the rear of the queue, moving it.
+     * @param val Value to move into the queue.
+     * @note If moving val throws, the queue is left unchanged.
+     */
+    void enqueue(T &&val)
+    {
+        SlotGuard guard(*this);
+        Node *node = allocNode(guard.slot);
+        try
+        {
+            node->data = std::move(val);
+        }
+        catch (...)
+        {
+            // El nodo no llegó a enlazarse: devolverlo a la lista libre
+            unallocNode(guard.slot, node);
+            throw;
+        }
+        linkNode(guard.slot, node);
+        count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Try to remove the front element.
+     * @param out Receives the removed element.
+     * @return true if an element was removed, false if the queue is empty.
+     * @note If moving into out throws, the element was already unlinked and is
+     *       lost; the exception propagates and the queue stays usable.
+     */
+    bool try_dequeue(T &out)
+    {
+        SlotGuard guard(*this);
+        Slot &slot = guard.slot;
+        for (;;)
+        {
+            Node *first = protect(slot, 0, head);
+            Node *next = protect(slot, 1, first->next);
+            if (head.load(std::memory_order_acquire) != first)
+                continue;
+            if (next == nullptr)
+                return false;
+            Node *last = tail.load(std::memory_order_acquire);
+            if (first == last)
+            {
+                // tail sigue apuntando al centinela: adelantarlo antes de sacarlo
+                tail.compare_exchange_weak(last, next, std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+            if (head.compare_exchange_weak(first, next, std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                // next es el nuevo centinela: nadie más lee su dato, y el hazard impide reciclarlo
+                try
+                {
+                    out = std::move(next->data);
+                }
+                catch (...)
+                {
+                    // El CAS ya sacó el elemento: terminar igual para no perder first
+                    finishDequeue(slot, first);
+                    throw;
+                }
+                finishDequeue(slot, first);
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Remove the front element from the queue.
+     * @param out Receives the removed element.
+     * @throws std::underflow_error if the queue is empty.
+     */
+    void dequeue(T &out)
+    {
+        if (!try_dequeue(out))
+            throw std::underflow_error("Cannot dequeue from an empty queue.");
+    }
+
+    /**
+     * @brief Copy the front element without removing it.
+     * @param out Receives a copy of the front element.
+     * @return true if the queue had a front element, false if it is empty.
+     * @note Producers may keep running, but no consumer may run at the same
+     *       time: a concurrent dequeue moves the element out while it is read.
+     */
+    bool front(T &out)
+    {
+        SlotGuard guard(*this);
+        Node *first = protect(guard.slot, 0, head);
+        Node *next = protect(guard.slot, 1, first->next);
+        if (next == nullptr)
+            return false;
+        out = next->data;
+        return true;
+    }
+
+    // ==================== CONSULTAS ====================
+
+    /**
+     * @brief Check if the queue is empty (snapshot).
+     * @return true if the queue is empty, false otherwise.
+     */
+    bool isEmpty() const
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Get the current number of elements in the queue.
+     * @return Number of elements. While other threads are running this is only a snapshot.
+     */
+    unsigned int size() const
+    {
+        long n = count.load(std::memory_order_relaxed);
+        // Un dequeue puede descontar antes de que su enqueue sume
+        return n < 0 ? 0 : static_cast<unsigned int>(n);
+    }
+
+    /**
+     * @brief Get the maximum theoretical capacity of the queue.
+     * @return Always returns a very large number since list-based queues are only limited by available memory.
+     * @note This method is provided for interface compatibility with array-based queues.
+     */
+    unsigned int capacity() const
+    {
+        return -1;
+    }
+
+    /**
+     * @brief Check if the queue is full.
+     * @return Always returns false since list-based queues grow dynamically.
+     * @note This method is provided for interface compatibility with array-based queues.
+     */
+    bool isFull() const
+    {
+        return false;
+    }
+};
+
+#endif
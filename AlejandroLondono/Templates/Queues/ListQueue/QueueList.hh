@@ -2,11 +2,8 @@
 #define ListQueue_hh
 
 #include "list.hh"
-#include <iostream>
-
 #include <iostream>
 #include <stdexcept>
-#include "List.hh" // Include your List implementation
 
 using namespace std;
 
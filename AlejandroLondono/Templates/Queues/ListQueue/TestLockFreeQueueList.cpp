@@ -0,0 +1,192 @@
+#include <iostream>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "LockFreeQueueList.hh"
+
+// Compilar con: g++ -O2 -std=c++17 -pthread TestLockFreeQueueList.cpp -o TestLockFreeQueueList
+
+using namespace std;
+
+void testBasicOperations() {
+    cout << "\n=== TEST: Basic Operations (single thread) ===" << endl;
+
+    LockFreeQueueList<int> q;
+    cout << "Queue is empty: " << (q.isEmpty() ? "true" : "false") << endl;
+
+    q.enqueue(10);
+    q.enqueue(20);
+    q.enqueue(30);
+    int value = 0;
+    q.front(value);
+    cout << "Size: " << q.size() << ", Front: " << value << endl;
+
+    q.dequeue(value);
+    cout << "Dequeued: " << value << endl;
+    q.try_dequeue(value);
+    cout << "try_dequeue: " << value << endl;
+    q.dequeue(value);
+    cout << "Dequeued: " << value << ", size: " << q.size() << endl;
+
+    cout << "try_dequeue on empty queue: " << (q.try_dequeue(value) ? "true" : "false") << endl;
+    try {
+        q.dequeue(value);
+    } catch (const underflow_error& e) {
+        cout << "Dequeue on empty queue: " << e.what() << endl;
+    }
+    cout << "Is full: " << (q.isFull() ? "true" : "false") << " (should always be false)" << endl;
+}
+
+void testRecycling() {
+    cout << "\n=== TEST: Node Recycling (non-trivial type) ===" << endl;
+
+    LockFreeQueueList<string> q;
+    string out;
+    // Muchas vueltas para que los nodos retirados se reciclen varias veces
+    bool ok = true;
+    for (int round = 0; round < 2000; round++) {
+        for (int i = 0; i < 10; i++) {
+            q.enqueue("item-" + to_string(round) + "-" + to_string(i));
+        }
+        for (int i = 0; i < 10; i++) {
+            q.dequeue(out);
+            if (out != "item-" + to_string(round) + "-" + to_string(i)) {
+                ok = false;
+            }
+        }
+    }
+    cout << "FIFO order kept across 20000 recycled nodes: " << (ok ? "true" : "false") << endl;
+    cout << "Queue is empty at the end: " << (q.isEmpty() ? "true" : "false") << endl;
+}
+
+// Tipo cuya asignación falla a pedido, para probar que la cola no pierde slots
+struct Flaky {
+    static bool failAssign;
+    int value;
+
+    Flaky() : value(0) {}
+    Flaky(int v) : value(v) {}
+    Flaky(const Flaky& other) = default;
+    Flaky& operator=(const Flaky& other) {
+        if (failAssign) {
+            throw runtime_error("assignment failed");
+        }
+        value = other.value;
+        return *this;
+    }
+};
+
+bool Flaky::failAssign = false;
+
+void testThrowingAssignment() {
+    cout << "\n=== TEST: Element Assignment Throws ===" << endl;
+
+    // Solo 2 slots: si una excepción no devolviera su slot, la siguiente operación se quedaría esperando
+    LockFreeQueueList<Flaky, 2> q;
+    Flaky value(1);
+    q.enqueue(value);
+
+    int failed = 0;
+    Flaky::failAssign = true;
+    for (int i = 0; i < 10; i++) {
+        try {
+            q.enqueue(Flaky(i));
+        } catch (const runtime_error&) {
+            failed++;
+        }
+    }
+    cout << "Failed enqueues: " << failed << " of 10, size still: " << q.size() << endl;
+
+    Flaky out;
+    try {
+        q.try_dequeue(out);
+    } catch (const runtime_error&) {
+        failed++;
+    }
+    Flaky::failAssign = false;
+    cout << "Failed dequeue (element lost): " << (failed == 11 ? "true" : "false")
+         << ", size: " << q.size() << endl;
+
+    q.enqueue(Flaky(2));
+    q.enqueue(Flaky(3));
+    q.dequeue(out);
+    cout << "Queue still usable, dequeued: " << out.value << " (expected 2), size: " << q.size() << endl;
+}
+
+void testStress() {
+    cout << "\n=== TEST: Stress (4 producers, 4 consumers) ===" << endl;
+
+    const int PRODUCERS = 4;
+    const int CONSUMERS = 4;
+    const unsigned long long PER_PRODUCER = 200000;
+    LockFreeQueueList<unsigned long long> q;
+
+    atomic<unsigned long long> received(0);
+    atomic<unsigned long long> sum(0);
+    atomic<bool> orderOk(true);
+
+    vector<thread> threads;
+    for (int p = 0; p < PRODUCERS; p++) {
+        threads.emplace_back([&, p]() {
+            for (unsigned long long i = 0; i < PER_PRODUCER; i++) {
+                // Codificar el productor en los bits altos para verificar el orden FIFO por productor
+                q.enqueue((static_cast<unsigned long long>(p) << 32) | i);
+            }
+        });
+    }
+    for (int c = 0; c < CONSUMERS; c++) {
+        threads.emplace_back([&]() {
+            vector<long long> last(PRODUCERS, -1);
+            unsigned long long localSum = 0;
+            unsigned long long value;
+            while (received.load() < PRODUCERS * PER_PRODUCER) {
+                if (!q.try_dequeue(value)) {
+                    this_thread::yield();
+                    continue;
+                }
+                received++;
+                unsigned int producer = static_cast<unsigned int>(value >> 32);
+                long long seq = static_cast<long long>(value & 0xffffffffULL);
+                // Cada consumidor debe ver los elementos de un mismo productor en orden creciente
+                if (seq <= last[producer]) {
+                    orderOk = false;
+                }
+                last[producer] = seq;
+                localSum += value & 0xffffffffULL;
+            }
+            sum += localSum;
+        });
+    }
+    for (thread &t : threads) {
+        t.join();
+    }
+
+    unsigned long long expectedSum = PRODUCERS * (PER_PRODUCER * (PER_PRODUCER - 1) / 2);
+    cout << "Received: " << received.load() << " of " << PRODUCERS * PER_PRODUCER << endl;
+    cout << "Sum matches: " << (sum.load() == expectedSum ? "true" : "false") << endl;
+    cout << "Per-producer FIFO order: " << (orderOk.load() ? "true" : "false") << endl;
+    cout << "Queue is empty at the end: " << (q.isEmpty() ? "true" : "false") << endl;
+}
+
+int main() {
+    cout << "======================================" << endl;
+    cout << "   LOCK-FREE QUEUE LIST TEST SUITE    " << endl;
+    cout << "======================================" << endl;
+
+    try {
+        testBasicOperations();
+        testRecycling();
+        testThrowingAssignment();
+        testStress();
+
+        cout << "\n======================================" << endl;
+        cout << "        ALL TESTS COMPLETED!          " << endl;
+        cout << "======================================" << endl;
+    } catch (const exception& e) {
+        cerr << "Unexpected error: " << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -4,13 +4,16 @@
 
 #include <iostream>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 using namespace std;
 
-/*1. Array<T> buffer
+/*1. Array<T> *buffer
 
-Qué es: El contenedor que almacena los datos
-Por qué: Necesitas donde guardar los elementos
+Qué es: El contenedor que almacena los datos (buffer circular)
+Por qué: Necesitas donde guardar los elementos. Es un puntero porque cuando
+se llena se reemplaza por un Array del doble de tamaño.
 
 2. unsigned int frontIdx
 
@@ -18,58 +21,116 @@ Qué es: Índice del primer elemento en la queue
 Por qué: Como no puedes "mover" elementos físicamente, necesitas saber dónde está el frente
 Ejemplo: Si tienes [_, _, 10, 20, 30] → frontIdx = 2
 
-3. unsigned int rearIdx
+3. Posición del final
 
-Qué es: Índice donde se insertará el próximo elemento
-Por qué: Necesitas saber dónde agregar el siguiente elemento
-Ejemplo: Si tienes [_, _, 10, 20, 30] → rearIdx = 5 (siguiente posición libre)
+Qué es: (frontIdx + sz) & mask, donde se insertará el próximo elemento
+Por qué: Al dar la vuelta al buffer ya no basta con un rearIdx que solo crece;
+se calcula a partir del frente y del tamaño.
+Ejemplo: cap = 8, frontIdx = 6, sz = 3 → [30, _, _, _, _, _, 10, 20], el próximo va en 1
 
 4. unsigned int sz
 
 Qué es: Cantidad actual de elementos
 Por qué: El Array siempre tiene el mismo tamaño físico, pero la queue puede tener menos elementos
-Ejemplo: Array de tamaño 10, pero queue con 3 elementos → sz = 3
+Ejemplo: Array de tamaño 16, pero queue con 3 elementos → sz = 3
 
 5. unsigned int cap
 
-Qué es: Capacidad máxima
-Por qué: Para saber cuándo la queue está llena y evitar overflow*/
+Qué es: Capacidad actual, siempre potencia de dos
+Por qué: Con cap = 2^k, "i % cap" es lo mismo que "i & (cap - 1)", y un AND
+es mucho más barato que una división en cada operación.*/
 
 /**
- * @brief A basic queue implementation using a fixed-size array.
+ * @brief A growable double-ended queue implemented as a ring buffer.
  *
- * This class implements a FIFO (First In, First Out) queue using an underlying
- * fixed-size Array. Elements are added at the rear and removed from the front.
- * The queue has a maximum capacity determined at construction time.
+ * Elements live in a circular Array whose capacity is always a power of two,
+ * so positions wrap with a mask instead of a modulo. When the buffer is full
+ * it doubles its capacity and copies the elements in order starting at
+ * index 0 (linearizes), so the queue never reports a false overflow no
+ * matter how many enqueue/dequeue cycles it goes through.
  *
- * @tparam T Type of elements stored in the queue.
+ * @tparam T Type of elements stored in the queue. It must be default-constructible:
+ *           Array<T> default-constructs every slot, and grow() move-assigns into them.
  */
 template <typename T>
 class Queue
 {
+    static_assert(std::is_default_constructible<T>::value, "Queue<T> requires a default-constructible T");
+
 private:
-    Array<T> buffer;       ///< Underlying array to store queue elements.
+    Array<T> *buffer;      ///< Underlying circular array to store queue elements.
     unsigned int frontIdx; ///< Index of the front element.
-    unsigned int rearIdx;  ///< Index where the next element will be inserted.
     unsigned int sz;       ///< Current number of elements in the queue.
-    unsigned int cap;      ///< Maximum capacity of the queue.
+    unsigned int cap;      ///< Current capacity of the buffer (power of two).
+
+    static const unsigned int MAX_CAPACITY = ~0u / 2 + 1; ///< Largest power of two that fits in unsigned int.
+
+    /**
+     * @brief Smallest power of two greater than or equal to n (at least 1).
+     * @param n Requested capacity.
+     * @return Rounded capacity.
+     * @throws std::length_error if n is greater than MAX_CAPACITY.
+     */
+    static unsigned int roundUpPow2(unsigned int n)
+    {
+        if (n > MAX_CAPACITY)
+            throw length_error("Queue capacity too large");
+        unsigned int p = 1;
+        while (p < n)
+            p <<= 1;
+        return p;
+    }
+
+    /**
+     * @brief Physical index of the i-th element counting from the front.
+     * @param i Logical position (0 = front).
+     * @return Index inside buffer.
+     */
+    unsigned int slot(unsigned int i) const
+    {
+        return (frontIdx + i) & (cap - 1);
+    }
+
+    /**
+     * @brief Double the capacity and move the elements in order to the new buffer.
+     * @throws std::length_error if the capacity is already MAX_CAPACITY.
+     */
+    void grow()
+    {
+        if (cap == MAX_CAPACITY)
+            throw length_error("Queue capacity too large");
+        unsigned int newCap = cap * 2;
+        Array<T> *newBuffer = new Array<T>(newCap);
+        for (unsigned int i = 0; i < sz; i++)
+        {
+            (*newBuffer)[i] = std::move((*buffer)[slot(i)]);
+        }
+        delete buffer;
+        buffer = newBuffer;
+        cap = newCap;
+        frontIdx = 0;
+    }
 
 public:
     /**
-     * @brief Constructor with fixed capacity.
-     * @param capacity Maximum number of elements the queue can hold.
+     * @brief Constructor with initial capacity.
+     * @param capacity Initial number of slots; it is rounded up to a power of two.
      * @throws std::invalid_argument if capacity is 0.
+     * @throws std::length_error if capacity is greater than 2^31.
      */
-    explicit Queue(unsigned int capacity) : buffer(capacity, T{}), cap(capacity), frontIdx(0), rearIdx(0), sz(0)
+    explicit Queue(unsigned int capacity = 8) : buffer(nullptr), frontIdx(0), sz(0), cap(0)
     {
-        // Cuerpo vacío - todo se hace en lista de inicialización
+        if (capacity == 0)
+            throw invalid_argument("Capacity must be greater than 0");
+        cap = roundUpPow2(capacity);
+        buffer = new Array<T>(cap, T{});
     }
 
     /**
      * @brief Copy constructor. Creates a deep copy of another queue.
      * @param other Queue to copy.
      */
-    Queue(const Queue<T> &other) : buffer(other.buffer), cap(other.cap), frontIdx(other.frontIdx), rearIdx(other.rearIdx), sz(other.sz)
+    Queue(const Queue<T> &other) : buffer(new Array<T>(*other.buffer)), frontIdx(other.frontIdx), sz(other.sz), cap(other.cap)
     {
         // Cuerpo vacío - todo se hace en lista de inicialización
     }
@@ -78,58 +139,111 @@ public:
      * @brief Assignment operator. Assigns the contents of another queue to this queue.
      * @param other Queue to copy.
      * @return Reference to this queue.
-     * @throws std::invalid_argument if queues have different capacities.
+     * @note Queues with different capacities can be assigned; the buffer is replaced.
      */
     Queue<T> &operator=(const Queue<T> &other)
     {
         if (this != &other)
         {
-            if (cap != other.cap)
-                throw invalid_argument("Queues must have the same capacity for assignment");
-
-            buffer = other.buffer;
+            Array<T> *newBuffer = new Array<T>(*other.buffer);
+            delete buffer;
+            buffer = newBuffer;
             frontIdx = other.frontIdx;
-            rearIdx = other.rearIdx;
             sz = other.sz;
+            cap = other.cap;
         }
         return *this;
     }
 
     /**
-     * @brief Destructor. No explicit cleanup needed (Array handles its own memory).
+     * @brief Destructor. Frees the buffer.
      */
-    ~Queue() = default;
+    ~Queue()
+    {
+        delete buffer;
+    }
+
+    // ==================== OPERACIONES DE DEQUE ====================
 
     /**
-     * @brief Add an element to the rear of the queue.
-     * @param val Value to add to the queue.
-     * @throws std::overflow_error if the queue is full.
+     * @brief Add an element at the rear. Grows the buffer if it is full.
+     * @param val Value to add.
+     * @throws std::length_error if the queue is full and already at MAX_CAPACITY.
      */
-    void enqueue(const T &val)
+    void push_back(const T &val)
+    {
+        if (sz == cap)
+        {
+            T temp(val); // val puede ser un elemento de esta misma queue
+            grow();
+            (*buffer)[slot(sz)] = std::move(temp);
+        }
+        else
+        {
+            (*buffer)[slot(sz)] = val;
+        }
+        sz++;
+    }
+
+    /**
+     * @brief Add an element at the front. Grows the buffer if it is full.
+     * @param val Value to add.
+     * @throws std::length_error if the queue is full and already at MAX_CAPACITY.
+     */
+    void push_front(const T &val)
     {
+        T temp(val); // val puede ser un elemento de esta misma queue
         if (sz == cap)
-            throw std::overflow_error("Queue is full");
-        buffer[rearIdx] = val;
-        rearIdx++;
+            grow();
+        frontIdx = (frontIdx - 1) & (cap - 1);
+        (*buffer)[frontIdx] = std::move(temp);
         sz++;
     }
 
     /**
-     * @brief Remove the front element from the queue.
+     * @brief Remove the front element.
      * @throws std::underflow_error if the queue is empty.
      */
-    void dequeue()
+    void pop_front()
     {
         if (sz == 0)
             throw std::underflow_error("queue is empty");
 
-        frontIdx++;
+        frontIdx = (frontIdx + 1) & (cap - 1);
         sz--;
+    }
 
-        if (sz == 0) // Reset cuando queda vacía
-        {
-            frontIdx = rearIdx = 0;
-        }
+    /**
+     * @brief Remove the rear element.
+     * @throws std::underflow_error if the queue is empty.
+     */
+    void pop_back()
+    {
+        if (sz == 0)
+            throw std::underflow_error("queue is empty");
+
+        sz--;
+    }
+
+    // ==================== OPERACIONES DE QUEUE ====================
+
+    /**
+     * @brief Add an element to the rear of the queue.
+     * @param val Value to add to the queue.
+     * @note Never overflows: the buffer grows when it is full.
+     */
+    void enqueue(const T &val)
+    {
+        push_back(val);
+    }
+
+    /**
+     * @brief Remove the front element from the queue.
+     * @throws std::underflow_error if the queue is empty.
+     */
+    void dequeue()
+    {
+        pop_front();
     }
 
     /**
@@ -142,7 +256,7 @@ public:
         if (sz == 0)
             throw std::underflow_error("queue is empty");
 
-        return buffer[frontIdx];
+        return (*buffer)[frontIdx];
     }
 
     /**
@@ -155,7 +269,7 @@ public:
         if (sz == 0)
             throw std::underflow_error("queue is empty");
 
-        return buffer[frontIdx];
+        return (*buffer)[frontIdx];
     }
 
     /**
@@ -168,7 +282,7 @@ public:
         if (sz == 0)
             throw std::underflow_error("queue is empty");
 
-        return buffer[rearIdx - 1];
+        return (*buffer)[slot(sz - 1)];
     }
 
     /**
@@ -181,7 +295,33 @@ public:
         if (sz == 0)
             throw std::underflow_error("queue is empty");
 
-        return buffer[rearIdx - 1];
+        return (*buffer)[slot(sz - 1)];
+    }
+
+    /**
+     * @brief Access the i-th element counting from the front.
+     * @param index Position (0 = front).
+     * @return Reference to the element.
+     * @throws std::out_of_range if the index is out of bounds.
+     */
+    T &at(unsigned int index)
+    {
+        if (index >= sz)
+            throw out_of_range("Index out of range");
+        return (*buffer)[slot(index)];
+    }
+
+    /**
+     * @brief Access the i-th element counting from the front (const version).
+     * @param index Position (0 = front).
+     * @return Const reference to the element.
+     * @throws std::out_of_range if the index is out of bounds.
+     */
+    const T &at(unsigned int index) const
+    {
+        if (index >= sz)
+            throw out_of_range("Index out of range");
+        return (*buffer)[slot(index)];
     }
 
     /**
@@ -195,11 +335,12 @@ public:
 
     /**
      * @brief Check if the queue is full.
-     * @return true if the queue is full, false otherwise.
+     * @return Always false, since the buffer grows when it runs out of room.
+     * @note Kept for interface compatibility with the fixed-size queues.
      */
     bool isFull() const
     {
-        return sz == cap;
+        return false;
     }
 
     /**
@@ -212,8 +353,8 @@ public:
     }
 
     /**
-     * @brief Get the maximum capacity of the queue.
-     * @return The maximum number of elements the queue can hold.
+     * @brief Get the current capacity of the buffer.
+     * @return The number of elements the queue can hold before growing again.
      */
     unsigned int capacity() const
     {
@@ -227,25 +368,23 @@ public:
     void clear()
     {
         frontIdx = 0;
-        rearIdx = 0;
         sz = 0;
     }
 
     /**
-     * @brief Check if two queues are equal (same capacity, size, and elements in same order).
+     * @brief Check if two queues are equal (same size and elements in same order).
      * @param other Queue to compare with.
      * @return true if queues are equal, false otherwise.
+     * @note The capacity is not compared since it depends on the growth history.
      */
     bool operator==(const Queue<T> &other) const
     {
-        if (cap != other.cap)
-            return false;
         if (sz != other.sz)
             return false;
 
         for (unsigned int i = 0; i < sz; i++)
         {
-            if (buffer[frontIdx + i] != other.buffer[other.frontIdx + i])
+            if ((*buffer)[slot(i)] != (*other.buffer)[other.slot(i)])
                 return false;
         }
         return true;
@@ -276,8 +415,7 @@ public:
         cout << "Front -> ";
         for (unsigned int i = 0; i < sz; i++)
         {
-            unsigned int index = frontIdx + i;
-            cout << buffer[index];
+            cout << (*buffer)[slot(i)];
             if (i < sz - 1)
             {
                 cout << " -> ";
@@ -287,4 +425,4 @@ public:
     }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -6,7 +6,7 @@ using namespace std;
 void testBasicOperations() {
     cout << "\n=== TEST: Basic Operations ===" << endl;
     
-    Queue<int> q(5);  // Queue con capacidad 5
+    Queue<int> q(5);  // Queue con capacidad 5 (se redondea a 8)
     
     // Test isEmpty when new
     cout << "Queue is empty: " << (q.isEmpty() ? "true" : "false") << endl;
@@ -33,30 +33,29 @@ void testBasicOperations() {
 void testEdgeCases() {
     cout << "\n=== TEST: Edge Cases ===" << endl;
     
-    Queue<int> q(3);  // Queue pequeña para probar límites
+    Queue<int> q(4);  // Queue pequeña para probar límites
     
     // Test fill to capacity
     cout << "Filling queue to capacity..." << endl;
     q.enqueue(1);
     q.enqueue(2);
     q.enqueue(3);
+    q.enqueue(4);
     
-    cout << "Is full: " << (q.isFull() ? "true" : "false") << endl;
+    cout << "Capacity: " << q.capacity() << ", Is full: " << (q.isFull() ? "true" : "false") << endl;
     q.print();
     
-    // Test overflow
-    cout << "\nTrying to enqueue when full..." << endl;
-    try {
-        q.enqueue(4);
-    } catch (const overflow_error& e) {
-        cout << "Caught overflow error: " << e.what() << endl;
-    }
+    // Ya no hay overflow: la queue crece
+    cout << "\nEnqueuing past the initial capacity (should grow, not throw)..." << endl;
+    q.enqueue(5);
+    cout << "Capacity after growth: " << q.capacity() << " (expected 8)" << endl;
+    q.print();
     
     // Test empty queue
     cout << "\nEmptying queue completely..." << endl;
-    q.dequeue(); // Remove 1
-    q.dequeue(); // Remove 2  
-    q.dequeue(); // Remove 3
+    while (!q.isEmpty()) {
+        q.dequeue();
+    }
     
     cout << "Is empty: " << (q.isEmpty() ? "true" : "false") << endl;
     cout << "Size: " << q.size() << endl;
@@ -109,44 +108,71 @@ void testCopyAndAssignment() {
     cout << "q1 == q2: " << (q1 == q2 ? "true" : "false") << endl;
     cout << "q1 == q3: " << (q1 == q3 ? "true" : "false") << endl;
     
-    // Test assignment with different capacity
-    cout << "\nTrying assignment with different capacity..." << endl;
-    Queue<int> q4(3);  // Different capacity
-    try {
-        q4 = q1;
-    } catch (const invalid_argument& e) {
-        cout << "Caught invalid_argument: " << e.what() << endl;
-    }
+    // Test assignment with different capacity (now allowed)
+    cout << "\nAssignment with different capacity..." << endl;
+    Queue<int> q4(32);  // Different capacity
+    q4 = q1;
+    cout << "q4 after assignment (capacity " << q4.capacity() << "):" << endl;
+    q4.print();
+    cout << "q1 == q4: " << (q1 == q4 ? "true" : "false") << endl;
 }
 
-void testQueueReset() {
-    cout << "\n=== TEST: Queue Reset Feature ===" << endl;
+void testWraparound() {
+    cout << "\n=== TEST: Wraparound (No False Overflow) ===" << endl;
     
-    Queue<int> q(5);
+    Queue<int> q(4);
     
-    // Fill partially, then empty completely
-    cout << "Adding and removing elements to test reset..." << endl;
+    // Antes la queue decía estar llena cuando rearIdx llegaba al final,
+    // aunque el frente ya se hubiera vaciado.
+    cout << "Enqueue 1..4, dequeue 2, enqueue 5, 6..." << endl;
     q.enqueue(1);
     q.enqueue(2);
     q.enqueue(3);
-    
-    cout << "Before dequeue operations:" << endl;
-    q.print();
-    
+    q.enqueue(4);
     q.dequeue();
     q.dequeue();
-    cout << "After 2 dequeues (should have 1 element):" << endl;
+    q.enqueue(5);
+    q.enqueue(6);
     q.print();
-    
-    q.dequeue();  // This should trigger reset
-    cout << "After final dequeue (should be empty and reset):" << endl;
+    cout << "Capacity still " << q.capacity() << " (reused freed slots)" << endl;
+    
+    cout << "\nSustained producer/consumer traffic (100000 cycles)..." << endl;
+    bool ok = true;
+    int expected = 3;
+    for (int i = 7; i < 100007; i++) {
+        q.enqueue(i);
+        if (q.front() != expected) ok = false;
+        q.dequeue();
+        expected++;
+    }
+    cout << "Order preserved: " << (ok ? "true" : "false")
+         << ", Size: " << q.size() << ", Capacity: " << q.capacity() << endl;
+}
+
+void testDequeOperations() {
+    cout << "\n=== TEST: Deque Operations (both ends) ===" << endl;
+    
+    Queue<int> q(2);
+    q.push_back(2);
+    q.push_back(3);
+    q.push_front(1);   // crece y linealiza
+    q.push_front(0);
+    q.push_back(4);
+    cout << "After push_front/push_back (expected 0..4):" << endl;
     q.print();
+    cout << "at(2): " << q.at(2) << ", Capacity: " << q.capacity() << endl;
     
-    // Add elements again to see if it starts from beginning
-    cout << "Adding elements after reset:" << endl;
-    q.enqueue(10);
-    q.enqueue(20);
+    q.pop_back();
+    q.pop_front();
+    cout << "After pop_back and pop_front (expected 1..3):" << endl;
     q.print();
+    
+    cout << "Trying at(10)..." << endl;
+    try {
+        q.at(10);
+    } catch (const out_of_range& e) {
+        cout << "Caught out_of_range: " << e.what() << endl;
+    }
 }
 
 void testClear() {
@@ -173,6 +199,19 @@ void testClear() {
     q.print();
 }
 
+void testCapacityLimits() {
+    cout << "\n=== TEST: Capacity Limits ===" << endl;
+
+    // Más de 2^31 no se puede redondear a una potencia de dos en unsigned int
+    cout << "Creating a queue with capacity 2^31 + 1..." << endl;
+    try {
+        Queue<int> q(0x80000001u);
+        cout << "No exception (unexpected), capacity: " << q.capacity() << endl;
+    } catch (const length_error& e) {
+        cout << "Caught length error: " << e.what() << endl;
+    }
+}
+
 int main() {
     cout << "Testing Queue Implementation" << endl;
     cout << "============================" << endl;
@@ -180,8 +219,10 @@ int main() {
     testBasicOperations();
     testEdgeCases();
     testCopyAndAssignment();
-    testQueueReset();
+    testWraparound();
+    testDequeOperations();
     testClear();
+    testCapacityLimits();
     
     cout << "\n=== All Tests Completed ===" << endl;
     return 0;
@@ -0,0 +1,719 @@
+/**
+ * @file ConcurrentRedBlackTree.hh
+ * @brief Árbol Rojo-Negro persistente para muchos lectores sin locks y escritores serializados
+ */
+
+#ifndef __CONCURRENT_RED_BLACK_TREE__
+#define __CONCURRENT_RED_BLACK_TREE__
+
+#include "RedBlackTree.hh"
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/*1. Nodos persistentes con copia de camino
+
+Qué es: Un nodo nunca cambia después de creado. Insertar o eliminar copia
+solo los O(log n) nodos del camino hasta la clave (con las rotaciones
+escritas como reconstrucciones, al estilo de Okasaki y Kahrs) y comparte el
+resto con la versión anterior
+Por qué: Un lector que tomó la raíz vieja sigue viendo un árbol completo y
+válido aunque el escritor publique otra versión mientras tanto.
+
+2. Publicación atómica de la raíz
+
+Qué es: La versión actual es un std::atomic<Node *>; el escritor arma la
+nueva versión aparte y la publica con un solo store
+Por qué: Los lectores nunca ven un árbol a medio rebalancear ni toman locks,
+y los escritores se serializan con un mutex que los lectores no tocan.
+
+3. Reclamación por épocas (RCU)
+
+Qué es: Cada lectura anuncia la época global en un slot; los nodos que dejan
+de ser alcanzables se retiran en la época actual y se liberan dos épocas
+después. La época solo avanza cuando todos los lectores activos ya la vieron
+Por qué: Liberar un nodo en cuanto sale del árbol rompería a los lectores que
+todavía lo recorren. Con épocas el lector no escribe nada por nodo visitado
+(a diferencia de los hazard pointers de LockFreeQueueList), solo su slot al
+entrar y al salir.
+
+4. Conteo de referencias solo del escritor
+
+Qué es: Cada nodo cuenta cuántos padres (o la raíz) lo apuntan; el contador
+lo toca únicamente el escritor, con el mutex tomado
+Por qué: Un nodo compartido entre versiones no se puede retirar mientras la
+versión actual lo use. Cuando su cuenta llega a cero ya solo lo ven lectores
+viejos, así que pasa a la lista de retirados. Los lectores no pagan atomics
+por nodo.
+
+5. Slots prestados por lectura
+
+Qué es: Cada lectura toma uno de MaxThreads slots y lo devuelve al terminar,
+empezando por "su" slot (hash del id del hilo)
+Por qué: Igual que en LockFreeQueueList: no hay que registrar hilos y cada
+lector escribe en su propia línea de caché, así las lecturas escalan.*/
+
+/**
+ * @class ConcurrentRedBlackTree
+ * @brief Mapa ordenado Key -> Value con lecturas concurrentes sin locks
+ * @tparam Key Tipo de las claves (debe ser comparable y copiable)
+ * @tparam Value Tipo de los valores (debe ser copiable)
+ * @tparam MaxThreads Número de slots de lectura, es decir, cuántas lecturas
+ *         pueden estar en curso a la vez sin esperar un slot libre
+ *
+ * Las lecturas (find, get, forEachInRange, snapshot, size) se pueden llamar
+ * desde cualquier número de hilos mientras otros hilos escriben (insert,
+ * remove, clear). Cada lectura ve una única versión consistente del árbol.
+ */
+template <typename Key, typename Value, unsigned int MaxThreads = 64>
+class ConcurrentRedBlackTree
+{
+private:
+    static const std::size_t CACHE_LINE = 64;      ///< Tamaño de línea de caché asumido
+    static const unsigned long long IDLE = 0;      ///< Época de un slot sin lector
+    static const unsigned int EPOCH_BUCKETS = 3;   ///< Listas de retirados (época actual y las dos anteriores)
+
+    /**
+     * @struct Node
+     * @brief Nodo inmutable: solo refs cambia después de la construcción
+     */
+    struct Node
+    {
+        const Key key;      ///< Clave del nodo
+        const Value value;  ///< Valor asociado
+        Node *const left;   ///< Hijo izquierdo (nullptr si no hay)
+        Node *const right;  ///< Hijo derecho (nullptr si no hay)
+        const Color color;  ///< Color del nodo
+        unsigned int refs;  ///< Padres y raíces que lo apuntan (solo lo usa el escritor)
+
+        /**
+         * @brief Crea un nodo que toma una referencia a cada hijo
+         */
+        Node(Color c, Node *l, const Key &k, const Value &v, Node *r)
+            : key(k), value(v), left(l), right(r), color(c), refs(0)
+        {
+            if (l != nullptr)
+                l->refs++;
+            if (r != nullptr)
+                r->refs++;
+        }
+    };
+
+    /**
+     * @brief Slot de lectura, prestado a una lectura a la vez
+     */
+    struct alignas(CACHE_LINE) Slot
+    {
+        std::atomic<unsigned long long> epoch; ///< Época anunciada por el lector (IDLE si está libre)
+
+        Slot() : epoch(IDLE) {}
+    };
+
+    /**
+     * @brief Referencia del escritor a un nodo (suelta la referencia al destruirse)
+     *
+     * Las funciones de copia de camino reciben nodos prestados (Node *) y
+     * devuelven Ref. Un nodo creado y descartado en la misma escritura se
+     * retira como cualquier otro.
+     */
+    class Ref
+    {
+    private:
+        ConcurrentRedBlackTree *owner; ///< Árbol dueño de las listas de retirados
+        Node *node;                    ///< Nodo referenciado (puede ser nullptr)
+
+    public:
+        Ref(ConcurrentRedBlackTree *tree, Node *x) : owner(tree), node(x)
+        {
+            if (node != nullptr)
+                node->refs++;
+        }
+
+        Ref(const Ref &other) : Ref(other.owner, other.node) {}
+
+        Ref(Ref &&other) : owner(other.owner), node(other.node)
+        {
+            other.node = nullptr;
+        }
+
+        Ref &operator=(const Ref &) = delete;
+
+        ~Ref()
+        {
+            owner->release(node);
+        }
+
+        Node *get() const { return node; }
+        Node *operator->() const { return node; }
+
+        /**
+         * @brief Entrega la referencia sin soltarla (pasa a ser de la raíz)
+         */
+        Node *detach()
+        {
+            Node *x = node;
+            node = nullptr;
+            return x;
+        }
+    };
+
+    alignas(CACHE_LINE) std::atomic<Node *> root;           ///< Versión publicada (nullptr si está vacío)
+    std::atomic<unsigned long long> globalEpoch;            ///< Época actual (empieza en 1)
+    std::atomic<unsigned int> count;                        ///< Número de elementos de la versión publicada
+    alignas(CACHE_LINE) std::mutex writeMutex;              ///< Serializa a los escritores
+    std::vector<Node *> retired[EPOCH_BUCKETS];             ///< Nodos retirados, por época módulo 3
+    Slot *slots;                                            ///< MaxThreads slots de lectura
+
+    // ==================== LECTORES Y ÉPOCAS ====================
+
+    /**
+     * @brief Toma un slot libre y anuncia la época actual
+     * @return Slot del lector hasta exitRead
+     *
+     * Todo es seq_cst: si el escritor vio el slot libre al avanzar la época,
+     * la carga de la raíz que sigue ya ve la versión publicada antes.
+     */
+    Slot &enterRead() const
+    {
+        // Cada hilo empieza en su propio slot para no competir con los demás
+        static thread_local unsigned int start =
+            static_cast<unsigned int>(std::hash<std::thread::id>()(std::this_thread::get_id()) % MaxThreads);
+        while (true)
+        {
+            unsigned long long epoch = globalEpoch.load(std::memory_order_seq_cst);
+            for (unsigned int i = 0; i < MaxThreads; i++)
+            {
+                Slot &slot = slots[(start + i) % MaxThreads];
+                unsigned long long expected = IDLE;
+                if (slot.epoch.load(std::memory_order_relaxed) == IDLE &&
+                    slot.epoch.compare_exchange_strong(expected, epoch, std::memory_order_seq_cst))
+                    return slot;
+            }
+            // Más de MaxThreads lecturas en curso: esperar a que alguna termine
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @brief Devuelve el slot; los nodos leídos ya se pueden liberar
+     */
+    void exitRead(Slot &slot) const
+    {
+        slot.epoch.store(IDLE, std::memory_order_release);
+    }
+
+    /**
+     * @brief Sección de lectura: anuncia la época mientras existe
+     */
+    class ReadGuard
+    {
+    private:
+        const ConcurrentRedBlackTree &tree;
+        Slot &slot;
+
+    public:
+        explicit ReadGuard(const ConcurrentRedBlackTree &t) : tree(t), slot(t.enterRead()) {}
+        ReadGuard(const ReadGuard &) = delete;
+        ReadGuard &operator=(const ReadGuard &) = delete;
+        ~ReadGuard() { tree.exitRead(slot); }
+
+        /**
+         * @brief Raíz de la versión que verá esta lectura
+         */
+        const Node *root() const { return tree.root.load(std::memory_order_seq_cst); }
+    };
+
+    /**
+     * @brief Avanza la época si todos los lectores activos ya anunciaron la actual
+     *
+     * Al pasar a la época e + 1 se liberan los nodos retirados en e - 1:
+     * cualquier lector que pudiera verlos anunció una época <= e - 1 y ya salió.
+     * Solo lo llama el escritor.
+     */
+    void tryAdvance()
+    {
+        unsigned long long epoch = globalEpoch.load(std::memory_order_relaxed);
+        for (unsigned int i = 0; i < MaxThreads; i++)
+        {
+            unsigned long long announced = slots[i].epoch.load(std::memory_order_seq_cst);
+            if (announced != IDLE && announced != epoch)
+                return;
+        }
+        globalEpoch.store(epoch + 1, std::memory_order_seq_cst);
+        freeNodes(retired[(epoch + 2) % EPOCH_BUCKETS]);
+    }
+
+    /**
+     * @brief Libera una lista de retirados
+     */
+    static void freeNodes(std::vector<Node *> &list)
+    {
+        for (Node *x : list)
+            delete x;
+        list.clear();
+    }
+
+    /**
+     * @brief Suelta una referencia; los nodos que quedan sin referencias se retiran
+     * @complexity O(nodos retirados)
+     */
+    void release(Node *x)
+    {
+        while (x != nullptr && --x->refs == 0)
+        {
+            release(x->left);
+            Node *next = x->right;
+            retired[globalEpoch.load(std::memory_order_relaxed) % EPOCH_BUCKETS].push_back(x);
+            x = next;
+        }
+    }
+
+    /**
+     * @brief Publica una nueva versión y retira lo que solo usaba la anterior
+     * @param next Nueva raíz (su referencia pasa a ser de la raíz)
+     */
+    void publish(Ref next)
+    {
+        Node *old = root.load(std::memory_order_relaxed);
+        root.store(next.detach(), std::memory_order_seq_cst);
+        release(old);
+        tryAdvance();
+    }
+
+    // ==================== COPIA DE CAMINO ====================
+
+    static bool isRed(const Node *x) { return x != nullptr && x->color == RED; }
+    static bool isBlack(const Node *x) { return x != nullptr && x->color == BLACK; }
+
+    /**
+     * @brief Crea un nodo nuevo que comparte los hijos dados
+     */
+    Ref make(Color c, Node *l, const Key &k, const Value &v, Node *r)
+    {
+        return Ref(this, new Node(c, l, k, v, r));
+    }
+
+    /**
+     * @brief Copia de x con otro color
+     */
+    Ref recolor(Node *x, Color c)
+    {
+        return make(c, x->left, x->key, x->value, x->right);
+    }
+
+    /**
+     * @brief Nodo NEGRO (k, v) con hijos l y r, corrigiendo un rojo-rojo debajo
+     * @return Subárbol con la misma altura negra
+     *
+     * Los cuatro casos de Okasaki más el de Kahrs (dos hijos rojos), que
+     * necesita la eliminación.
+     */
+    Ref balance(Node *l, const Key &k, const Value &v, Node *r)
+    {
+        if (isRed(l) && isRed(r))
+            return make(RED, recolor(l, BLACK).get(), k, v, recolor(r, BLACK).get());
+        if (isRed(l) && isRed(l->left))
+            return make(RED, recolor(l->left, BLACK).get(), l->key, l->value,
+                        make(BLACK, l->right, k, v, r).get());
+        if (isRed(l) && isRed(l->right))
+            return make(RED, make(BLACK, l->left, l->key, l->value, l->right->left).get(),
+                        l->right->key, l->right->value, make(BLACK, l->right->right, k, v, r).get());
+        if (isRed(r) && isRed(r->right))
+            return make(RED, make(BLACK, l, k, v, r->left).get(), r->key, r->value,
+                        recolor(r->right, BLACK).get());
+        if (isRed(r) && isRed(r->left))
+            return make(RED, make(BLACK, l, k, v, r->left->left).get(), r->left->key, r->left->value,
+                        make(BLACK, r->left->right, r->key, r->value, r->right).get());
+        return make(BLACK, l, k, v, r);
+    }
+
+    /**
+     * @brief Copia de un nodo NEGRO pintado de ROJO (baja su altura negra en 1)
+     */
+    Ref sub1(Node *x)
+    {
+        if (!isBlack(x))
+            throw std::logic_error("ConcurrentRedBlackTree: invariant violated in sub1");
+        return recolor(x, RED);
+    }
+
+    /**
+     * @brief Nodo (k, v) cuyo subárbol izquierdo bl perdió un nivel de altura negra
+     */
+    Ref balLeft(Node *bl, const Key &k, const Value &v, Node *r)
+    {
+        if (isRed(bl))
+            return make(RED, recolor(bl, BLACK).get(), k, v, r);
+        if (isBlack(r))
+            return balance(bl, k, v, recolor(r, RED).get());
+        if (isRed(r) && isBlack(r->left))
+            return make(RED, make(BLACK, bl, k, v, r->left->left).get(), r->left->key, r->left->value,
+                        balance(r->left->right, r->key, r->value, sub1(r->right).get()).get());
+        throw std::logic_error("ConcurrentRedBlackTree: invariant violated in balLeft");
+    }
+
+    /**
+     * @brief Nodo (k, v) cuyo subárbol derecho br perdió un nivel de altura negra
+     */
+    Ref balRight(Node *l, const Key &k, const Value &v, Node *br)
+    {
+        if (isRed(br))
+            return make(RED, l, k, v, recolor(br, BLACK).get());
+        if (isBlack(l))
+            return balance(recolor(l, RED).get(), k, v, br);
+        if (isRed(l) && isBlack(l->right))
+            return make(RED, balance(sub1(l->left).get(), l->key, l->value, l->right->left).get(),
+                        l->right->key, l->right->value, make(BLACK, l->right->right, k, v, br).get());
+        throw std::logic_error("ConcurrentRedBlackTree: invariant violated in balRight");
+    }
+
+    /**
+     * @brief Une dos subárboles de la misma altura negra (todas las claves de l < las de r)
+     */
+    Ref fuse(Node *l, Node *r)
+    {
+        if (l == nullptr)
+            return Ref(this, r);
+        if (r == nullptr)
+            return Ref(this, l);
+        if (l->color == BLACK && r->color == RED)
+            return make(RED, fuse(l, r->left).get(), r->key, r->value, r->right);
+        if (l->color == RED && r->color == BLACK)
+            return make(RED, l->left, l->key, l->value, fuse(l->right, r).get());
+
+        Ref s = fuse(l->right, r->left);
+        if (l->color == RED)
+        {
+            if (isRed(s.get()))
+                return make(RED, make(RED, l->left, l->key, l->value, s->left).get(), s->key, s->value,
+                            make(RED, s->right, r->key, r->value, r->right).get());
+            return make(RED, l->left, l->key, l->value, make(RED, s.get(), r->key, r->value, r->right).get());
+        }
+        if (isRed(s.get()))
+            return make(RED, make(BLACK, l->left, l->key, l->value, s->left).get(), s->key, s->value,
+                        make(BLACK, s->right, r->key, r->value, r->right).get());
+        return balLeft(l->left, l->key, l->value, make(BLACK, s.get(), r->key, r->value, r->right).get());
+    }
+
+    /**
+     * @brief Inserta o actualiza (k, v) en una copia del camino de t
+     * @param added Se pone en true si la clave no existía
+     */
+    Ref insertHelper(Node *t, const Key &k, const Value &v, bool &added)
+    {
+        if (t == nullptr)
+        {
+            added = true;
+            return make(RED, nullptr, k, v, nullptr);
+        }
+        if (k < t->key)
+        {
+            if (t->color == BLACK)
+                return balance(insertHelper(t->left, k, v, added).get(), t->key, t->value, t->right);
+            return make(RED, insertHelper(t->left, k, v, added).get(), t->key, t->value, t->right);
+        }
+        if (t->key < k)
+        {
+            if (t->color == BLACK)
+                return balance(t->left, t->key, t->value, insertHelper(t->right, k, v, added).get());
+            return make(RED, t->left, t->key, t->value, insertHelper(t->right, k, v, added).get());
+        }
+        return make(t->color, t->left, k, v, t->right);
+    }
+
+    /**
+     * @brief Elimina k (que debe estar en t) de una copia del camino de t
+     * @return Subárbol sin k; si t era NEGRO tiene un nivel menos de altura negra
+     */
+    Ref removeHelper(Node *t, const Key &k)
+    {
+        if (k < t->key)
+        {
+            if (isBlack(t->left))
+                return balLeft(removeHelper(t->left, k).get(), t->key, t->value, t->right);
+            return make(RED, removeHelper(t->left, k).get(), t->key, t->value, t->right);
+        }
+        if (t->key < k)
+        {
+            if (isBlack(t->right))
+                return balRight(t->left, t->key, t->value, removeHelper(t->right, k).get());
+            return make(RED, t->left, t->key, t->value, removeHelper(t->right, k).get());
+        }
+        return fuse(t->left, t->right);
+    }
+
+    /**
+     * @brief Pinta la raíz de NEGRO
+     */
+    Ref blackenRoot(Ref t)
+    {
+        if (isRed(t.get()))
+            return recolor(t.get(), BLACK);
+        return t;
+    }
+
+    // ==================== MÉTODOS AUXILIARES DE LECTURA ====================
+
+    /**
+     * @brief Busca el nodo con clave k en una versión
+     * @return Nodo encontrado o nullptr
+     */
+    static const Node *searchHelper(const Node *x, const Key &k)
+    {
+        while (x != nullptr)
+        {
+            if (k < x->key)
+                x = x->left;
+            else if (x->key < k)
+                x = x->right;
+            else
+                return x;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Visita en orden los nodos de x con clave en [lo, hi]
+     */
+    template <typename Fn>
+    static void forEachInRangeHelper(const Node *x, const Key &lo, const Key &hi, Fn &fn)
+    {
+        while (x != nullptr)
+        {
+            if (x->key < lo)
+            {
+                x = x->right;
+                continue;
+            }
+            forEachInRangeHelper(x->left, lo, hi, fn);
+            if (hi < x->key)
+                return;
+            fn(x->key, x->value);
+            x = x->right;
+        }
+    }
+
+    /**
+     * @brief Verifica colores, altura negra y orden de un subárbol
+     * @return Altura negra del subárbol, -1 si no es válido
+     */
+    static int verifyHelper(const Node *x, const Key *lo, const Key *hi, unsigned int &nodes)
+    {
+        if (x == nullptr)
+            return 0;
+        nodes++;
+        if ((lo != nullptr && !(*lo < x->key)) || (hi != nullptr && !(x->key < *hi)))
+            return -1;
+        if (isRed(x) && (isRed(x->left) || isRed(x->right)))
+            return -1;
+        int left = verifyHelper(x->left, lo, &x->key, nodes);
+        int right = verifyHelper(x->right, &x->key, hi, nodes);
+        if (left < 0 || left != right)
+            return -1;
+        return left + (x->color == BLACK ? 1 : 0);
+    }
+
+    /**
+     * @brief Libera un subárbol entero (solo en el destructor)
+     */
+    static void destroyHelper(Node *x)
+    {
+        while (x != nullptr && --x->refs == 0)
+        {
+            destroyHelper(x->left);
+            Node *next = x->right;
+            delete x;
+            x = next;
+        }
+    }
+
+public:
+    // ==================== CONSTRUCTORES Y DESTRUCTOR ====================
+
+    /**
+     * @brief Constructor por defecto: árbol vacío
+     * @complexity O(MaxThreads)
+     */
+    ConcurrentRedBlackTree() : root(nullptr), globalEpoch(1), count(0), slots(new Slot[MaxThreads]) {}
+
+    ConcurrentRedBlackTree(const ConcurrentRedBlackTree &) = delete;
+    ConcurrentRedBlackTree &operator=(const ConcurrentRedBlackTree &) = delete;
+
+    /**
+     * @brief Destructor: libera todas las versiones
+     *
+     * No debe haber lecturas ni escrituras en curso.
+     */
+    ~ConcurrentRedBlackTree()
+    {
+        destroyHelper(root.load(std::memory_order_relaxed));
+        for (unsigned int i = 0; i < EPOCH_BUCKETS; i++)
+            freeNodes(retired[i]);
+        delete[] slots;
+    }
+
+    // ==================== ESCRITURA ====================
+
+    /**
+     * @brief Inserta un par Key-Value (si la clave existe, actualiza el valor)
+     * @param k Clave a insertar
+     * @param v Valor asociado
+     * @complexity O(log n) nodos copiados, más O(MaxThreads) para avanzar la época
+     *
+     * Los lectores en curso siguen viendo la versión anterior.
+     */
+    void insert(const Key &k, const Value &v)
+    {
+        std::lock_guard<std::mutex> lock(writeMutex);
+        bool added = false;
+        publish(blackenRoot(insertHelper(root.load(std::memory_order_relaxed), k, v, added)));
+        if (added)
+            count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Elimina un elemento por clave
+     * @param k Clave a eliminar
+     * @return true si se eliminó, false si no existía
+     * @complexity O(log n) nodos copiados, más O(MaxThreads) para avanzar la época
+     */
+    bool remove(const Key &k)
+    {
+        std::lock_guard<std::mutex> lock(writeMutex);
+        Node *current = root.load(std::memory_order_relaxed);
+        if (searchHelper(current, k) == nullptr)
+            return false;
+        publish(blackenRoot(removeHelper(current, k)));
+        count.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief Elimina todos los elementos
+     * @complexity O(n) nodos retirados
+     */
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(writeMutex);
+        publish(Ref(this, nullptr));
+        count.store(0, std::memory_order_relaxed);
+    }
+
+    // ==================== LECTURA ====================
+
+    /**
+     * @brief Verifica si una clave existe
+     * @complexity O(log n), sin locks
+     */
+    bool find(const Key &k) const
+    {
+        ReadGuard guard(*this);
+        return searchHelper(guard.root(), k) != nullptr;
+    }
+
+    /**
+     * @brief Copia el valor asociado a una clave
+     * @param k Clave a buscar
+     * @param out Recibe una copia del valor si la clave existe
+     * @return true si la clave existe
+     * @complexity O(log n), sin locks
+     *
+     * Devuelve una copia y no un puntero: el nodo se puede liberar en cuanto
+     * termina la lectura.
+     */
+    bool get(const Key &k, Value &out) const
+    {
+        ReadGuard guard(*this);
+        const Node *x = searchHelper(guard.root(), k);
+        if (x == nullptr)
+            return false;
+        out = x->value;
+        return true;
+    }
+
+    /**
+     * @brief Visita en orden los elementos con clave en [lo, hi] de una misma versión
+     * @param lo Clave mínima del rango (incluida)
+     * @param hi Clave máxima del rango (incluida)
+     * @param fn Función llamada como fn(clave, valor)
+     * @complexity O(log n + k), sin locks
+     *
+     * Mientras fn corre, la época no avanza y los nodos retirados no se
+     * liberan: conviene que fn sea corta. fn no debe escribir en este árbol.
+     */
+    template <typename Fn>
+    void forEachInRange(const Key &lo, const Key &hi, Fn fn) const
+    {
+        ReadGuard guard(*this);
+        forEachInRangeHelper(guard.root(), lo, hi, fn);
+    }
+
+    /**
+     * @brief Copia la versión actual a un RedBlackTree
+     * @return Árbol con los mismos pares
+     * @complexity O(n)
+     */
+    RedBlackTree<Key, Value> snapshot() const
+    {
+        std::vector<std::pair<Key, Value>> pairs;
+        {
+            ReadGuard guard(*this);
+            std::vector<const Node *> stack;
+            const Node *x = guard.root();
+            while (x != nullptr || !stack.empty())
+            {
+                while (x != nullptr)
+                {
+                    stack.push_back(x);
+                    x = x->left;
+                }
+                x = stack.back();
+                stack.pop_back();
+                pairs.emplace_back(x->key, x->value);
+                x = x->right;
+            }
+        }
+        RedBlackTree<Key, Value> tree;
+        tree.buildFromSorted(pairs.begin(), pairs.end());
+        return tree;
+    }
+
+    /**
+     * @brief Número de elementos de la última versión publicada
+     * @complexity O(1)
+     */
+    unsigned int size() const { return count.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Verifica si el árbol está vacío
+     * @complexity O(1)
+     */
+    bool empty() const { return size() == 0; }
+
+    // ==================== OPERACIONES DE VERIFICACIÓN ====================
+
+    /**
+     * @brief Verifica las propiedades RBT y el orden de la versión actual
+     * @return true si es válida, false en caso contrario
+     * @complexity O(n)
+     *
+     * Con escritores activos, el tamaño puede no coincidir con la versión leída;
+     * llamarla cuando no haya escrituras en curso.
+     */
+    bool verifyProperties() const
+    {
+        ReadGuard guard(*this);
+        const Node *r = guard.root();
+        if (isRed(r))
+            return false;
+        unsigned int nodes = 0;
+        return verifyHelper(r, nullptr, nullptr, nodes) >= 0 && nodes == size();
+    }
+};
+
+#endif // __CONCURRENT_RED_BLACK_TREE__
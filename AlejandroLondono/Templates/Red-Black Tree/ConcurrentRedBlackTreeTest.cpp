@@ -0,0 +1,165 @@
+/**
+ * @file ConcurrentRedBlackTreeTest.cpp
+ * @brief Pruebas para la clase ConcurrentRedBlackTree
+ * @date 2025
+ *
+ * Compilar con: g++ -O2 -std=c++17 -pthread ConcurrentRedBlackTreeTest.cpp -o ConcurrentRedBlackTreeTest
+ */
+
+#include "ConcurrentRedBlackTree.hh"
+#include <atomic>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+void printHeader(const string &title)
+{
+    cout << "\n" << string(70, '=') << endl;
+    cout << "  " << title << endl;
+    cout << string(70, '=') << endl;
+}
+
+void printTest(const string &test, bool passed)
+{
+    cout << "[" << (passed ? "✓ PASS" : "✗ FAIL") << "] " << test << endl;
+}
+
+int main()
+{
+    cout << "\n╔══════════════════════════════════════════════════════════════════╗\n";
+    cout << "║          PRUEBAS DEL RED-BLACK TREE CONCURRENTE                  ║\n";
+    cout << "╚══════════════════════════════════════════════════════════════════╝\n";
+
+    // ==================== PRUEBA 1: Operaciones básicas ====================
+    printHeader("PRUEBA 1: insert, find, get y remove (un hilo)");
+
+    ConcurrentRedBlackTree<int, string> nombres;
+    printTest("Árbol nuevo vacío", nombres.empty() && nombres.size() == 0);
+    nombres.insert(20, "veinte");
+    nombres.insert(10, "diez");
+    nombres.insert(30, "treinta");
+    nombres.insert(10, "DIEZ");
+    string valor;
+    printTest("size() == 3 tras actualizar una clave", nombres.size() == 3);
+    printTest("get devuelve el valor actualizado", nombres.get(10, valor) && valor == "DIEZ");
+    printTest("find de clave inexistente", !nombres.find(15));
+    printTest("remove de clave inexistente devuelve false", !nombres.remove(15));
+    printTest("remove(20)", nombres.remove(20) && !nombres.find(20) && nombres.size() == 2);
+    printTest("Propiedades RBT", nombres.verifyProperties());
+    nombres.clear();
+    printTest("clear() deja el árbol vacío", nombres.empty() && !nombres.find(10) && nombres.verifyProperties());
+
+    // ==================== PRUEBA 2: Aleatorio contra std::map ====================
+    printHeader("PRUEBA 2: 100000 operaciones aleatorias contra std::map");
+
+    ConcurrentRedBlackTree<int, int> arbol;
+    map<int, int> referencia;
+    mt19937 rng(12345);
+    bool iguales = true;
+    bool validos = true;
+    for (int i = 0; i < 100000; i++)
+    {
+        int k = static_cast<int>(rng() % 5000);
+        if (rng() % 3 == 0)
+        {
+            if (arbol.remove(k) != (referencia.erase(k) == 1))
+                iguales = false;
+        }
+        else
+        {
+            arbol.insert(k, i);
+            referencia[k] = i;
+        }
+        if (i % 10000 == 0 && !arbol.verifyProperties())
+            validos = false;
+    }
+    for (const auto &kv : referencia)
+    {
+        int v;
+        if (!arbol.get(kv.first, v) || v != kv.second)
+            iguales = false;
+    }
+    printTest("Mismo contenido que std::map", iguales && arbol.size() == referencia.size());
+    printTest("Propiedades RBT durante y al final", validos && arbol.verifyProperties());
+
+    long long sumaArbol = 0, sumaMapa = 0;
+    arbol.forEachInRange(1000, 2000, [&](const int &k, const int &v) { sumaArbol += k + v; });
+    for (auto it = referencia.lower_bound(1000); it != referencia.end() && it->first <= 2000; ++it)
+        sumaMapa += it->first + it->second;
+    printTest("forEachInRange(1000, 2000)", sumaArbol == sumaMapa);
+
+    RedBlackTree<int, int> copia = arbol.snapshot();
+    printTest("snapshot() copia la versión actual", copia.size() == referencia.size() && copia.verifyProperties());
+
+    // Eliminar en orden ascendente y descendente ejercita todos los casos de fuse
+    for (int k = 0; k < 5000; k += 2)
+        arbol.remove(k);
+    for (int k = 4999; k >= 0; k -= 2)
+        arbol.remove(k);
+    printTest("Vaciar eliminando todas las claves", arbol.empty() && arbol.verifyProperties());
+
+    // ==================== PRUEBA 3: Lectores concurrentes ====================
+    printHeader("PRUEBA 3: 4 lectores y 1 escritor");
+
+    // Las claves pares siempre están; el escritor mete y saca impares
+    const int CLAVES = 20000;
+    ConcurrentRedBlackTree<int, int> indice;
+    for (int k = 0; k < CLAVES; k += 2)
+        indice.insert(k, k * 10);
+
+    atomic<bool> terminado(false);
+    atomic<bool> lecturasOk(true);
+    atomic<unsigned long long> lecturas(0);
+    vector<thread> lectores;
+    for (int t = 0; t < 4; t++)
+    {
+        lectores.emplace_back([&, t]() {
+            mt19937 local(t);
+            unsigned long long hechas = 0;
+            while (!terminado.load())
+            {
+                int k = static_cast<int>(local() % CLAVES) & ~1;
+                int v;
+                if (!indice.get(k, v) || v != k * 10)
+                    lecturasOk = false;
+
+                // Un rango es una sola versión: las pares consecutivas están todas
+                int anterior = -2;
+                indice.forEachInRange(k, k + 40, [&](const int &clave, const int &) {
+                    if (clave % 2 == 0)
+                    {
+                        if (anterior >= 0 && clave != anterior + 2)
+                            lecturasOk = false;
+                        anterior = clave;
+                    }
+                });
+                hechas++;
+            }
+            lecturas += hechas;
+        });
+    }
+
+    mt19937 escritorRng(99);
+    for (int i = 0; i < 200000; i++)
+    {
+        int k = static_cast<int>(escritorRng() % CLAVES) | 1;
+        if (i % 2 == 0)
+            indice.insert(k, -k);
+        else
+            indice.remove(k);
+    }
+    terminado = true;
+    for (thread &t : lectores)
+        t.join();
+
+    printTest("Los lectores siempre vieron las claves pares y sus valores", lecturasOk.load());
+    printTest("Los lectores avanzaron (" + to_string(lecturas.load()) + " lecturas)", lecturas.load() > 0);
+    printTest("Propiedades RBT al final", indice.verifyProperties());
+
+    return 0;
+}
@@ -0,0 +1,175 @@
+/**
+ * @file IntervalTree.hh
+ * @brief Árbol de intervalos sobre RedBlackTree con aumentación del extremo máximo
+ */
+
+#ifndef __INTERVAL_TREE__
+#define __INTERVAL_TREE__
+
+#include "RedBlackTree.hh"
+#include <stdexcept>
+#include <utility>
+
+/*1. Intervalos ordenados por inicio
+
+Qué es: Cada intervalo [lo, hi] es la clave (lo, hi) de un RedBlackTree, así
+que quedan ordenados por inicio y luego por fin
+Por qué: Inserción y eliminación en O(log n) sin escribir otro árbol
+balanceado; dos intervalos distintos con el mismo inicio pueden convivir.
+
+2. Resumen (menor inicio, mayor fin) por subárbol
+
+Qué es: La política IntervalAugmentation guarda en cada nodo el menor lo y el
+mayor hi de su subárbol
+Por qué: Un subárbol con mayor fin < a, o con menor inicio > b, no puede
+tener intervalos que se solapen con [a, b], y se descarta entero. Así una
+consulta visita O(min(n, (k + 1) log n)) nodos para k resultados.*/
+
+/**
+ * @brief Aumentación de RedBlackTree para claves (lo, hi): menor inicio y mayor fin del subárbol
+ * @tparam T Tipo de los extremos (debe ser comparable)
+ */
+template <typename T>
+struct IntervalAugmentation
+{
+    /**
+     * @brief Menor inicio y mayor fin de un subárbol
+     */
+    struct Summary
+    {
+        bool empty; ///< true para el subárbol vacío (minLo y maxHi no tienen sentido)
+        T minLo;    ///< Menor inicio del subárbol
+        T maxHi;    ///< Mayor fin del subárbol
+
+        bool operator==(const Summary &other) const
+        {
+            if (empty || other.empty)
+                return empty == other.empty;
+            return !(minLo < other.minLo) && !(other.minLo < minLo) &&
+                   !(maxHi < other.maxHi) && !(other.maxHi < maxHi);
+        }
+    };
+
+    static Summary identity() { return Summary{true, T(), T()}; }
+
+    template <typename Value>
+    static Summary of(const std::pair<T, T> &interval, const Value &)
+    {
+        return Summary{false, interval.first, interval.second};
+    }
+
+    static Summary combine(const Summary &a, const Summary &b)
+    {
+        if (a.empty)
+            return b;
+        if (b.empty)
+            return a;
+        // Las claves están ordenadas por inicio: el menor inicio es el de a
+        return Summary{false, a.minLo, (a.maxHi < b.maxHi) ? b.maxHi : a.maxHi};
+    }
+};
+
+/**
+ * @class IntervalTree
+ * @brief Mapa de intervalos cerrados [lo, hi] a valores, con consultas de solapamiento
+ * @tparam T Tipo de los extremos (debe ser comparable)
+ * @tparam Value Tipo del valor asociado a cada intervalo
+ *
+ * Insertar un intervalo que ya existe actualiza su valor.
+ */
+template <typename T, typename Value>
+class IntervalTree
+{
+private:
+    typedef std::pair<T, T> Interval;
+    typedef IntervalAugmentation<T> Augment;
+
+    RedBlackTree<Interval, Value, Augment> tree; ///< Intervalos ordenados por (lo, hi)
+
+public:
+    /**
+     * @brief Inserta el intervalo [lo, hi] con un valor
+     * @param lo Inicio del intervalo
+     * @param hi Fin del intervalo
+     * @param v Valor asociado
+     * @throw std::invalid_argument si hi < lo
+     * @complexity O(log n)
+     */
+    void insert(const T &lo, const T &hi, const Value &v)
+    {
+        if (hi < lo)
+            throw std::invalid_argument("IntervalTree: interval end is less than its start");
+        tree.insert(Interval(lo, hi), v);
+    }
+
+    /**
+     * @brief Elimina el intervalo [lo, hi]
+     * @return true si se eliminó, false si no existía
+     * @complexity O(log n)
+     */
+    bool remove(const T &lo, const T &hi)
+    {
+        return tree.remove(Interval(lo, hi));
+    }
+
+    /**
+     * @brief Verifica si el intervalo [lo, hi] está en el árbol
+     * @complexity O(log n)
+     */
+    bool find(const T &lo, const T &hi) const
+    {
+        return tree.find(Interval(lo, hi));
+    }
+
+    /**
+     * @brief Valor del intervalo [lo, hi]
+     * @return Puntero constante al valor, nullptr si no existe
+     * @complexity O(log n)
+     */
+    const Value *getValue(const T &lo, const T &hi) const
+    {
+        return tree.getValue(Interval(lo, hi));
+    }
+
+    /**
+     * @brief Visita en orden de inicio los intervalos que se solapan con [lo, hi]
+     * @param lo Inicio del intervalo de consulta
+     * @param hi Fin del intervalo de consulta
+     * @param fn Función llamada como fn(inicio, fin, valor)
+     * @complexity O(min(n, (k + 1) log n)), con k el número de resultados
+     */
+    template <typename Fn>
+    void forEachOverlapping(const T &lo, const T &hi, Fn fn) const
+    {
+        tree.forEachWhere(
+            [&](const typename Augment::Summary &s) { return !s.empty && !(s.maxHi < lo) && !(hi < s.minLo); },
+            [&](const Interval &interval, const Value &v) {
+                if (!(interval.second < lo) && !(hi < interval.first))
+                    fn(interval.first, interval.second, v);
+            });
+    }
+
+    /**
+     * @brief Visita en orden de inicio los intervalos que contienen un punto (stabbing query)
+     * @param point Punto de consulta
+     * @param fn Función llamada como fn(inicio, fin, valor)
+     * @complexity O(min(n, (k + 1) log n)), con k el número de resultados
+     */
+    template <typename Fn>
+    void forEachContaining(const T &point, Fn fn) const
+    {
+        forEachOverlapping(point, point, fn);
+    }
+
+    unsigned int size() const { return tree.size(); }
+    bool empty() const { return tree.empty(); }
+    void clear() { tree.clear(); }
+
+    /**
+     * @brief Verifica las propiedades RBT y los resúmenes de todos los nodos
+     * @complexity O(n)
+     */
+    bool verifyProperties() const { return tree.verifyProperties(); }
+};
+
+#endif // __INTERVAL_TREE__
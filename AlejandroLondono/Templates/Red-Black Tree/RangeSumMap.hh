@@ -0,0 +1,133 @@
+/**
+ * @file RangeSumMap.hh
+ * @brief Mapa ordenado con suma de valores por rango de claves en O(log n)
+ */
+
+#ifndef __RANGE_SUM_MAP__
+#define __RANGE_SUM_MAP__
+
+#include "RedBlackTree.hh"
+
+/*1. Suma por subárbol
+
+Qué es: La política SumAugmentation guarda en cada nodo la suma de los
+valores de su subárbol
+Por qué: sum(lo, hi) suma subárboles completos a lo largo de dos caminos
+(RedBlackTree::aggregate) en O(log n), sin visitar cada clave del rango.
+
+2. Valores de solo lectura
+
+Qué es: Los valores solo se cambian con set / add, nunca por referencia
+Por qué: Cambiar un valor obliga a recalcular las sumas de sus ancestros, y
+eso solo lo hace insert.*/
+
+/**
+ * @brief Aumentación de RedBlackTree con la suma de los valores del subárbol
+ * @tparam Value Tipo de los valores (Value() es el cero y debe tener operator+)
+ */
+template <typename Value>
+struct SumAugmentation
+{
+    typedef Value Summary;
+
+    static Summary identity() { return Value(); }
+
+    template <typename Key>
+    static Summary of(const Key &, const Value &v) { return v; }
+
+    static Summary combine(const Summary &a, const Summary &b) { return a + b; }
+};
+
+/**
+ * @class RangeSumMap
+ * @brief Mapa Key -> Value con sumas de valores por rango de claves
+ * @tparam Key Tipo de las claves (debe ser comparable)
+ * @tparam Value Tipo de los valores (Value() es el cero y debe tener operator+)
+ */
+template <typename Key, typename Value>
+class RangeSumMap
+{
+private:
+    RedBlackTree<Key, Value, SumAugmentation<Value>> tree; ///< Claves con la suma de cada subárbol
+
+public:
+    /**
+     * @brief Asigna el valor de una clave (la inserta si no existe)
+     * @complexity O(log n)
+     */
+    void set(const Key &k, const Value &v)
+    {
+        tree.insert(k, v);
+    }
+
+    /**
+     * @brief Suma delta al valor de una clave (la inserta con delta si no existe)
+     * @complexity O(log n)
+     */
+    void add(const Key &k, const Value &delta)
+    {
+        tree.upsert(k, [&delta](Value &v) { v = v + delta; });
+    }
+
+    /**
+     * @brief Elimina una clave
+     * @return true si se eliminó, false si no existía
+     * @complexity O(log n)
+     */
+    bool remove(const Key &k)
+    {
+        return tree.remove(k);
+    }
+
+    /**
+     * @brief Valor de una clave
+     * @return Puntero constante al valor, nullptr si no existe
+     * @complexity O(log n)
+     */
+    const Value *getValue(const Key &k) const
+    {
+        return tree.getValue(k);
+    }
+
+    /**
+     * @brief Suma de los valores con clave en [lo, hi]
+     * @return La suma, Value() si no hay claves en el rango
+     * @complexity O(log n) garantizado
+     */
+    Value sum(const Key &lo, const Key &hi) const
+    {
+        return tree.aggregate(lo, hi);
+    }
+
+    /**
+     * @brief Suma de todos los valores
+     * @complexity O(1)
+     */
+    const Value &total() const
+    {
+        return tree.aggregate();
+    }
+
+    unsigned int size() const { return tree.size(); }
+    bool empty() const { return tree.empty(); }
+    void clear() { tree.clear(); }
+
+    /**
+     * @brief Visita en orden los pares con clave en [lo, hi]
+     * @param fn Función llamada como fn(clave, valor)
+     * @complexity O(log n + k)
+     */
+    template <typename Fn>
+    void forEachInRange(const Key &lo, const Key &hi, Fn fn) const
+    {
+        tree.forEachInRange(lo, hi, fn);
+    }
+
+    /**
+     * @brief Verifica las propiedades RBT y las sumas de todos los nodos
+     * @complexity O(n)
+     */
+    bool verifyProperties() const { return tree.verifyProperties(); }
+};
+
+#endif // __RANGE_SUM_MAP__
@@ -18,10 +18,79 @@
 #ifndef __RED_BLACK_TREE__
 #define __RED_BLACK_TREE__
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
 #include <stdexcept>
 #include <string>
 #include <queue>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*1. Nodos en un slab (pool contiguo)
+
+Qué es: Todos los nodos viven en un único std::vector<Node>; el nodo de
+índice i está en nodes[i - 1] y el índice 0 (NIL) es el centinela
+Por qué: No hay un new por nodo, los nodos quedan juntos en memoria (mejor
+uso de caché) y copiar o vaciar el árbol es copiar o vaciar el vector.
+
+2. Enlaces de 32 bits con el color empaquetado
+
+Qué es: left, right y parent son índices de 32 bits dentro del slab, y el
+bit más alto de parent guarda el color
+Por qué: Con punteros y un enum Color cada nodo paga unos 40 bytes extra;
+así paga 12. Los índices siguen siendo válidos cuando el vector crece. El
+límite es 2^31 - 1 nodos.
+
+3. Eliminación compactando
+
+Qué es: Al eliminar un nodo, el último del slab se mueve a su lugar y se
+corrigen los enlaces que lo apuntaban
+Por qué: El slab nunca tiene huecos, así que no hace falta lista de libres y
+la memoria de la clave/valor eliminados se libera enseguida.
+
+4. Aumentación por política (Augment)
+
+Qué es: Cada nodo puede guardar un resumen de su subárbol (por ejemplo el
+número de nodos) que se recalcula en rotaciones, inserciones y eliminaciones
+Por qué: Con el tamaño de cada subárbol, select / rank / countInRange bajan
+por un solo camino en O(log n) en vez de recorrer todo el árbol. Con la
+política por defecto (NoAugmentation) el resumen es vacío y no ocupa memoria.
+Cualquier monoide sirve: sumas de valores (RangeSumMap.hh) o el extremo
+máximo de intervalos (IntervalTree.hh), y aggregate / forEachWhere son las
+consultas genéricas sobre los resúmenes.
+
+5. Construcción en bloque y join por altura negra
+
+Qué es: buildFromSorted copia los pares ya ordenados al slab y los enlaza como
+un árbol perfectamente balanceado; join / merge / split combinan árboles
+colgando uno del otro a la altura negra correcta
+Por qué: Construir desde datos ordenados cuesta O(n) con una sola reserva de
+memoria, y unir o dividir no necesita reinsertar clave por clave. Como cada
+árbol tiene su propio slab, solo se copian los nodos del lado más chico.
+
+6. Leer y modificar con una sola bajada
+
+Qué es: get devuelve un puntero al valor, getOrInsert y upsert lo crean si
+falta, y find / get aceptan cualquier tipo comparable con Key (por ejemplo
+string_view con claves string)
+Por qué: find + insert para leer-modificar-escribir baja dos veces por el
+árbol y copia el valor; buscar con un const char* o string_view construía un
+string temporal en cada consulta.
+
+7. Centinela sin clave ni valor
+
+Qué es: El centinela nil es un NodeLinks (enlaces, color y resumen) guardado
+dentro del objeto árbol, fuera del slab; links(x) devuelve los enlaces de x
+o los del centinela si x es NIL
+Por qué: Antes el slab empezaba con un nodo nil construido con Key() y
+Value(): cada árbol vacío reservaba memoria y las claves y valores tenían
+que tener constructor por defecto. Ahora un árbol vacío no reserva nada, y
+el algoritmo sigue escribiendo en nil (deleteFixup usa su padre), por eso
+el centinela es de cada árbol y no uno estático compartido.*/
 
 /**
  * @enum Color
@@ -33,78 +102,296 @@ enum Color
     BLACK ///< Color negro
 };
 
+/**
+ * @brief Política de aumentación por defecto: los nodos no guardan resumen
+ *
+ * Una política de aumentación define:
+ * - Summary: tipo del resumen de un subárbol
+ * - identity(): resumen del subárbol vacío
+ * - of(k, v): resumen de un solo nodo
+ * - combine(a, b): resumen de dos partes seguidas (asociativa)
+ *
+ * El resumen de un nodo es combine(combine(izquierdo, of(k, v)), derecho).
+ * combine no tiene que ser conmutativa: siempre se llama en orden de clave.
+ * Para verifyProperties, Summary debe tener operator==.
+ */
+struct NoAugmentation
+{
+    struct Summary
+    {
+    };
+
+    static Summary identity() { return Summary(); }
+
+    template <typename Key, typename Value>
+    static Summary of(const Key &, const Value &) { return Summary(); }
+
+    static Summary combine(const Summary &, const Summary &) { return Summary(); }
+};
+
+/**
+ * @brief Aumentación con el tamaño de cada subárbol
+ *
+ * Habilita select, rank y countInRange en O(log n).
+ */
+struct OrderStatistics
+{
+    typedef unsigned int Summary;
+
+    static Summary identity() { return 0; }
+
+    template <typename Key, typename Value>
+    static Summary of(const Key &, const Value &) { return 1; }
+
+    static Summary combine(Summary a, Summary b) { return a + b; }
+
+    /**
+     * @brief Número de nodos representado por un resumen
+     */
+    static unsigned int count(Summary s) { return s; }
+};
+
+/**
+ * @brief Almacena el resumen de aumentación dentro de un nodo
+ *
+ * Si el resumen es un tipo vacío se hereda de él, así no ocupa bytes en el
+ * nodo (optimización de base vacía).
+ */
+template <typename Summary, bool Empty = std::is_empty<Summary>::value>
+class RedBlackSummary
+{
+private:
+    Summary summary; ///< Resumen del subárbol
+
+public:
+    explicit RedBlackSummary(const Summary &s) : summary(s) {}
+    const Summary &getSummary() const { return summary; }
+    void setSummary(const Summary &s) { summary = s; }
+};
+
+template <typename Summary>
+class RedBlackSummary<Summary, true> : private Summary
+{
+public:
+    explicit RedBlackSummary(const Summary &) {}
+    const Summary &getSummary() const { return *this; }
+    void setSummary(const Summary &) {}
+};
+
 /**
  * @class RedBlackTree
  * @brief Árbol Rojo-Negro autobalanceado con pares Key-Value
  * @tparam Key Tipo de dato para la clave (debe ser comparable)
  * @tparam Value Tipo de dato para el valor asociado
+ * @tparam Augment Política de aumentación (NoAugmentation, OrderStatistics u otra con la misma forma)
+ *
+ * Si el resumen depende del valor, modificar un valor por getValue, un
+ * iterador o forEachInRange no actualiza los resúmenes: hay que usar insert.
  *
  * Implementa un árbol binario de búsqueda autobalanceado que garantiza
  * altura O(log n) mediante rotaciones y recoloreos después de inserciones
- * y eliminaciones.
+ * y eliminaciones. Los nodos se guardan en un slab contiguo y se enlazan con
+ * índices de 32 bits.
  */
-template <typename Key, typename Value>
+template <typename Key, typename Value, typename Augment = NoAugmentation>
 class RedBlackTree
 {
 private:
+    typedef std::uint32_t Index;                   ///< Posición de un nodo dentro del slab
+    typedef typename Augment::Summary Summary;     ///< Resumen de un subárbol
+    static constexpr bool AUGMENTED = !std::is_empty<Summary>::value; ///< Si hay que mantener resúmenes
+
+    static constexpr Index NIL = 0;                 ///< Índice del centinela nil
+    static constexpr Index COLOR_BIT = 0x80000000u; ///< Bit de parent que guarda el color (1 = NEGRO)
+    static constexpr Index INDEX_MASK = 0x7FFFFFFFu; ///< Bits de parent que guardan el índice
+
+    /// Válido solo si K se compara con Key en ambos sentidos (habilita la búsqueda heterogénea)
+    template <typename K>
+    using EnableIfComparable = decltype(void(std::declval<const K &>() < std::declval<const Key &>()),
+                                        void(std::declval<const Key &>() < std::declval<const K &>()));
+
     /**
-     * @class Node
-     * @brief Representa un nodo del árbol Rojo-Negro
+     * @class NodeLinks
+     * @brief Parte estructural de un nodo: todo lo que también tiene el centinela nil
      *
-     * Cada nodo contiene:
-     * - Una clave única (Key)
-     * - Un valor asociado (Value)
-     * - Un color (RED o BLACK)
-     * - Punteros a padre, hijo izquierdo e hijo derecho
+     * Contiene:
+     * - Índices al hijo izquierdo, hijo derecho y padre
+     * - El color (RED o BLACK), en el bit más alto del índice del padre
+     * - El resumen de su subárbol, si hay aumentación
+     */
+    class NodeLinks : public RedBlackSummary<Summary>
+    {
+    private:
+        Index left;        ///< Índice del hijo izquierdo
+        Index right;       ///< Índice del hijo derecho
+        Index parentColor; ///< Índice del padre (31 bits) y color (bit más alto)
+
+    public:
+        /**
+         * @brief Enlaces sin hijos ni padre
+         * @param s Resumen inicial
+         * @param c Color inicial
+         */
+        NodeLinks(const Summary &s, Color c)
+            : RedBlackSummary<Summary>(s), left(NIL), right(NIL), parentColor(c == BLACK ? COLOR_BIT : 0) {}
+
+        // Getters
+        Color getColor() const { return (parentColor & COLOR_BIT) ? BLACK : RED; }
+        Index getLeft() const { return left; }
+        Index getRight() const { return right; }
+        Index getParent() const { return parentColor & INDEX_MASK; }
+
+        // Setters
+        void setColor(Color c) { parentColor = (c == BLACK) ? (parentColor | COLOR_BIT) : (parentColor & INDEX_MASK); }
+        void setLeft(Index n) { left = n; }
+        void setRight(Index n) { right = n; }
+        void setParent(Index p) { parentColor = (parentColor & COLOR_BIT) | p; }
+
+        // Verificadores
+        bool hasLeft() const { return left != NIL; }
+        bool hasRight() const { return right != NIL; }
+        bool hasParent() const { return getParent() != NIL; }
+        bool isRed() const { return getColor() == RED; }
+        bool isBlack() const { return getColor() == BLACK; }
+    };
+
+    /**
+     * @class Node
+     * @brief Representa un nodo del árbol Rojo-Negro: enlaces más el par Key-Value
      */
-    class Node
+    class Node : public NodeLinks
     {
     private:
-        Key key;      ///< Clave única del nodo
-        Value value;  ///< Valor asociado a la clave
-        Color color;  ///< Color del nodo (RED o BLACK)
-        Node *left;   ///< Puntero al hijo izquierdo
-        Node *right;  ///< Puntero al hijo derecho
-        Node *parent; ///< Puntero al padre (necesario para rotaciones)
+        Key key;     ///< Clave única del nodo
+        Value value; ///< Valor asociado a la clave
 
     public:
         /**
          * @brief Constructor del nodo
          * @param k Clave del nodo
          * @param v Valor asociado
-         * @param c Color inicial (por defecto RED)
          *
-         * Los nodos nuevos se crean ROJOS por defecto (menos disruptivo).
+         * Los nodos nuevos se crean ROJOS (menos disruptivo).
          */
-        Node(const Key &k, const Value &v, Color c = RED)
-            : key(k), value(v), color(c), left(nil), right(nil), parent(nil) {}
+        Node(const Key &k, const Value &v) : NodeLinks(Augment::of(k, v), RED), key(k), value(v) {}
 
         // Getters
         const Key &getKey() const { return key; }
         const Value &getValue() const { return value; }
-        Color getColor() const { return color; }
-        Node *getLeft() const { return left; }
-        Node *getRight() const { return right; }
-        Node *getParent() const { return parent; }
+        Value &getValue() { return value; }
 
         // Setters
         void setValue(const Value &v) { value = v; }
-        void setColor(Color c) { color = c; }
-        void setLeft(Node *n) { left = n; }
-        void setRight(Node *n) { right = n; }
-        void setParent(Node *p) { parent = p; }
-
-        // Verificadores
-        bool hasLeft() const { return left != nil; }
-        bool hasRight() const { return right != nil; }
-        bool hasParent() const { return parent != nil; }
-        bool isRed() const { return color == RED; }
-        bool isBlack() const { return color == BLACK; }
     };
 
-    Node *root;      ///< Raíz del árbol
-    Node *nil;       ///< Nodo centinela (representa nullptr, siempre NEGRO)
-    unsigned int sz; ///< Número de nodos en el árbol
+    std::vector<Node> nodes; ///< Slab: el nodo de índice i está en nodes[i - 1]
+    NodeLinks nil;           ///< Centinela (índice NIL): siempre NEGRO, sin clave ni valor
+    Index root;              ///< Índice de la raíz (NIL si el árbol está vacío)
+
+    // ==================== ACCESO A LOS NODOS ====================
+
+    NodeLinks &links(Index x) { return x == NIL ? nil : nodes[x - 1]; }
+    const NodeLinks &links(Index x) const { return x == NIL ? nil : nodes[x - 1]; }
+    Node &nodeAt(Index x) { return nodes[x - 1]; }             ///< x no puede ser NIL
+    const Node &nodeAt(Index x) const { return nodes[x - 1]; } ///< x no puede ser NIL
+
+    Index left(Index x) const { return links(x).getLeft(); }
+    Index right(Index x) const { return links(x).getRight(); }
+    Index parent(Index x) const { return links(x).getParent(); }
+    Color color(Index x) const { return links(x).getColor(); }
+    const Key &keyOf(Index x) const { return nodeAt(x).getKey(); }
+
+    void setLeft(Index x, Index l) { links(x).setLeft(l); }
+    void setRight(Index x, Index r) { links(x).setRight(r); }
+    void setParent(Index x, Index p) { links(x).setParent(p); }
+    void setColor(Index x, Color c) { links(x).setColor(c); }
+    const Summary &summary(Index x) const { return links(x).getSummary(); }
+
+    // ==================== AUMENTACIÓN ====================
+
+    /**
+     * @brief Recalcula el resumen de x a partir de sus hijos
+     * @param x Nodo (no nil) cuyos hijos ya tienen el resumen correcto
+     * @complexity O(1)
+     */
+    void pull(Index x)
+    {
+        if (!AUGMENTED)
+            return;
+        Node &n = nodeAt(x);
+        n.setSummary(Augment::combine(Augment::combine(summary(n.getLeft()), Augment::of(n.getKey(), n.getValue())),
+                                             summary(n.getRight())));
+    }
+
+    /**
+     * @brief Recalcula los resúmenes desde x hasta la raíz
+     * @param x Primer nodo a recalcular (puede ser nil)
+     * @complexity O(log n)
+     */
+    void pullToRoot(Index x)
+    {
+        if (!AUGMENTED)
+            return;
+        for (; x != NIL; x = parent(x))
+            pull(x);
+    }
+
+    /**
+     * @brief Agrega un nodo ROJO al final del slab
+     * @return Índice del nuevo nodo
+     * @throw std::overflow_error si el slab ya tiene 2^31 - 1 nodos
+     * @complexity O(1) amortizado
+     */
+    Index allocateNode(const Key &k, const Value &v)
+    {
+        if (nodes.size() >= INDEX_MASK)
+        {
+            throw std::overflow_error("RedBlackTree: node pool is full");
+        }
+        nodes.emplace_back(k, v);
+        return static_cast<Index>(nodes.size());
+    }
+
+    /**
+     * @brief Libera el nodo z, que ya no está enlazado al árbol
+     * @param z Índice del nodo a liberar
+     * @complexity O(1)
+     *
+     * El último nodo del slab se mueve a la posición z y se actualizan los
+     * enlaces de su padre y de sus hijos, así el slab queda sin huecos.
+     */
+    void releaseNode(Index z)
+    {
+        Index last = static_cast<Index>(nodes.size());
+        if (z != last)
+        {
+            nodeAt(z) = std::move(nodeAt(last));
+
+            Index p = parent(z);
+            if (p == NIL)
+                root = z;
+            else if (left(p) == last)
+                setLeft(p, z);
+            else
+                setRight(p, z);
+
+            if (left(z) != NIL)
+                setParent(left(z), z);
+            if (right(z) != NIL)
+                setParent(right(z), z);
+        }
+        nodes.pop_back();
+    }
+
+    /**
+     * @brief Vacía el slab (conserva su capacidad) y restaura el centinela
+     */
+    void reset()
+    {
+        nodes.clear();
+        nil = NodeLinks(Augment::identity(), BLACK);
+        root = NIL;
+    }
 
     // ==================== MÉTODOS AUXILIARES DE ROTACIÓN ====================
 
@@ -122,38 +409,41 @@ private:
      *
      * Usado para rebalancear el árbol después de inserciones/eliminaciones.
      */
-    void rotateLeft(Node *x)
+    void rotateLeft(Index x)
     {
-        if (!x->hasRight())
+        if (!links(x).hasRight())
         {
             throw std::runtime_error("Cannot rotate left: no right child");
         }
 
-        Node *y = x->right;
-        x->setRight(y->getLeft());
+        Index y = right(x);
+        setRight(x, left(y));
 
-        if (y->hasLeft())
+        if (links(y).hasLeft())
         {
-            y->getLeft()->setParent(x);
+            setParent(left(y), x);
         }
 
-        y->setParent(x->getParent());
+        setParent(y, parent(x));
 
-        if (!x->hasParent())
+        if (!links(x).hasParent())
         {
             root = y;
         }
-        else if (x == x->getParent()->getLeft())
+        else if (x == left(parent(x)))
         {
-            x->getParent()->setLeft(y);
+            setLeft(parent(x), y);
         }
         else
         {
-            x->getParent()->setRight(y);
+            setRight(parent(x), y);
         }
 
-        y->setLeft(x);
-        x->setParent(y);
+        setLeft(y, x);
+        setParent(x, y);
+
+        pull(x);
+        pull(y);
     }
 
     /**
@@ -170,39 +460,42 @@ private:
      *
      * Operación simétrica a rotateLeft.
      */
-    void rotateRight(Node *x)
+    void rotateRight(Index x)
     {
 
-        if (!x->hasLeft())
+        if (!links(x).hasLeft())
         {
             throw std::runtime_error("Cannot rotate right: no Left child");
         }
 
-        Node *y = x->left;
-        x->setLeft(y->getRight());
+        Index y = left(x);
+        setLeft(x, right(y));
 
-        if (y->hasRight())
+        if (links(y).hasRight())
         {
-            y->getRight()->setParent(x);
+            setParent(right(y), x);
         }
 
-        y->setParent(x->getParent());
+        setParent(y, parent(x));
 
-        if (!x->hasParent())
+        if (!links(x).hasParent())
         {
             root = y;
         }
-        else if (x == x->getParent()->getRight())
+        else if (x == right(parent(x)))
         {
-            x->getParent()->setRight(y);
+            setRight(parent(x), y);
         }
         else
         {
-            x->getParent()->setLeft(y);
+            setLeft(parent(x), y);
         }
 
-        y->setRight(x);
-        x->setParent(y);
+        setRight(y, x);
+        setParent(x, y);
+
+        pull(x);
+        pull(y);
     }
 
     // ==================== MÉTODOS AUXILIARES DE FIXUP ====================
@@ -227,8 +520,64 @@ private:
      *
      * También maneja casos simétricos (cuando padre es hijo derecho).
      */
-
-    void insertFixup(Node *z);
+    void insertFixup(Index z)
+    {
+        while (color(parent(z)) == RED)
+        {
+            Index p = parent(z);
+            Index g = parent(p);
+            if (p == left(g))
+            {
+                Index uncle = right(g);
+                if (color(uncle) == RED)
+                {
+                    // CASO 1
+                    setColor(p, BLACK);
+                    setColor(uncle, BLACK);
+                    setColor(g, RED);
+                    z = g;
+                }
+                else
+                {
+                    if (z == right(p))
+                    {
+                        // CASO 2
+                        z = p;
+                        rotateLeft(z);
+                        p = parent(z);
+                    }
+                    // CASO 3
+                    setColor(p, BLACK);
+                    setColor(g, RED);
+                    rotateRight(g);
+                }
+            }
+            else
+            {
+                Index uncle = left(g);
+                if (color(uncle) == RED)
+                {
+                    setColor(p, BLACK);
+                    setColor(uncle, BLACK);
+                    setColor(g, RED);
+                    z = g;
+                }
+                else
+                {
+                    if (z == left(p))
+                    {
+                        z = p;
+                        rotateRight(z);
+                        p = parent(z);
+                    }
+                    setColor(p, BLACK);
+                    setColor(g, RED);
+                    rotateLeft(g);
+                }
+            }
+        }
+        setColor(root, BLACK);
+    }
 
     /**
      * @brief Corrige las propiedades RBT después de una eliminación
@@ -253,7 +602,80 @@ private:
      *
      * También maneja casos simétricos.
      */
-    void deleteFixup(Node *x);
+    void deleteFixup(Index x)
+    {
+        while (x != root && color(x) == BLACK)
+        {
+            Index p = parent(x);
+            if (x == left(p))
+            {
+                Index w = right(p);
+                if (color(w) == RED)
+                {
+                    // CASO 1
+                    setColor(w, BLACK);
+                    setColor(p, RED);
+                    rotateLeft(p);
+                    w = right(p);
+                }
+                if (color(left(w)) == BLACK && color(right(w)) == BLACK)
+                {
+                    // CASO 2
+                    setColor(w, RED);
+                    x = p;
+                }
+                else
+                {
+                    if (color(right(w)) == BLACK)
+                    {
+                        // CASO 3
+                        setColor(left(w), BLACK);
+                        setColor(w, RED);
+                        rotateRight(w);
+                        w = right(p);
+                    }
+                    // CASO 4
+                    setColor(w, color(p));
+                    setColor(p, BLACK);
+                    setColor(right(w), BLACK);
+                    rotateLeft(p);
+                    x = root;
+                }
+            }
+            else
+            {
+                Index w = left(p);
+                if (color(w) == RED)
+                {
+                    setColor(w, BLACK);
+                    setColor(p, RED);
+                    rotateRight(p);
+                    w = left(p);
+                }
+                if (color(left(w)) == BLACK && color(right(w)) == BLACK)
+                {
+                    setColor(w, RED);
+                    x = p;
+                }
+                else
+                {
+                    if (color(left(w)) == BLACK)
+                    {
+                        setColor(right(w), BLACK);
+                        setColor(w, RED);
+                        rotateLeft(w);
+                        w = left(p);
+                    }
+                    setColor(w, color(p));
+                    setColor(p, BLACK);
+                    setColor(left(w), BLACK);
+                    rotateRight(p);
+                    x = root;
+                }
+            }
+        }
+        setColor(x, BLACK);
+    }
 
     /**
      * @brief Transplanta un subárbol en lugar de otro
@@ -264,174 +686,809 @@ private:
      * Actualiza el padre de u para que apunte a v.
      * Usado internamente por la función de eliminación.
      */
-    void transplant(Node *u, Node *v);
+    void transplant(Index u, Index v)
+    {
+        Index p = parent(u);
+        if (p == NIL)
+            root = v;
+        else if (u == left(p))
+            setLeft(p, v);
+        else
+            setRight(p, v);
+        // v puede ser nil: deleteFixup necesita conocer su padre
+        setParent(v, p);
+    }
 
     // ==================== MÉTODOS AUXILIARES DE BÚSQUEDA ====================
 
     /**
-     * @brief Busca un nodo por su clave recursivamente
-     * @param node Nodo actual
-     * @param k Clave a buscar
-     * @return Puntero al nodo encontrado o nil
+     * @brief Busca un nodo por su clave
+     * @param node Nodo desde el cual buscar
+     * @param k Clave a buscar (Key o un tipo comparable con Key)
+     * @return Índice del nodo encontrado o NIL
      * @complexity O(log n)
      */
-    Node *searchHelper(Node *node, const Key &k) const;
+    template <typename K>
+    Index searchHelper(Index node, const K &k) const
+    {
+        while (node != NIL)
+        {
+            if (k < keyOf(node))
+                node = left(node);
+            else if (keyOf(node) < k)
+                node = right(node);
+            else
+                return node;
+        }
+        return NIL;
+    }
+
+    /**
+     * @brief Busca k y, si no existe, lo inserta con el valor que devuelve factory()
+     * @param k Clave a buscar o insertar
+     * @param factory Función sin argumentos que crea el valor (solo se llama si k no existe)
+     * @param inserted Recibe true si se insertó un nodo nuevo
+     * @return Índice del nodo con clave k
+     * @throw std::overflow_error si hay que insertar y el árbol ya tiene 2^31 - 1 nodos
+     * @complexity O(log n) garantizado, una sola bajada
+     *
+     * Las rotaciones de insertFixup solo cambian enlaces, así que el índice
+     * devuelto sigue apuntando al nodo de k.
+     */
+    template <typename Factory>
+    Index findOrAllocate(const Key &k, Factory &factory, bool &inserted)
+    {
+        Index y = NIL;
+        Index x = root;
+
+        while (x != NIL)
+        {
+            y = x;
+            if (k < keyOf(x))
+                x = left(x);
+            else if (keyOf(x) < k)
+                x = right(x);
+            else
+            {
+                inserted = false;
+                return x;
+            }
+        }
+
+        // Se crea después de buscar: emplace_back puede mover el slab
+        Index z = allocateNode(k, factory());
+        setParent(z, y);
+        if (y == NIL)
+            root = z;
+        else if (k < keyOf(y))
+            setLeft(y, z);
+        else
+            setRight(y, z);
+
+        pullToRoot(y);
+        insertFixup(z);
+        inserted = true;
+        return z;
+    }
 
     /**
      * @brief Encuentra el nodo con clave mínima en un subárbol
      * @param node Raíz del subárbol
-     * @return Puntero al nodo con clave mínima
+     * @return Índice del nodo con clave mínima
      * @complexity O(log n)
      *
      * Desciende por el camino más a la izquierda.
      */
-    Node *findMinHelper(Node *node) const;
+    Index findMinHelper(Index node) const
+    {
+        while (left(node) != NIL)
+            node = left(node);
+        return node;
+    }
 
     /**
      * @brief Encuentra el nodo con clave máxima en un subárbol
      * @param node Raíz del subárbol
-     * @return Puntero al nodo con clave máxima
+     * @return Índice del nodo con clave máxima
      * @complexity O(log n)
      *
      * Desciende por el camino más a la derecha.
      */
-    Node *findMaxHelper(Node *node) const;
+    Index findMaxHelper(Index node) const
+    {
+        while (right(node) != NIL)
+            node = right(node);
+        return node;
+    }
 
     /**
      * @brief Encuentra el sucesor inorden de un nodo
      * @param node Nodo del cual buscar sucesor
-     * @return Puntero al nodo sucesor
+     * @return Índice del nodo sucesor (NIL si node es el máximo)
      * @complexity O(log n)
      *
      * Si tiene hijo derecho, el sucesor es el mínimo de ese subárbol.
      * Si no, es el ancestro más bajo cuyo hijo izquierdo es ancestro del nodo.
      */
-    Node *successor(Node *node) const;
+    Index successor(Index node) const
+    {
+        if (right(node) != NIL)
+            return findMinHelper(right(node));
+        Index p = parent(node);
+        while (p != NIL && node == right(p))
+        {
+            node = p;
+            p = parent(p);
+        }
+        return p;
+    }
 
     /**
      * @brief Encuentra el predecesor inorden de un nodo
      * @param node Nodo del cual buscar predecesor
-     * @return Puntero al nodo predecesor
+     * @return Índice del nodo predecesor (NIL si node es el mínimo)
      * @complexity O(log n)
      *
      * Si tiene hijo izquierdo, el predecesor es el máximo de ese subárbol.
      * Si no, es el ancestro más bajo cuyo hijo derecho es ancestro del nodo.
      */
-    Node *predecessor(Node *node) const;
-
-    // ==================== MÉTODOS AUXILIARES DE RECORRIDOS ====================
+    Index predecessor(Index node) const
+    {
+        if (left(node) != NIL)
+            return findMaxHelper(left(node));
+        Index p = parent(node);
+        while (p != NIL && node == left(p))
+        {
+            node = p;
+            p = parent(p);
+        }
+        return p;
+    }
 
     /**
-     * @brief Recorrido inorden (Izquierda-Raíz-Derecha)
-     * @param node Nodo actual
-     * @complexity O(n)
-     *
-     * Imprime los elementos en orden ascendente por clave.
+     * @brief Encuentra el primer nodo cuya clave no es menor que k
+     * @param k Clave de referencia
+     * @return Índice del nodo, NIL si todas las claves son menores que k
+     * @complexity O(log n)
      */
-    void inorderHelper(Node *node) const;
+    Index lowerBoundHelper(const Key &k) const
+    {
+        Index node = root;
+        Index candidate = NIL;
+        while (node != NIL)
+        {
+            if (keyOf(node) < k)
+            {
+                node = right(node);
+            }
+            else
+            {
+                candidate = node;
+                node = left(node);
+            }
+        }
+        return candidate;
+    }
 
     /**
-     * @brief Recorrido preorden (Raíz-Izquierda-Derecha)
-     * @param node Nodo actual
-     * @complexity O(n)
+     * @brief Encuentra el primer nodo cuya clave es mayor que k
+     * @param k Clave de referencia
+     * @return Índice del nodo, NIL si ninguna clave es mayor que k
+     * @complexity O(log n)
      */
-    void preorderHelper(Node *node) const;
+    Index upperBoundHelper(const Key &k) const
+    {
+        Index node = root;
+        Index candidate = NIL;
+        while (node != NIL)
+        {
+            if (k < keyOf(node))
+            {
+                candidate = node;
+                node = left(node);
+            }
+            else
+            {
+                node = right(node);
+            }
+        }
+        return candidate;
+    }
+
+    // ==================== MÉTODOS AUXILIARES DE CONSTRUCCIÓN Y UNIÓN ====================
 
     /**
-     * @brief Recorrido postorden (Izquierda-Derecha-Raíz)
-     * @param node Nodo actual
-     * @complexity O(n)
+     * @brief Reserva el slab para los elementos de un rango, si se puede medir
      */
-    void postorderHelper(Node *node) const;
+    template <typename InputIt>
+    void reserveFor(InputIt first, InputIt last, std::forward_iterator_tag)
+    {
+        nodes.reserve(static_cast<std::size_t>(std::distance(first, last)));
+    }
 
-    // ==================== MÉTODOS AUXILIARES DE UTILIDAD ====================
+    template <typename InputIt>
+    void reserveFor(InputIt, InputIt, std::input_iterator_tag) {}
 
     /**
-     * @brief Calcula la altura del árbol
-     * @param node Nodo actual
-     * @return Altura del subárbol
+     * @brief Enlaza los nodos de índice lo..hi (en orden de clave) como un subárbol balanceado
+     * @param lo Primer índice
+     * @param hi Último índice
+     * @param p Padre del subárbol
+     * @param depth Profundidad de la raíz del subárbol
+     * @param redDepth Profundidad cuyos nodos se pintan de ROJO (0 = ninguna)
+     * @return Raíz del subárbol
+     * @complexity O(hi - lo)
+     *
+     * Partir siempre por la mitad deja todas las hojas nil en las dos
+     * últimas profundidades, así que pintar de ROJO solo el último nivel da la
+     * misma altura negra en todos los caminos.
+     */
+    Index linkSortedRange(Index lo, Index hi, Index p, unsigned int depth, unsigned int redDepth)
+    {
+        if (lo > hi)
+            return NIL;
+        Index mid = lo + (hi - lo) / 2;
+        setParent(mid, p);
+        setColor(mid, (depth == redDepth && depth > 0) ? RED : BLACK);
+        setLeft(mid, mid > lo ? linkSortedRange(lo, mid - 1, mid, depth + 1, redDepth) : NIL);
+        setRight(mid, linkSortedRange(mid + 1, hi, mid, depth + 1, redDepth));
+        pull(mid);
+        return mid;
+    }
+
+    /**
+     * @brief Enlaza todo el slab, cuyos nodos ya están en orden de clave estrictamente creciente
      * @complexity O(n)
      */
-    int heightHelper(Node *node) const;
+    void linkSorted()
+    {
+        Index n = static_cast<Index>(nodes.size());
+        unsigned int deepest = 0; // floor(log2(n)): profundidad del último nivel
+        while ((Index(2) << deepest) <= n)
+            deepest++;
+        root = (n == 0) ? NIL : linkSortedRange(1, n, NIL, 0, deepest);
+    }
 
     /**
-     * @brief Calcula la altura negra del árbol
-     * @param node Nodo actual
-     * @return Número de nodos negros desde node hasta una hoja
+     * @brief Une dos subárboles del slab con un nodo intermedio (join por altura negra)
+     * @param l Raíz de un RBT válido con claves menores que la de k (puede ser nil)
+     * @param k Nodo suelto que queda entre l y r
+     * @param r Raíz de un RBT válido con claves mayores que la de k (puede ser nil)
+     * @return Raíz del árbol unido (también queda en root)
      * @complexity O(log n)
      *
-     * Útil para verificar que se mantiene la propiedad 5 del RBT.
+     * Si l es más alto, baja por su borde derecho hasta un nodo NEGRO con la
+     * altura negra de r, cuelga ahí a k (ROJO) con ese nodo y r como hijos, y
+     * corrige con insertFixup. El caso de r más alto es simétrico.
      */
-    int blackHeightHelper(Node *node) const;
+    Index joinNodes(Index l, Index k, Index r)
+    {
+        // Una raíz roja se puede pintar de negro sin romper nada
+        setColor(l, BLACK);
+        setColor(r, BLACK);
+        int lh = blackHeightHelper(l);
+        int rh = blackHeightHelper(r);
+
+        if (lh == rh)
+        {
+            setLeft(k, l);
+            setRight(k, r);
+            setParent(k, NIL);
+            setColor(k, BLACK);
+            if (l != NIL)
+                setParent(l, k);
+            if (r != NIL)
+                setParent(r, k);
+            pull(k);
+            root = k;
+            return k;
+        }
+
+        setColor(k, RED);
+        if (lh > rh)
+        {
+            Index c = l;
+            Index p = NIL;
+            int h = lh;
+            while (!(color(c) == BLACK && h == rh))
+            {
+                if (color(c) == BLACK)
+                    h--;
+                p = c;
+                c = right(c);
+            }
+            root = l;
+            setParent(l, NIL);
+            setLeft(k, c);
+            setRight(k, r);
+            setParent(k, p);
+            setRight(p, k);
+            if (c != NIL)
+                setParent(c, k);
+            if (r != NIL)
+                setParent(r, k);
+        }
+        else
+        {
+            Index c = r;
+            Index p = NIL;
+            int h = rh;
+            while (!(color(c) == BLACK && h == lh))
+            {
+                if (color(c) == BLACK)
+                    h--;
+                p = c;
+                c = left(c);
+            }
+            root = r;
+            setParent(r, NIL);
+            setLeft(k, l);
+            setRight(k, c);
+            setParent(k, p);
+            setLeft(p, k);
+            if (c != NIL)
+                setParent(c, k);
+            if (l != NIL)
+                setParent(l, k);
+        }
+        pullToRoot(k);
+        insertFixup(k);
+        return root;
+    }
 
     /**
-     * @brief Elimina todos los nodos recursivamente
-     * @param node Nodo actual
-     * @complexity O(n)
+     * @brief Divide un subárbol del slab por una clave
+     * @param t Raíz del subárbol
+     * @param k Clave de corte
+     * @param l Raíz resultante con las claves < k
+     * @param r Raíz resultante con las claves >= k
+     * @complexity O(log n) (O(log² n) con aumentación)
+     *
+     * Baja por el camino de k y en cada nodo une lo que queda de su lado con
+     * joinNodes; las alturas negras de las uniones suman O(log n).
      */
-    void clearHelper(Node *node)
+    void splitNodes(Index t, const Key &k, Index &l, Index &r)
     {
-        if (Node == nil)
+        if (t == NIL)
+        {
+            l = r = NIL;
             return;
-        clearHelper(Node->left);
-        clearHelper(Node->right);
-        delete node;
+        }
+        Index tl = left(t);
+        Index tr = right(t);
+        Index a, b;
+        if (keyOf(t) < k)
+        {
+            splitNodes(tr, k, a, b);
+            l = joinNodes(tl, t, a);
+            r = b;
+        }
+        else
+        {
+            splitNodes(tl, k, a, b);
+            l = a;
+            r = joinNodes(b, t, tr);
+        }
     }
 
     /**
-     * @brief Copia un árbol recursivamente
-     * @param node Nodo a copiar
-     * @param parent Padre del nodo en el nuevo árbol
-     * @return Puntero al nuevo nodo copiado
-     * @complexity O(n)
+     * @brief Decide si el subárbol a tiene a lo sumo tantos nodos como b
+     * @complexity O(min(|a|, |b|))
+     *
+     * Recorre los dos a la vez y se detiene cuando uno se termina.
      */
-    Node *copyHelper(Node *node, Node *parent);
+    bool isSmallerOrEqual(Index a, Index b) const
+    {
+        std::vector<Index> pendingA, pendingB;
+        if (a != NIL)
+            pendingA.push_back(a);
+        if (b != NIL)
+            pendingB.push_back(b);
+        while (!pendingA.empty() && !pendingB.empty())
+        {
+            Index x = pendingA.back();
+            pendingA.pop_back();
+            if (left(x) != NIL)
+                pendingA.push_back(left(x));
+            if (right(x) != NIL)
+                pendingA.push_back(right(x));
+
+            Index y = pendingB.back();
+            pendingB.pop_back();
+            if (left(y) != NIL)
+                pendingB.push_back(left(y));
+            if (right(y) != NIL)
+                pendingB.push_back(right(y));
+        }
+        return pendingA.empty();
+    }
 
     /**
-     * @brief Imprime el árbol de forma visual con colores
-     * @param node Nodo actual
-     * @param prefix Prefijo para indentación
-     * @param isLeft Indica si es hijo izquierdo
-     * @complexity O(n)
+     * @brief Mueve un subárbol de este slab al slab de dst
+     * @param x Raíz del subárbol a mover
+     * @param dst Árbol destino
+     * @param dstParent Padre del subárbol en dst
+     * @param moved Índices de este slab que quedaron libres
+     * @return Raíz del subárbol en dst
+     * @complexity O(tamaño del subárbol)
      */
-    void printTreeHelper(Node *node, const std::string &prefix, bool isLeft) const;
+    Index exportSubtree(Index x, RedBlackTree &dst, Index dstParent, std::vector<Index> &moved)
+    {
+        if (x == NIL)
+            return NIL;
+        dst.nodes.push_back(std::move(nodeAt(x)));
+        Index y = static_cast<Index>(dst.nodes.size());
+        dst.setParent(y, dstParent);
+        moved.push_back(x);
+        Index l = exportSubtree(left(x), dst, y, moved);
+        Index r = exportSubtree(right(x), dst, y, moved);
+        dst.setLeft(y, l);
+        dst.setRight(y, r);
+        return y;
+    }
 
     /**
-     * @brief Verifica si el árbol cumple las propiedades RBT
+     * @brief Quita del slab los nodos que se movieron a otro árbol
+     * @param moved Índices libres (se ordenan de mayor a menor)
+     * @complexity O(m log m), con m = moved.size()
+     *
+     * Liberar de mayor a menor garantiza que el último nodo del slab, que
+     * releaseNode mueve al hueco, siempre es un nodo que se queda.
+     */
+    void releaseMoved(std::vector<Index> &moved)
+    {
+        std::sort(moved.begin(), moved.end());
+        for (std::size_t i = moved.size(); i-- > 0;)
+            releaseNode(moved[i]);
+    }
+
+    /**
+     * @brief Agrega al final de este slab todos los nodos de other
+     * @return Raíz del árbol de other dentro de este slab
+     * @complexity O(other.size())
+     */
+    Index importNodes(RedBlackTree &other)
+    {
+        Index offset = static_cast<Index>(nodes.size());
+        for (std::size_t i = 0; i < other.nodes.size(); i++)
+        {
+            nodes.push_back(std::move(other.nodes[i]));
+            Node &n = nodes.back();
+            if (n.getLeft() != NIL)
+                n.setLeft(n.getLeft() + offset);
+            if (n.getRight() != NIL)
+                n.setRight(n.getRight() + offset);
+            if (n.getParent() != NIL)
+                n.setParent(n.getParent() + offset);
+        }
+        Index importedRoot = other.root == NIL ? NIL : other.root + offset;
+        other.reset();
+        return importedRoot;
+    }
+
+    /**
+     * @brief Intercambia el contenido con otro árbol
+     * @complexity O(1)
+     */
+    void swapWith(RedBlackTree &other)
+    {
+        nodes.swap(other.nodes);
+        std::swap(root, other.root);
+    }
+
+    /**
+     * @brief Verifica que los dos árboles juntos entren en un slab
+     * @throw std::overflow_error si sumarían más de 2^31 - 1 nodos
+     */
+    void checkCombinedSize(const RedBlackTree &other) const
+    {
+        if (static_cast<std::size_t>(size()) + other.size() > INDEX_MASK)
+            throw std::overflow_error("RedBlackTree: node pool is full");
+    }
+
+    // ==================== MÉTODOS AUXILIARES DE RECORRIDOS ====================
+
+    /**
+     * @brief Recorrido inorden (Izquierda-Raíz-Derecha)
+     * @param node Nodo actual
+     * @complexity O(n)
+     *
+     * Imprime los elementos en orden ascendente por clave.
+     */
+    void inorderHelper(Index node) const
+    {
+        if (node == NIL)
+            return;
+        inorderHelper(left(node));
+        std::cout << keyOf(node) << ": " << nodeAt(node).getValue() << std::endl;
+        inorderHelper(right(node));
+    }
+
+    /**
+     * @brief Recorrido preorden (Raíz-Izquierda-Derecha)
+     * @param node Nodo actual
+     * @complexity O(n)
+     */
+    void preorderHelper(Index node) const
+    {
+        if (node == NIL)
+            return;
+        std::cout << keyOf(node) << ": " << nodeAt(node).getValue() << std::endl;
+        preorderHelper(left(node));
+        preorderHelper(right(node));
+    }
+
+    /**
+     * @brief Recorrido postorden (Izquierda-Derecha-Raíz)
+     * @param node Nodo actual
+     * @complexity O(n)
+     */
+    void postorderHelper(Index node) const
+    {
+        if (node == NIL)
+            return;
+        postorderHelper(left(node));
+        postorderHelper(right(node));
+        std::cout << keyOf(node) << ": " << nodeAt(node).getValue() << std::endl;
+    }
+
+    /**
+     * @brief Recorrido inorden que descarta los subárboles rechazados por mayContain
+     * @param node Nodo actual
+     * @param mayContain Predicado sobre el resumen de un subárbol
+     * @param fn Función llamada como fn(clave, valor)
+     */
+    template <typename MayContain, typename Fn>
+    void forEachWhereHelper(Index node, MayContain &mayContain, Fn &fn) const
+    {
+        if (node == NIL || !mayContain(summary(node)))
+            return;
+        forEachWhereHelper(left(node), mayContain, fn);
+        fn(keyOf(node), nodeAt(node).getValue());
+        forEachWhereHelper(right(node), mayContain, fn);
+    }
+
+    // ==================== MÉTODOS AUXILIARES DE UTILIDAD ====================
+
+    /**
+     * @brief Calcula la altura del árbol
+     * @param node Nodo actual
+     * @return Altura del subárbol (-1 para nil)
+     * @complexity O(n)
+     */
+    int heightHelper(Index node) const
+    {
+        if (node == NIL)
+            return -1;
+        int leftHeight = heightHelper(left(node));
+        int rightHeight = heightHelper(right(node));
+        return 1 + (leftHeight > rightHeight ? leftHeight : rightHeight);
+    }
+
+    /**
+     * @brief Calcula la altura negra del árbol
+     * @param node Nodo actual
+     * @return Número de nodos negros desde node hasta una hoja (sin contar nil)
+     * @complexity O(log n)
+     *
+     * Útil para verificar que se mantiene la propiedad 5 del RBT.
+     */
+    int blackHeightHelper(Index node) const
+    {
+        int count = 0;
+        while (node != NIL)
+        {
+            if (color(node) == BLACK)
+                count++;
+            node = left(node);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Imprime el árbol de forma visual con colores
+     * @param node Nodo actual
+     * @param prefix Prefijo para indentación
+     * @param isLeft Indica si es hijo izquierdo
+     * @complexity O(n)
+     */
+    void printTreeHelper(Index node, const std::string &prefix, bool isLeft) const
+    {
+        if (node == NIL)
+            return;
+        std::cout << prefix << (isLeft ? "├──" : "└──");
+        std::cout << keyOf(node) << ": " << nodeAt(node).getValue()
+                  << (color(node) == RED ? " (R)" : " (B)") << std::endl;
+        printTreeHelper(left(node), prefix + (isLeft ? "│   " : "    "), true);
+        printTreeHelper(right(node), prefix + (isLeft ? "│   " : "    "), false);
+    }
+
+    /**
+     * @brief Sin aumentación no hay resumen que verificar
+     */
+    bool summaryIsValid(Index, std::false_type) const
+    {
+        return true;
+    }
+
+    /**
+     * @brief Verifica que el resumen de node coincida con el de sus hijos
+     * @complexity O(1)
+     *
+     * Solo se compila con aumentación, porque necesita Summary::operator==.
+     */
+    bool summaryIsValid(Index node, std::true_type) const
+    {
+        return summary(node) == Augment::combine(Augment::combine(summary(left(node)), Augment::of(keyOf(node), nodeAt(node).getValue())),
+                                                 summary(right(node)));
+    }
+
+    /**
+     * @brief Verifica si el árbol cumple las propiedades RBT
      * @param node Nodo actual
      * @param blackCount Contador de nodos negros en el camino actual
-     * @param pathBlackCount Referencia al número esperado de nodos negros
+     * @param pathBlackCount Referencia al número esperado de nodos negros (-1 si aún no se conoce)
      * @return true si cumple propiedades, false en caso contrario
      * @complexity O(n)
      *
      * Verifica:
      * - No hay dos rojos consecutivos
      * - Todos los caminos tienen el mismo black-height
+     * - Los hijos apuntan a su padre
+     * - El resumen de cada nodo coincide con el de sus hijos
      */
-    bool verifyPropertiesHelper(Node *node, int blackCount, int &pathBlackCount) const;
+    bool verifyPropertiesHelper(Index node, int blackCount, int &pathBlackCount) const
+    {
+        if (node == NIL)
+        {
+            if (pathBlackCount == -1)
+                pathBlackCount = blackCount;
+            return blackCount == pathBlackCount;
+        }
+
+        if (color(node) == BLACK)
+            blackCount++;
+        else if (color(left(node)) == RED || color(right(node)) == RED)
+            return false;
+
+        if ((left(node) != NIL && parent(left(node)) != node) ||
+            (right(node) != NIL && parent(right(node)) != node))
+            return false;
+
+        if (!summaryIsValid(node, std::integral_constant<bool, AUGMENTED>()))
+            return false;
+
+        return verifyPropertiesHelper(left(node), blackCount, pathBlackCount) &&
+               verifyPropertiesHelper(right(node), blackCount, pathBlackCount);
+    }
 
 public:
+    // ==================== ITERADORES ====================
+
+    /**
+     * @class IteratorBase
+     * @brief Iterador bidireccional en orden de clave
+     * @tparam IsConst true para const_iterator
+     *
+     * Guarda el árbol y el índice del nodo; ++ y -- siguen los enlaces al
+     * padre, así que recorrer k elementos seguidos cuesta O(k + log n).
+     * end() es nil y --end() es el máximo.
+     *
+     * Insertar no invalida iteradores (los índices no cambian aunque el slab
+     * crezca). Eliminar invalida el iterador al elemento eliminado y el del
+     * último nodo del slab, que se mueve a su lugar.
+     *
+     * *it devuelve un par (clave, valor) de referencias.
+     */
+    template <bool IsConst>
+    class IteratorBase
+    {
+    private:
+        typedef typename std::conditional<IsConst, const RedBlackTree, RedBlackTree>::type Tree;
+        typedef typename std::conditional<IsConst, const Value &, Value &>::type ValueRef;
+
+        Tree *tree; ///< Árbol recorrido
+        Index node; ///< Nodo actual (NIL = end())
+
+        IteratorBase(Tree *t, Index n) : tree(t), node(n) {}
+
+        friend class RedBlackTree;
+        friend class IteratorBase<!IsConst>;
+
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef std::pair<const Key, Value> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef std::pair<const Key &, ValueRef> reference;
+
+        /**
+         * @brief Resultado de operator->: guarda el par de referencias
+         */
+        struct pointer
+        {
+            reference ref;
+            const reference *operator->() const { return &ref; }
+        };
+
+        IteratorBase() : tree(nullptr), node(NIL) {}
+
+        /**
+         * @brief Conversión de iterator a const_iterator
+         */
+        template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        IteratorBase(const IteratorBase<OtherConst> &other) : tree(other.tree), node(other.node) {}
+
+        const Key &key() const { return tree->keyOf(node); }
+        ValueRef value() const { return tree->nodeAt(node).getValue(); }
+
+        reference operator*() const { return reference(key(), value()); }
+        pointer operator->() const { return pointer{**this}; }
+
+        IteratorBase &operator++()
+        {
+            node = tree->successor(node);
+            return *this;
+        }
+
+        IteratorBase operator++(int)
+        {
+            IteratorBase old = *this;
+            ++*this;
+            return old;
+        }
+
+        IteratorBase &operator--()
+        {
+            if (node == NIL)
+                node = (tree->root == NIL) ? NIL : tree->findMaxHelper(tree->root);
+            else
+                node = tree->predecessor(node);
+            return *this;
+        }
+
+        IteratorBase operator--(int)
+        {
+            IteratorBase old = *this;
+            --*this;
+            return old;
+        }
+
+        bool operator==(const IteratorBase &other) const { return node == other.node && tree == other.tree; }
+        bool operator!=(const IteratorBase &other) const { return !(*this == other); }
+    };
+
+    typedef IteratorBase<false> iterator;      ///< Iterador que permite modificar los valores
+    typedef IteratorBase<true> const_iterator; ///< Iterador de solo lectura
+
     // ==================== CONSTRUCTORES Y DESTRUCTOR ====================
 
     /**
      * @brief Constructor por defecto
      * @complexity O(1)
      *
-     * Crea un árbol vacío con nodo centinela nil.
+     * Crea un árbol vacío sin reservar memoria: el slab queda vacío y el
+     * centinela nil vive dentro del objeto.
      */
-    RedBlackTree()
-    {
-        nil = new Node(k, v, BLACK);
-        nil->left = nil->right = nil->parent = nil;
-        root = nil;
-    }
+    RedBlackTree() : nil(Augment::identity(), BLACK), root(NIL) {}
 
     /**
      * @brief Constructor de copia
      * @param other Árbol a copiar
      * @complexity O(n)
+     *
+     * Copia el slab de una vez: los índices siguen siendo válidos en la copia.
+     */
+    RedBlackTree(const RedBlackTree &other) : nodes(other.nodes), nil(Augment::identity(), BLACK), root(other.root) {}
+
+    /**
+     * @brief Constructor de movimiento
+     * @param other Árbol a mover; queda vacío
+     * @complexity O(1)
      */
-    RedBlackTree(const RedBlackTree &other);
+    RedBlackTree(RedBlackTree &&other) : nodes(std::move(other.nodes)), nil(Augment::identity(), BLACK), root(other.root)
+    {
+        other.reset();
+    }
 
     /**
      * @brief Operador de asignación
@@ -439,110 +1496,449 @@ public:
      * @return Referencia al árbol actual
      * @complexity O(n)
      */
-    RedBlackTree &operator=(const RedBlackTree &other);
+    RedBlackTree &operator=(const RedBlackTree &other)
+    {
+        if (this != &other)
+        {
+            nodes = other.nodes;
+            root = other.root;
+        }
+        return *this;
+    }
 
     /**
-     * @brief Destructor
-     * @complexity O(n)
+     * @brief Operador de asignación por movimiento
+     * @param other Árbol a mover; queda vacío
+     * @return Referencia al árbol actual
+     * @complexity O(n) para liberar el contenido actual
+     */
+    RedBlackTree &operator=(RedBlackTree &&other)
+    {
+        if (this != &other)
+        {
+            nodes = std::move(other.nodes);
+            root = other.root;
+            other.reset();
+        }
+        return *this;
+    }
+
+    // ==================== OPERACIONES PRINCIPALES ====================
+
+    /**
+     * @brief Inserta un nuevo par Key-Value
+     * @param k Clave a insertar
+     * @param v Valor asociado
+     * @throw std::overflow_error si el árbol ya tiene 2^31 - 1 nodos
+     * @complexity O(log n) garantizado
+     *
+     * Pasos:
+     * 1. Insertar como en BST normal
+     * 2. Colorear el nuevo nodo de ROJO
+     * 3. Llamar a insertFixup para restaurar propiedades
+     * 4. Asegurar que la raíz sea NEGRA
      *
-     * Libera toda la memoria del árbol.
+     * Si la clave existe, actualiza el valor.
      */
-    ~RedBlackTree()
+    void insert(const Key &k, const Value &v)
     {
-        clear();
-        delete nil;
+        auto copyValue = [&v]() -> const Value & { return v; };
+        bool inserted;
+        Index x = findOrAllocate(k, copyValue, inserted);
+        if (!inserted)
+        {
+            nodeAt(x).setValue(v);
+            pullToRoot(x);
+        }
     }
 
-    // ==================== OPERACIONES PRINCIPALES ====================
+    /**
+     * @brief Obtiene el valor de k, insertándolo con factory() si no existe
+     * @param k Clave a buscar o insertar
+     * @param factory Función sin argumentos que devuelve el valor inicial (solo se llama si k no existe)
+     * @return Referencia al valor de k
+     * @throw std::overflow_error si hay que insertar y el árbol ya tiene 2^31 - 1 nodos
+     * @complexity O(log n) garantizado, una sola bajada
+     *
+     * La referencia deja de ser válida con la próxima inserción o eliminación.
+     * Si el resumen depende del valor, modificarlo por la referencia no lo
+     * actualiza: para eso está upsert.
+     */
+    template <typename Factory>
+    Value &getOrInsert(const Key &k, Factory factory)
+    {
+        bool inserted;
+        return nodeAt(findOrAllocate(k, factory, inserted)).getValue();
+    }
+
+    /**
+     * @brief Modifica el valor de k en el lugar, insertándolo con Value() si no existe
+     * @param k Clave a modificar o insertar
+     * @param fn Función que recibe Value& (también se llama con el valor recién insertado)
+     * @return true si k no existía y se insertó
+     * @throw std::overflow_error si hay que insertar y el árbol ya tiene 2^31 - 1 nodos
+     * @complexity O(log n) garantizado, una sola bajada
+     *
+     * Ejemplo (contar palabras): tree.upsert(palabra, [](int &c) { c++; });
+     * Los resúmenes del camino se recalculan después de llamar a fn.
+     */
+    template <typename Fn>
+    bool upsert(const Key &k, Fn fn)
+    {
+        auto defaultValue = []() { return Value(); };
+        bool inserted;
+        Index x = findOrAllocate(k, defaultValue, inserted);
+        fn(nodeAt(x).getValue());
+        pullToRoot(x);
+        return inserted;
+    }
+
+    /**
+     * @brief Elimina una clave del árbol
+     * @param k Clave a eliminar
+     * @return true si se eliminó, false si no existía
+     * @complexity O(log n) garantizado
+     *
+     * Pasos:
+     * 1. Buscar el nodo a eliminar
+     * 2. Eliminar como en BST (considerar casos)
+     * 3. Si se eliminó un nodo NEGRO, llamar deleteFixup
+     * 4. Asegurar que la raíz sea NEGRA
+     */
+    bool remove(const Key &k)
+    {
+        Index z = searchHelper(root, k);
+        if (z == NIL)
+            return false;
+
+        Index y = z;
+        Color yOriginalColor = color(y);
+        Index x;
+
+        if (left(z) == NIL)
+        {
+            x = right(z);
+            transplant(z, right(z));
+        }
+        else if (right(z) == NIL)
+        {
+            x = left(z);
+            transplant(z, left(z));
+        }
+        else
+        {
+            // Dos hijos: el sucesor inorden ocupa el lugar de z
+            y = findMinHelper(right(z));
+            yOriginalColor = color(y);
+            x = right(y);
+            if (parent(y) == z)
+            {
+                setParent(x, y);
+            }
+            else
+            {
+                transplant(y, right(y));
+                setRight(y, right(z));
+                setParent(right(y), y);
+            }
+            transplant(z, y);
+            setLeft(y, left(z));
+            setParent(left(y), y);
+            setColor(y, color(z));
+        }
+
+        // parent(x) es el nodo más bajo que cambió (también si x es nil)
+        pullToRoot(parent(x));
+
+        if (yOriginalColor == BLACK)
+            deleteFixup(x);
+
+        releaseNode(z);
+        return true;
+    }
+
+    /**
+     * @brief Busca una clave en el árbol
+     * @param k Clave a buscar
+     * @return true si existe, false en caso contrario
+     * @complexity O(log n) garantizado
+     */
+    bool find(const Key &k) const
+    {
+        return searchHelper(root, k) != NIL;
+    }
+
+    /**
+     * @brief Busca una clave de otro tipo comparable con Key (por ejemplo string_view con claves string)
+     * @param k Clave a buscar; se compara directamente, sin construir un Key temporal
+     * @return true si existe, false en caso contrario
+     * @complexity O(log n) garantizado
+     */
+    template <typename K, typename = EnableIfComparable<K>>
+    bool find(const K &k) const
+    {
+        return searchHelper(root, k) != NIL;
+    }
+
+    /**
+     * @brief Obtiene el valor asociado a una clave con una sola bajada
+     * @param k Clave a buscar
+     * @return Puntero al valor, nullptr si no existe
+     * @complexity O(log n) garantizado
+     *
+     * Reemplaza el par find + getValue/insert: el valor se lee o se modifica
+     * por el puntero. El puntero deja de ser válido con la próxima inserción
+     * o eliminación.
+     */
+    Value *get(const Key &k)
+    {
+        Index x = searchHelper(root, k);
+        return x == NIL ? nullptr : &nodeAt(x).getValue();
+    }
+
+    /**
+     * @brief Obtiene el valor asociado a una clave (versión const)
+     * @param k Clave a buscar
+     * @return Puntero constante al valor, nullptr si no existe
+     * @complexity O(log n) garantizado
+     */
+    const Value *get(const Key &k) const
+    {
+        Index x = searchHelper(root, k);
+        return x == NIL ? nullptr : &nodeAt(x).getValue();
+    }
+
+    /**
+     * @brief Obtiene el valor de una clave de otro tipo comparable con Key
+     * @param k Clave a buscar, sin construir un Key temporal
+     * @return Puntero al valor, nullptr si no existe
+     * @complexity O(log n) garantizado
+     */
+    template <typename K, typename = EnableIfComparable<K>>
+    Value *get(const K &k)
+    {
+        Index x = searchHelper(root, k);
+        return x == NIL ? nullptr : &nodeAt(x).getValue();
+    }
+
+    /**
+     * @brief Obtiene el valor de una clave de otro tipo comparable con Key (versión const)
+     * @param k Clave a buscar, sin construir un Key temporal
+     * @return Puntero constante al valor, nullptr si no existe
+     * @complexity O(log n) garantizado
+     */
+    template <typename K, typename = EnableIfComparable<K>>
+    const Value *get(const K &k) const
+    {
+        Index x = searchHelper(root, k);
+        return x == NIL ? nullptr : &nodeAt(x).getValue();
+    }
+
+    /**
+     * @brief Obtiene el valor asociado a una clave
+     * @param k Clave a buscar
+     * @return Puntero constante al valor, nullptr si no existe
+     * @complexity O(log n) garantizado
+     *
+     * El puntero deja de ser válido con la próxima inserción o eliminación.
+     * Equivale a get(k).
+     */
+    const Value *getValue(const Key &k) const
+    {
+        Index x = searchHelper(root, k);
+        return x == NIL ? nullptr : &nodeAt(x).getValue();
+    }
+
+    /**
+     * @brief Obtiene el valor asociado a una clave (versión no const)
+     * @param k Clave a buscar
+     * @return Puntero al valor, nullptr si no existe
+     * @complexity O(log n) garantizado
+     *
+     * El puntero deja de ser válido con la próxima inserción o eliminación.
+     * Equivale a get(k).
+     */
+    Value *getValue(const Key &k)
+    {
+        Index x = searchHelper(root, k);
+        return x == NIL ? nullptr : &nodeAt(x).getValue();
+    }
+
+    // ==================== CONSTRUCCIÓN EN BLOQUE, UNIÓN Y DIVISIÓN ====================
+
+    /**
+     * @brief Reemplaza el contenido por pares (clave, valor) ya ordenados
+     * @param first Inicio del rango de pares (p.first = clave, p.second = valor)
+     * @param last Fin del rango
+     * @throw std::invalid_argument si las claves no son estrictamente crecientes (el árbol queda vacío)
+     * @throw std::overflow_error si hay más de 2^31 - 1 pares
+     * @complexity O(n), una sola reserva del slab si los iteradores son de avance
+     *
+     * Los nodos quedan en el slab en orden de clave, así que recorrer el
+     * árbol en orden recorre la memoria de forma secuencial.
+     */
+    template <typename InputIt>
+    void buildFromSorted(InputIt first, InputIt last)
+    {
+        reset();
+        try
+        {
+            reserveFor(first, last, typename std::iterator_traits<InputIt>::iterator_category());
+            for (; first != last; ++first)
+            {
+                if (!nodes.empty() && !(nodes.back().getKey() < first->first))
+                    throw std::invalid_argument("RedBlackTree: buildFromSorted needs strictly increasing keys");
+                allocateNode(first->first, first->second);
+            }
+        }
+        catch (...)
+        {
+            // Los nodos copiados hasta acá no están enlazados
+            reset();
+            throw;
+        }
+        linkSorted();
+    }
+
+    /**
+     * @brief Agrega todos los elementos de other, cuyas claves son todas mayores (o todas menores)
+     * @param other Árbol a unir; queda vacío
+     * @throw std::invalid_argument si los rangos de claves se superponen (ningún árbol cambia)
+     * @throw std::overflow_error si juntos superan 2^31 - 1 nodos (ningún árbol cambia)
+     * @complexity O(min(n, m) + log(n + m)): se copian los nodos del árbol más chico
+     *
+     * Saca el mínimo del árbol de claves mayores y lo usa como nodo
+     * intermedio de joinNodes.
+     */
+    void join(RedBlackTree &&other)
+    {
+        if (this == &other || other.empty())
+            return;
+        if (empty())
+        {
+            swapWith(other);
+            return;
+        }
+        checkCombinedSize(other);
+
+        bool otherIsRight = keyOf(findMaxHelper(root)) < other.keyOf(other.findMinHelper(other.root));
+        if (!otherIsRight && !(other.keyOf(other.findMaxHelper(other.root)) < keyOf(findMinHelper(root))))
+            throw std::invalid_argument("RedBlackTree: join needs the key ranges of both trees to be disjoint");
+
+        // this se queda con el árbol más grande y recibe los nodos del otro
+        if (size() < other.size())
+        {
+            swapWith(other);
+            otherIsRight = !otherIsRight;
+        }
+
+        // El nodo intermedio es el mínimo del árbol de claves mayores
+        RedBlackTree &rightTree = otherIsRight ? other : *this;
+        Index minIndex = rightTree.findMinHelper(rightTree.root);
+        Key middleKey = rightTree.keyOf(minIndex);
+        Value middleValue = rightTree.nodeAt(minIndex).getValue();
+        rightTree.remove(middleKey);
+
+        Index thisRoot = root;
+        Index otherRoot = importNodes(other);
+        Index k = allocateNode(middleKey, middleValue);
+        if (otherIsRight)
+            joinNodes(thisRoot, k, otherRoot);
+        else
+            joinNodes(otherRoot, k, thisRoot);
+    }
 
     /**
-     * @brief Inserta un nuevo par Key-Value
-     * @param k Clave a insertar
-     * @param v Valor asociado
-     * @complexity O(log n) garantizado
+     * @brief Agrega todos los elementos de other (unión)
+     * @param other Árbol a unir; queda vacío
+     * @throw std::overflow_error si juntos superan 2^31 - 1 nodos (ningún árbol cambia)
+     * @complexity O(min(n, m) + log(n + m)) si los rangos de claves no se superponen, O(n + m) si se superponen
      *
-     * Pasos:
-     * 1. Insertar como en BST normal
-     * 2. Colorear el nuevo nodo de ROJO
-     * 3. Llamar a insertFixup para restaurar propiedades
-     * 4. Asegurar que la raíz sea NEGRA
-     *
-     * Si la clave existe, actualiza el valor.
+     * Si una clave está en los dos árboles queda el valor de other, como si
+     * se insertaran sus pares uno por uno. Con rangos superpuestos mezcla los
+     * dos recorridos en orden en un slab nuevo y lo enlaza con linkSorted.
      */
-    void insert(const Key &k, const Value &v)
+    void merge(RedBlackTree &&other)
     {
-        Node *z = new Node(k, v);
-        z->setLeft(nil);
-        z->setRight(nil);
+        if (this == &other || other.empty())
+            return;
+        if (empty() || keyOf(findMaxHelper(root)) < other.keyOf(other.findMinHelper(other.root)) ||
+            other.keyOf(other.findMaxHelper(other.root)) < keyOf(findMinHelper(root)))
+        {
+            join(std::move(other));
+            return;
+        }
 
-        Node *y = nil;
-        Node *x = root;
+        checkCombinedSize(other);
 
-        while (x != nil)
+        std::vector<Node> merged;
+        merged.reserve(nodes.size() + other.size());
+
+        // successor solo lee los enlaces, que siguen intactos después de mover clave y valor
+        Index a = findMinHelper(root);
+        Index b = other.findMinHelper(other.root);
+        while (a != NIL || b != NIL)
         {
-            y = x;
-            if (k < x->getKey())
-                x = x->getLeft();
-            else if (k > x->getKey())
-                x = x->getRight();
+            if (b == NIL || (a != NIL && keyOf(a) < other.keyOf(b)))
+            {
+                merged.push_back(std::move(nodeAt(a)));
+                a = successor(a);
+            }
             else
             {
-                x->setValue(v);
-                delete z;
-                return;
+                if (a != NIL && !(other.keyOf(b) < keyOf(a)))
+                    a = successor(a); // Clave repetida: gana el valor de other
+                merged.push_back(std::move(other.nodeAt(b)));
+                b = other.successor(b);
             }
         }
 
-        z->setParent(y);
-        if(y == nil)
-            root = z;
-        else if (k < y->getKey())
-            y->setLeft(z);
-        else
-            y->setRight(z);
-
-        sz++;
-        insertFixup(z);
-        root->setColor(BLACK);
+        nodes.swap(merged);
+        nil = NodeLinks(Augment::identity(), BLACK);
+        linkSorted();
+        other.reset();
     }
 
     /**
-     * @brief Elimina una clave del árbol
-     * @param k Clave a eliminar
-     * @return true si se eliminó, false si no existía
-     * @complexity O(log n) garantizado
-     *
-     * Pasos:
-     * 1. Buscar el nodo a eliminar
-     * 2. Eliminar como en BST (considerar casos)
-     * 3. Si se eliminó un nodo NEGRO, llamar deleteFixup
-     * 4. Asegurar que la raíz sea NEGRA
-     */
-    bool remove(const Key &k);
-
-    /**
-     * @brief Busca una clave en el árbol
-     * @param k Clave a buscar
-     * @return true si existe, false en caso contrario
-     * @complexity O(log n) garantizado
+     * @brief Agrega copias de todos los elementos de other (unión)
+     * @param other Árbol a unir; no se modifica
+     * @complexity O(m + merge)
      */
-    bool find(const Key &k) const;
+    void merge(const RedBlackTree &other)
+    {
+        RedBlackTree copy(other);
+        merge(std::move(copy));
+    }
 
     /**
-     * @brief Obtiene el valor asociado a una clave
-     * @param k Clave a buscar
-     * @return Puntero constante al valor, nullptr si no existe
-     * @complexity O(log n) garantizado
+     * @brief Divide el árbol por una clave
+     * @param k Clave de corte
+     * @return Árbol con las claves >= k; este árbol se queda con las claves < k
+     * @complexity O(log n + min(|izquierdo|, |derecho|)): se copian los nodos del lado más chico
      */
-    const Value *getValue(const Key &k) const;
+    RedBlackTree split(const Key &k)
+    {
+        RedBlackTree other;
+        Index l, r;
+        splitNodes(root, k, l, r);
 
-    /**
-     * @brief Obtiene el valor asociado a una clave (versión no const)
-     * @param k Clave a buscar
-     * @return Puntero al valor, nullptr si no existe
-     * @complexity O(log n) garantizado
-     */
-    Value *getValue(const Key &k);
+        std::vector<Index> moved;
+        if (isSmallerOrEqual(r, l))
+        {
+            other.root = exportSubtree(r, other, NIL, moved);
+            root = l;
+            releaseMoved(moved);
+        }
+        else
+        {
+            // Se copia el lado izquierdo y se intercambian los contenidos
+            other.root = exportSubtree(l, other, NIL, moved);
+            root = r;
+            releaseMoved(moved);
+            swapWith(other);
+        }
+        return other;
+    }
 
     // ==================== RECORRIDOS ====================
 
@@ -552,25 +1948,53 @@ public:
      *
      * Imprime los elementos en orden ascendente por clave.
      */
-    void inorder() const;
+    void inorder() const
+    {
+        inorderHelper(root);
+    }
 
     /**
      * @brief Recorrido preorden
      * @complexity O(n)
      */
-    void preorder() const;
+    void preorder() const
+    {
+        preorderHelper(root);
+    }
 
     /**
      * @brief Recorrido postorden
      * @complexity O(n)
      */
-    void postorder() const;
+    void postorder() const
+    {
+        postorderHelper(root);
+    }
 
     /**
      * @brief Recorrido por niveles (BFS)
      * @complexity O(n)
      */
-    void levelOrder() const;
+    void levelOrder() const
+    {
+        if (root == NIL)
+            return;
+
+        std::queue<Index> q;
+        q.push(root);
+        while (!q.empty())
+        {
+            Index current = q.front();
+            q.pop();
+
+            std::cout << keyOf(current) << ": " << nodeAt(current).getValue() << std::endl;
+
+            if (left(current) != NIL)
+                q.push(left(current));
+            if (right(current) != NIL)
+                q.push(right(current));
+        }
+    }
 
     // ==================== OPERACIONES DE CONSULTA ====================
 
@@ -580,7 +2004,12 @@ public:
      * @throw std::runtime_error si el árbol está vacío
      * @complexity O(log n) garantizado
      */
-    const Key &findMin() const;
+    const Key &findMin() const
+    {
+        if (root == NIL)
+            throw std::runtime_error("El árbol está vacío");
+        return keyOf(findMinHelper(root));
+    }
 
     /**
      * @brief Encuentra la clave máxima
@@ -588,25 +2017,68 @@ public:
      * @throw std::runtime_error si el árbol está vacío
      * @complexity O(log n) garantizado
      */
-    const Key &findMax() const;
+    const Key &findMax() const
+    {
+        if (root == NIL)
+            throw std::runtime_error("El árbol está vacío");
+        return keyOf(findMaxHelper(root));
+    }
 
     /**
      * @brief Encuentra el sucesor de una clave
-     * @param k Clave de referencia
-     * @return Clave del sucesor
+     * @param k Clave de referencia (no tiene que estar en el árbol)
+     * @return Clave del sucesor (la menor clave mayor que k)
      * @throw std::runtime_error si no existe sucesor
      * @complexity O(log n) garantizado
      */
-    const Key &findSuccessor(const Key &k) const;
+    const Key &findSuccessor(const Key &k) const
+    {
+        Index current = root;
+        Index candidate = NIL;
+        while (current != NIL)
+        {
+            if (k < keyOf(current))
+            {
+                candidate = current; // Posible sucesor
+                current = left(current);
+            }
+            else
+            {
+                current = right(current);
+            }
+        }
+        if (candidate == NIL)
+            throw std::runtime_error("No existe sucesor para la clave dada");
+        return keyOf(candidate);
+    }
 
     /**
      * @brief Encuentra el predecesor de una clave
-     * @param k Clave de referencia
-     * @return Clave del predecesor
+     * @param k Clave de referencia (no tiene que estar en el árbol)
+     * @return Clave del predecesor (la mayor clave menor que k)
      * @throw std::runtime_error si no existe predecesor
      * @complexity O(log n) garantizado
      */
-    const Key &findPredecessor(const Key &k) const;
+    const Key &findPredecessor(const Key &k) const
+    {
+        Index current = root;
+        Index candidate = NIL;
+        while (current != NIL)
+        {
+            if (keyOf(current) < k)
+            {
+                candidate = current; // Posible predecesor
+                current = right(current);
+            }
+            else
+            {
+                current = left(current);
+            }
+        }
+        if (candidate == NIL)
+            throw std::runtime_error("No existe predecesor para la clave dada");
+        return keyOf(candidate);
+    }
 
     /**
      * @brief Calcula la altura del árbol
@@ -615,7 +2087,10 @@ public:
      *
      * En un RBT bien balanceado, altura ≤ 2 * log₂(n+1)
      */
-    int height() const;
+    int height() const
+    {
+        return heightHelper(root);
+    }
 
     /**
      * @brief Calcula la altura negra del árbol
@@ -624,30 +2099,325 @@ public:
      *
      * Todos los caminos deben tener la misma altura negra.
      */
-    int blackHeight() const;
+    int blackHeight() const
+    {
+        return blackHeightHelper(root);
+    }
 
     /**
      * @brief Obtiene el número de nodos
      * @return Tamaño del árbol
      * @complexity O(1)
      */
-    unsigned int size() const;
+    unsigned int size() const
+    {
+        return static_cast<unsigned int>(nodes.size());
+    }
 
     /**
      * @brief Verifica si el árbol está vacío
      * @return true si está vacío, false en caso contrario
      * @complexity O(1)
      */
-    bool empty() const;
+    bool empty() const
+    {
+        return root == NIL;
+    }
+
+    /**
+     * @brief Reserva espacio en el slab para n nodos
+     * @param n Número de nodos esperado
+     * @complexity O(size()) si hay que mover el slab
+     *
+     * Evita que el slab se realoje mientras se insertan n nodos.
+     */
+    void reserve(unsigned int n)
+    {
+        nodes.reserve(n);
+    }
 
     /**
      * @brief Elimina todos los nodos
      * @complexity O(n)
+     *
+     * Conserva la capacidad del slab para las siguientes inserciones.
      */
     void clear()
     {
-        clearHelper(root);
-        root = nil;
+        reset();
+    }
+
+    // ==================== ESTADÍSTICAS DE ORDEN ====================
+
+    /**
+     * @brief Encuentra la k-ésima clave más chica (desde 0)
+     * @param k Posición en orden ascendente (0 = mínimo)
+     * @return Clave en la posición k
+     * @throw std::out_of_range si k >= size()
+     * @complexity O(log n) garantizado
+     *
+     * Requiere la política OrderStatistics. Por ejemplo, la mediana es
+     * select(size() / 2).
+     */
+    const Key &select(unsigned int k) const
+    {
+        static_assert(!std::is_same<Augment, NoAugmentation>::value, "select needs RedBlackTree<Key, Value, OrderStatistics>");
+        if (k >= size())
+            throw std::out_of_range("RedBlackTree: select index out of range");
+
+        Index x = root;
+        while (true)
+        {
+            unsigned int leftCount = Augment::count(summary(left(x)));
+            if (k < leftCount)
+            {
+                x = left(x);
+            }
+            else if (k == leftCount)
+            {
+                return keyOf(x);
+            }
+            else
+            {
+                k -= leftCount + 1;
+                x = right(x);
+            }
+        }
+    }
+
+    /**
+     * @brief Cuenta las claves menores que k
+     * @param k Clave de referencia (no tiene que estar en el árbol)
+     * @return Número de claves < k (la posición de k si está en el árbol)
+     * @complexity O(log n) garantizado
+     *
+     * Requiere la política OrderStatistics.
+     */
+    unsigned int rank(const Key &k) const
+    {
+        static_assert(!std::is_same<Augment, NoAugmentation>::value, "rank needs RedBlackTree<Key, Value, OrderStatistics>");
+        unsigned int count = 0;
+        Index x = root;
+        while (x != NIL)
+        {
+            if (keyOf(x) < k)
+            {
+                count += Augment::count(summary(left(x))) + 1;
+                x = right(x);
+            }
+            else
+            {
+                x = left(x);
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @brief Cuenta las claves en [lo, hi]
+     * @param lo Clave mínima del rango (incluida)
+     * @param hi Clave máxima del rango (incluida)
+     * @return Número de claves k con lo <= k <= hi (0 si hi < lo)
+     * @complexity O(log n) garantizado
+     *
+     * Requiere la política OrderStatistics.
+     */
+    unsigned int countInRange(const Key &lo, const Key &hi) const
+    {
+        static_assert(!std::is_same<Augment, NoAugmentation>::value, "countInRange needs RedBlackTree<Key, Value, OrderStatistics>");
+        if (hi < lo)
+            return 0;
+
+        // Claves <= hi
+        unsigned int upTo = 0;
+        Index x = root;
+        while (x != NIL)
+        {
+            if (hi < keyOf(x))
+            {
+                x = left(x);
+            }
+            else
+            {
+                upTo += Augment::count(summary(left(x))) + 1;
+                x = right(x);
+            }
+        }
+        return upTo - rank(lo);
+    }
+
+    // ==================== CONSULTAS SOBRE LOS RESÚMENES ====================
+
+    /**
+     * @brief Resumen de todo el árbol
+     * @return combine de of(k, v) para todas las claves, en orden
+     * @complexity O(1)
+     */
+    const Summary &aggregate() const
+    {
+        return summary(root);
+    }
+
+    /**
+     * @brief Resumen de las claves en [lo, hi]
+     * @param lo Clave mínima del rango (incluida)
+     * @param hi Clave máxima del rango (incluida)
+     * @return combine de of(k, v) para las claves del rango, en orden (identity() si no hay)
+     * @complexity O(log n) garantizado
+     *
+     * Baja hasta el nodo donde se separan los caminos hacia lo y hi, y desde
+     * ahí suma subárboles completos a cada lado.
+     */
+    Summary aggregate(const Key &lo, const Key &hi) const
+    {
+        if (hi < lo)
+            return Augment::identity();
+
+        Index x = root;
+        while (x != NIL)
+        {
+            if (keyOf(x) < lo)
+                x = right(x);
+            else if (hi < keyOf(x))
+                x = left(x);
+            else
+                break;
+        }
+        if (x == NIL)
+            return Augment::identity();
+
+        // Claves >= lo del subárbol izquierdo: cada nodo que entra va antes que lo ya acumulado
+        Summary leftPart = Augment::identity();
+        for (Index y = left(x); y != NIL;)
+        {
+            if (keyOf(y) < lo)
+            {
+                y = right(y);
+            }
+            else
+            {
+                leftPart = Augment::combine(Augment::combine(Augment::of(keyOf(y), nodeAt(y).getValue()), summary(right(y))), leftPart);
+                y = left(y);
+            }
+        }
+
+        // Claves <= hi del subárbol derecho: cada nodo que entra va después de lo ya acumulado
+        Summary rightPart = Augment::identity();
+        for (Index y = right(x); y != NIL;)
+        {
+            if (hi < keyOf(y))
+            {
+                y = left(y);
+            }
+            else
+            {
+                rightPart = Augment::combine(rightPart, Augment::combine(summary(left(y)), Augment::of(keyOf(y), nodeAt(y).getValue())));
+                y = right(y);
+            }
+        }
+
+        return Augment::combine(Augment::combine(leftPart, Augment::of(keyOf(x), nodeAt(x).getValue())), rightPart);
+    }
+
+    /**
+     * @brief Recorre en orden los subárboles cuyo resumen puede contener resultados
+     * @param mayContain Predicado sobre un Summary: false descarta el subárbol completo
+     * @param fn Función llamada como fn(clave, valor) para cada nodo de los subárboles no descartados
+     * @complexity O(n) en el peor caso; O(k log n) si mayContain solo acepta subárboles con resultados
+     *
+     * fn recibe todos los nodos de los subárboles aceptados, así que debe
+     * filtrar el nodo en sí. Es la base de las consultas de IntervalTree.
+     */
+    template <typename MayContain, typename Fn>
+    void forEachWhere(MayContain mayContain, Fn fn) const
+    {
+        forEachWhereHelper(root, mayContain, fn);
+    }
+
+    // ==================== ITERACIÓN Y RANGOS ====================
+
+    /**
+     * @brief Iterador al elemento con la menor clave
+     * @complexity O(log n)
+     */
+    iterator begin() { return iterator(this, root == NIL ? NIL : findMinHelper(root)); }
+    const_iterator begin() const { return const_iterator(this, root == NIL ? NIL : findMinHelper(root)); }
+
+    /**
+     * @brief Iterador después del último elemento
+     * @complexity O(1)
+     */
+    iterator end() { return iterator(this, NIL); }
+    const_iterator end() const { return const_iterator(this, NIL); }
+
+    /**
+     * @brief Primer elemento cuya clave no es menor que k
+     * @param k Clave de referencia
+     * @return Iterador al elemento, end() si no existe
+     * @complexity O(log n) garantizado
+     */
+    iterator lower_bound(const Key &k) { return iterator(this, lowerBoundHelper(k)); }
+    const_iterator lower_bound(const Key &k) const { return const_iterator(this, lowerBoundHelper(k)); }
+
+    /**
+     * @brief Primer elemento cuya clave es mayor que k
+     * @param k Clave de referencia
+     * @return Iterador al elemento, end() si no existe
+     * @complexity O(log n) garantizado
+     */
+    iterator upper_bound(const Key &k) { return iterator(this, upperBoundHelper(k)); }
+    const_iterator upper_bound(const Key &k) const { return const_iterator(this, upperBoundHelper(k)); }
+
+    /**
+     * @brief Rango de elementos con clave igual a k
+     * @param k Clave de referencia
+     * @return Par (lower_bound(k), upper_bound(k)); vacío si k no existe
+     * @complexity O(log n) garantizado
+     */
+    std::pair<iterator, iterator> equal_range(const Key &k)
+    {
+        Index lo = lowerBoundHelper(k);
+        if (lo == NIL || k < keyOf(lo))
+            return std::make_pair(iterator(this, lo), iterator(this, lo));
+        return std::make_pair(iterator(this, lo), iterator(this, successor(lo)));
+    }
+
+    std::pair<const_iterator, const_iterator> equal_range(const Key &k) const
+    {
+        Index lo = lowerBoundHelper(k);
+        if (lo == NIL || k < keyOf(lo))
+            return std::make_pair(const_iterator(this, lo), const_iterator(this, lo));
+        return std::make_pair(const_iterator(this, lo), const_iterator(this, successor(lo)));
+    }
+
+    /**
+     * @brief Visita en orden los elementos con clave en [lo, hi]
+     * @param lo Clave mínima del rango (incluida)
+     * @param hi Clave máxima del rango (incluida)
+     * @param fn Función llamada como fn(clave, valor); el valor se puede modificar
+     * @complexity O(log n + k), con k el número de elementos visitados
+     *
+     * fn no debe insertar ni eliminar elementos del árbol.
+     */
+    template <typename Fn>
+    void forEachInRange(const Key &lo, const Key &hi, Fn fn)
+    {
+        for (Index x = lowerBoundHelper(lo); x != NIL && !(hi < keyOf(x)); x = successor(x))
+            fn(keyOf(x), nodeAt(x).getValue());
+    }
+
+    /**
+     * @brief Visita en orden los elementos con clave en [lo, hi] (versión const)
+     * @param lo Clave mínima del rango (incluida)
+     * @param hi Clave máxima del rango (incluida)
+     * @param fn Función llamada como fn(clave, valor)
+     * @complexity O(log n + k), con k el número de elementos visitados
+     */
+    template <typename Fn>
+    void forEachInRange(const Key &lo, const Key &hi, Fn fn) const
+    {
+        for (Index x = lowerBoundHelper(lo); x != NIL && !(hi < keyOf(x)); x = successor(x))
+            fn(keyOf(x), nodeAt(x).getValue());
     }
 
     // ==================== OPERACIONES DE VERIFICACIÓN ====================
@@ -663,7 +2433,31 @@ public:
      * 3. Todos los caminos tienen el mismo black-height
      * 4. Propiedades BST se mantienen
      */
-    bool verifyProperties() const;
+    bool verifyProperties() const
+    {
+        if (color(NIL) != BLACK || color(root) != BLACK)
+            return false;
+        if (root != NIL && parent(root) != NIL)
+            return false;
+
+        int pathBlackCount = -1;
+        if (!verifyPropertiesHelper(root, 0, pathBlackCount))
+            return false;
+
+        // Las claves en orden deben ser estrictamente crecientes y cubrir el slab
+        if (root == NIL)
+            return size() == 0;
+        unsigned int count = 1;
+        Index prev = findMinHelper(root);
+        for (Index x = successor(prev); x != NIL; x = successor(x))
+        {
+            if (!(keyOf(prev) < keyOf(x)))
+                return false;
+            prev = x;
+            count++;
+        }
+        return count == size();
+    }
 
     /**
      * @brief Imprime el árbol con colores
@@ -671,7 +2465,10 @@ public:
      *
      * Muestra la estructura con (R) para rojo y (B) para negro.
      */
-    void printTree() const;
+    void printTree() const
+    {
+        printTreeHelper(root, "", false);
+    }
 
     /**
      * @brief Imprime estadísticas del árbol
@@ -679,31 +2476,14 @@ public:
      *
      * Muestra: tamaño, altura, altura negra, si es válido.
      */
-    void printStats() const;
+    void printStats() const
+    {
+        std::cout << "Tamaño: " << size() << std::endl;
+        std::cout << "Altura: " << height() << std::endl;
+        std::cout << "Altura negra: " << blackHeight() << std::endl;
+        std::cout << "Bytes por nodo: " << sizeof(Node) << std::endl;
+        std::cout << "Válido: " << (verifyProperties() ? "sí" : "no") << std::endl;
+    }
 };
 
-// ==================== NOTA PARA IMPLEMENTACIÓN ====================
-/*
- * ORDEN SUGERIDO PARA IMPLEMENTAR:
- *
- * 1. Constructor, destructor, clear, copyHelper
- * 2. Rotaciones (rotateLeft, rotateRight)
- * 3. insert básico (sin fixup primero)
- * 4. insertFixup (los 3 casos)
- * 5. find, searchHelper, findMin, findMax
- * 6. Recorridos (inorder, preorder, postorder, levelOrder)
- * 7. remove básico (sin fixup)
- * 8. deleteFixup (los 4 casos) - ¡El más complejo!
- * 9. successor, predecessor
- * 10. verifyProperties (para debugging)
- * 11. printTree con colores
- *
- * TIPS:
- * - Usa el nodo nil en lugar de nullptr para simplificar verificaciones
- * - Siempre verifica nullptr antes de acceder a propiedades
- * - Dibuja en papel cada caso de fixup antes de codear
- * - Prueba insert primero, remove después (es más complejo)
- * - verifyProperties() es tu mejor amigo para debugging
- */
-
-#endif // __RED_BLACK_TREE__
\ No newline at end of file
+#endif // __RED_BLACK_TREE__
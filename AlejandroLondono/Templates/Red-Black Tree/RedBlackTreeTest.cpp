@@ -0,0 +1,520 @@
+/**
+ * @file RedBlackTreeTest.cpp
+ * @brief Pruebas para la clase RedBlackTree
+ * @date 2025
+ */
+
+#include "RedBlackTree.hh"
+#include "IntervalTree.hh"
+#include "RangeSumMap.hh"
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+void printHeader(const string &title)
+{
+    cout << "\n" << string(70, '=') << endl;
+    cout << "  " << title << endl;
+    cout << string(70, '=') << endl;
+}
+
+void printTest(const string &test, bool passed)
+{
+    cout << "[" << (passed ? "✓ PASS" : "✗ FAIL") << "] " << test << endl;
+}
+
+/**
+ * @brief Compara el árbol con un std::map de referencia
+ */
+bool sameContents(const RedBlackTree<int, int> &tree, const map<int, int> &reference)
+{
+    if (tree.size() != reference.size())
+        return false;
+    for (const auto &kv : reference)
+    {
+        const int *v = tree.getValue(kv.first);
+        if (v == nullptr || *v != kv.second)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Aumentación no conmutativa (concatenación) para probar el orden de aggregate
+ */
+struct Concatenation
+{
+    typedef string Summary;
+    static Summary identity() { return ""; }
+    static Summary of(const int &, const string &v) { return v; }
+    static Summary combine(const Summary &a, const Summary &b) { return a + b; }
+};
+
+/**
+ * @brief Clave sin constructor por defecto (como un id que siempre se crea a partir de un número)
+ */
+struct SessionId
+{
+    int id;
+    explicit SessionId(int i) : id(i) {}
+    bool operator<(const SessionId &other) const { return id < other.id; }
+};
+
+/**
+ * @brief Valor sin constructor por defecto
+ */
+struct Payload
+{
+    int data;
+    explicit Payload(int d) : data(d) {}
+};
+
+int main()
+{
+    cout << "\n╔══════════════════════════════════════════════════════════════════╗\n";
+    cout << "║              PRUEBAS DEL RED-BLACK TREE                          ║\n";
+    cout << "╚══════════════════════════════════════════════════════════════════╝\n";
+
+    // ==================== PRUEBA 1: Constructor y métodos básicos ====================
+    printHeader("PRUEBA 1: Constructor, empty(), size()");
+
+    RedBlackTree<int, string> arbol;
+    printTest("Árbol creado vacío", arbol.empty());
+    printTest("size() = 0", arbol.size() == 0);
+    printTest("Árbol vacío es válido", arbol.verifyProperties());
+
+    try
+    {
+        arbol.findMin();
+        printTest("findMin() en árbol vacío lanza excepción", false);
+    }
+    catch (runtime_error &e)
+    {
+        printTest("findMin() en árbol vacío lanza excepción", true);
+    }
+
+    // ==================== PRUEBA 2: Insert y find ====================
+    printHeader("PRUEBA 2: Insert y find");
+
+    int claves[] = {50, 30, 70, 20, 40, 60, 80, 10, 25, 35};
+    for (int k : claves)
+        arbol.insert(k, "v" + to_string(k));
+
+    printTest("size() = 10", arbol.size() == 10);
+    printTest("find(25) = true", arbol.find(25));
+    printTest("find(100) = false", !arbol.find(100));
+    printTest("Propiedades RBT", arbol.verifyProperties());
+    printTest("findMin() = 10", arbol.findMin() == 10);
+    printTest("findMax() = 80", arbol.findMax() == 80);
+    printTest("findSuccessor(40) = 50", arbol.findSuccessor(40) == 50);
+    printTest("findPredecessor(45) = 40", arbol.findPredecessor(45) == 40);
+
+    arbol.insert(50, "CINCUENTA");
+    printTest("Clave duplicada actualiza el valor", arbol.size() == 10 && *arbol.getValue(50) == "CINCUENTA");
+
+    arbol.printTree();
+
+    // ==================== PRUEBA 3: Remove ====================
+    printHeader("PRUEBA 3: Remove");
+
+    printTest("remove(30) = true", arbol.remove(30));
+    printTest("remove(30) otra vez = false", !arbol.remove(30));
+    printTest("remove(50) (raíz) = true", arbol.remove(50));
+    printTest("size() = 8", arbol.size() == 8);
+    printTest("Propiedades RBT", arbol.verifyProperties());
+    printTest("Los demás valores siguen intactos", *arbol.getValue(35) == "v35" && *arbol.getValue(80) == "v80");
+
+    // ==================== PRUEBA 4: Copia y movimiento ====================
+    printHeader("PRUEBA 4: Copia y movimiento");
+
+    RedBlackTree<int, string> copia(arbol);
+    copia.remove(10);
+    printTest("La copia es independiente", arbol.find(10) && !copia.find(10));
+
+    RedBlackTree<int, string> movido(std::move(copia));
+    printTest("El árbol movido conserva los elementos", movido.size() == 7 && movido.verifyProperties());
+    printTest("El original movido queda vacío y usable", copia.empty() && copia.verifyProperties());
+    copia.insert(1, "uno");
+    printTest("Insertar en el original movido", copia.size() == 1 && copia.find(1));
+
+    arbol.clear();
+    printTest("clear() deja el árbol vacío", arbol.empty() && arbol.size() == 0 && arbol.verifyProperties());
+
+    // ==================== PRUEBA 5: Operaciones aleatorias contra std::map ====================
+    printHeader("PRUEBA 5: 200000 operaciones aleatorias contra std::map");
+
+    RedBlackTree<int, int> grande;
+    map<int, int> referencia;
+    mt19937 rng(7);
+    bool valido = true;
+    for (int i = 0; i < 200000; i++)
+    {
+        int k = static_cast<int>(rng() % 5000);
+        if (rng() % 3 == 0)
+        {
+            bool quitado = grande.remove(k);
+            if (quitado != (referencia.erase(k) == 1))
+                valido = false;
+        }
+        else
+        {
+            grande.insert(k, i);
+            referencia[k] = i;
+        }
+        if (i % 20000 == 0 && !grande.verifyProperties())
+            valido = false;
+    }
+    printTest("remove() coincide con std::map", valido);
+    printTest("Propiedades RBT", grande.verifyProperties());
+    printTest("Mismo contenido que std::map", sameContents(grande, referencia));
+
+    // ==================== PRUEBA 6: Inserción ordenada ====================
+    printHeader("PRUEBA 6: 1000000 claves ordenadas");
+
+    RedBlackTree<int, int> ordenado;
+    ordenado.reserve(1000000);
+    for (int i = 0; i < 1000000; i++)
+        ordenado.insert(i, i);
+    printTest("Propiedades RBT", ordenado.verifyProperties());
+    printTest("Altura <= 2 * log2(n + 1)", ordenado.height() <= 40);
+    for (int i = 0; i < 1000000; i += 2)
+        ordenado.remove(i);
+    printTest("Eliminar las claves pares", ordenado.size() == 500000 && ordenado.verifyProperties());
+    printTest("find(999999) y !find(999998)", ordenado.find(999999) && !ordenado.find(999998));
+
+    ordenado.printStats();
+
+    // ==================== PRUEBA 7: Iteradores y rangos ====================
+    printHeader("PRUEBA 7: Iteradores, lower_bound/upper_bound y rangos");
+
+    RedBlackTree<int, string> ventanas;
+    for (int t = 0; t <= 100; t += 10)
+        ventanas.insert(t, "t" + to_string(t));
+
+    vector<int> recorridas;
+    for (auto kv : ventanas)
+        recorridas.push_back(kv.first);
+    printTest("begin()..end() en orden", recorridas.size() == 11 && recorridas.front() == 0 && recorridas.back() == 100);
+
+    recorridas.clear();
+    for (auto it = ventanas.end(); it != ventanas.begin();)
+    {
+        --it;
+        recorridas.push_back(it.key());
+    }
+    printTest("Recorrido hacia atrás desde end()", recorridas.size() == 11 && recorridas.front() == 100 && recorridas.back() == 0);
+
+    printTest("lower_bound(30) = 30", ventanas.lower_bound(30).key() == 30);
+    printTest("lower_bound(31) = 40", ventanas.lower_bound(31)->first == 40);
+    printTest("upper_bound(30) = 40", ventanas.upper_bound(30).key() == 40);
+    printTest("lower_bound(101) = end()", ventanas.lower_bound(101) == ventanas.end());
+    auto rango = ventanas.equal_range(50);
+    printTest("equal_range(50) tiene un elemento", rango.first.key() == 50 && ++rango.first == rango.second);
+    rango = ventanas.equal_range(55);
+    printTest("equal_range(55) está vacío", rango.first == rango.second && rango.first.key() == 60);
+
+    ventanas.lower_bound(20)->second = "VEINTE";
+    printTest("Modificar el valor con el iterador", *ventanas.getValue(20) == "VEINTE");
+
+    recorridas.clear();
+    ventanas.forEachInRange(25, 70, [&](const int &k, string &v) {
+        recorridas.push_back(k);
+        v += "!";
+    });
+    printTest("forEachInRange(25, 70) = 30..70", recorridas == vector<int>({30, 40, 50, 60, 70}));
+    printTest("forEachInRange modifica los valores", *ventanas.getValue(70) == "t70!" && *ventanas.getValue(80) == "t80");
+
+    const RedBlackTree<int, string> &soloLectura = ventanas;
+    int visitados = 0;
+    soloLectura.forEachInRange(0, 100, [&](const int &, const string &) { visitados++; });
+    RedBlackTree<int, string>::const_iterator cit = ventanas.begin();
+    printTest("forEachInRange const y const_iterator", visitados == 11 && cit.value() == "t0");
+
+    auto it90 = ventanas.lower_bound(90);
+    for (int t = 1000; t < 1100; t++)
+        ventanas.insert(t, "x");
+    printTest("Insertar no invalida iteradores", it90.key() == 90 && (++it90).key() == 100);
+
+    // ==================== PRUEBA 8: Estadísticas de orden ====================
+    printHeader("PRUEBA 8: select, rank y countInRange (OrderStatistics)");
+
+    RedBlackTree<int, int, OrderStatistics> estadisticas;
+    map<int, int> esperado;
+    bool coincide = true;
+    for (int i = 0; i < 100000; i++)
+    {
+        int k = static_cast<int>(rng() % 20000);
+        if (rng() % 4 == 0)
+        {
+            estadisticas.remove(k);
+            esperado.erase(k);
+        }
+        else
+        {
+            estadisticas.insert(k, i);
+            esperado[k] = i;
+        }
+    }
+    printTest("Propiedades RBT y tamaños de subárbol", estadisticas.verifyProperties());
+
+    vector<int> ordenadas;
+    for (const auto &kv : esperado)
+        ordenadas.push_back(kv.first);
+    for (unsigned int i = 0; i < ordenadas.size(); i += 97)
+    {
+        if (estadisticas.select(i) != ordenadas[i] || estadisticas.rank(ordenadas[i]) != i)
+            coincide = false;
+    }
+    printTest("select(i) y rank(select(i)) = i", coincide);
+    printTest("Mediana = select(size() / 2)", estadisticas.select(estadisticas.size() / 2) == ordenadas[ordenadas.size() / 2]);
+
+    coincide = true;
+    for (int lo = -10; lo < 20010; lo += 1237)
+    {
+        int hi = lo + static_cast<int>(rng() % 5000);
+        unsigned int cuenta = static_cast<unsigned int>(upper_bound(ordenadas.begin(), ordenadas.end(), hi) -
+                                                        lower_bound(ordenadas.begin(), ordenadas.end(), lo));
+        if (estadisticas.countInRange(lo, hi) != cuenta)
+            coincide = false;
+    }
+    printTest("countInRange coincide con el vector ordenado", coincide);
+    printTest("countInRange(hi < lo) = 0", estadisticas.countInRange(10, 5) == 0);
+
+    try
+    {
+        estadisticas.select(estadisticas.size());
+        printTest("select(size()) lanza out_of_range", false);
+    }
+    catch (out_of_range &e)
+    {
+        printTest("select(size()) lanza out_of_range", true);
+    }
+
+    // ==================== PRUEBA 9: Árbol de intervalos ====================
+    printHeader("PRUEBA 9: IntervalTree (solapamiento y stabbing)");
+
+    IntervalTree<int, int> intervalos;
+    vector<pair<int, int>> todos;
+    for (int i = 0; i < 5000; i++)
+    {
+        int lo = static_cast<int>(rng() % 100000);
+        int hi = lo + static_cast<int>(rng() % 500);
+        intervalos.insert(lo, hi, i);
+        todos.push_back(make_pair(lo, hi));
+    }
+    for (int i = 0; i < 1000; i++)
+    {
+        intervalos.remove(todos.back().first, todos.back().second);
+        todos.pop_back();
+    }
+    sort(todos.begin(), todos.end());
+    todos.erase(unique(todos.begin(), todos.end()), todos.end());
+    printTest("Propiedades RBT y resúmenes", intervalos.verifyProperties() && intervalos.size() == todos.size());
+
+    coincide = true;
+    for (int q = 0; q < 200; q++)
+    {
+        int lo = static_cast<int>(rng() % 100000);
+        int hi = lo + static_cast<int>(rng() % 300);
+        vector<pair<int, int>> encontrados, fuerzaBruta;
+        intervalos.forEachOverlapping(lo, hi, [&](const int &a, const int &b, const int &) {
+            encontrados.push_back(make_pair(a, b));
+        });
+        for (const auto &iv : todos)
+        {
+            if (iv.second >= lo && iv.first <= hi)
+                fuerzaBruta.push_back(iv);
+        }
+        if (encontrados != fuerzaBruta)
+            coincide = false;
+    }
+    printTest("forEachOverlapping coincide con fuerza bruta", coincide);
+
+    IntervalTree<int, string> turnos;
+    turnos.insert(8, 12, "mañana");
+    turnos.insert(12, 18, "tarde");
+    turnos.insert(18, 23, "noche");
+    vector<string> enLas12;
+    turnos.forEachContaining(12, [&](const int &, const int &, const string &v) { enLas12.push_back(v); });
+    printTest("forEachContaining(12) = mañana, tarde", enLas12 == vector<string>({"mañana", "tarde"}));
+    try
+    {
+        turnos.insert(5, 1, "inválido");
+        printTest("insert(5, 1) lanza invalid_argument", false);
+    }
+    catch (invalid_argument &e)
+    {
+        printTest("insert(5, 1) lanza invalid_argument", true);
+    }
+
+    // ==================== PRUEBA 10: Sumas por rango ====================
+    printHeader("PRUEBA 10: RangeSumMap y aggregate");
+
+    RangeSumMap<int, long long> sumas;
+    map<int, long long> sumasEsperadas;
+    for (int i = 0; i < 50000; i++)
+    {
+        int k = static_cast<int>(rng() % 10000);
+        long long v = static_cast<long long>(rng() % 1000);
+        unsigned int op = rng() % 4;
+        if (op == 0)
+        {
+            sumas.remove(k);
+            sumasEsperadas.erase(k);
+        }
+        else if (op == 1)
+        {
+            sumas.add(k, v);
+            sumasEsperadas[k] += v;
+        }
+        else
+        {
+            sumas.set(k, v);
+            sumasEsperadas[k] = v;
+        }
+    }
+    printTest("Propiedades RBT y sumas", sumas.verifyProperties());
+
+    coincide = true;
+    for (int q = 0; q < 500; q++)
+    {
+        int lo = static_cast<int>(rng() % 10000) - 100;
+        int hi = lo + static_cast<int>(rng() % 3000);
+        long long esperada = 0;
+        for (auto it = sumasEsperadas.lower_bound(lo); it != sumasEsperadas.end() && it->first <= hi; ++it)
+            esperada += it->second;
+        if (sumas.sum(lo, hi) != esperada)
+            coincide = false;
+    }
+    long long totalEsperado = 0;
+    for (const auto &kv : sumasEsperadas)
+        totalEsperado += kv.second;
+    printTest("sum(lo, hi) coincide con std::map", coincide);
+    printTest("total() coincide con std::map", sumas.total() == totalEsperado);
+
+    RedBlackTree<int, string, Concatenation> letras;
+    string abecedario = "abcdefghijklmnopqrstuvwxyz";
+    for (int i = 25; i >= 0; i--)
+        letras.insert(i, string(1, abecedario[i]));
+    letras.remove(3);
+    printTest("aggregate() respeta el orden de clave", letras.aggregate() == "abcefghijklmnopqrstuvwxyz");
+    printTest("aggregate(2, 9) = cefghij", letras.aggregate(2, 9) == "cefghij");
+    printTest("aggregate(30, 40) vacío", letras.aggregate(30, 40).empty());
+    printTest("Resúmenes no conmutativos válidos", letras.verifyProperties());
+
+    // ==================== PRUEBA 11: Construcción en bloque, join, merge y split ====================
+    printHeader("PRUEBA 11: buildFromSorted, join, merge y split");
+
+    vector<pair<int, int>> snapshot;
+    for (int i = 0; i < 100000; i++)
+        snapshot.push_back(make_pair(i * 2, i));
+    RedBlackTree<int, int, OrderStatistics> indice;
+    indice.buildFromSorted(snapshot.begin(), snapshot.end());
+    printTest("buildFromSorted: propiedades RBT", indice.verifyProperties() && indice.size() == 100000);
+    printTest("buildFromSorted: select y getValue", indice.select(12345) == 24690 && *indice.getValue(24690) == 12345);
+
+    RedBlackTree<int, int, OrderStatistics> mayores = indice.split(150000);
+    printTest("split(150000): claves < 150000 a la izquierda", indice.size() == 75000 && indice.findMax() == 149998);
+    printTest("split(150000): claves >= 150000 a la derecha", mayores.size() == 25000 && mayores.findMin() == 150000);
+    printTest("split: ambos árboles válidos", indice.verifyProperties() && mayores.verifyProperties());
+
+    indice.join(std::move(mayores));
+    printTest("join vuelve a unir los dos árboles", indice.size() == 100000 && mayores.empty() && indice.verifyProperties());
+
+    RedBlackTree<int, int, OrderStatistics> impares;
+    for (int i = 1; i < 2000; i += 2)
+        impares.insert(i, -i);
+    impares.insert(10, -10);
+    indice.merge(std::move(impares));
+    printTest("merge con rangos superpuestos", indice.size() == 101000 && indice.verifyProperties());
+    printTest("merge: en claves repetidas gana el otro árbol", *indice.getValue(10) == -10 && *indice.getValue(11) == -11);
+
+    vector<pair<int, int>> desordenado = {{1, 1}, {3, 3}, {2, 2}};
+    try
+    {
+        indice.buildFromSorted(desordenado.begin(), desordenado.end());
+        printTest("buildFromSorted desordenado lanza invalid_argument", false);
+    }
+    catch (invalid_argument &e)
+    {
+        printTest("buildFromSorted desordenado lanza invalid_argument", indice.empty());
+    }
+
+    // ==================== PRUEBA 12: get, getOrInsert, upsert y búsqueda heterogénea ====================
+    printHeader("PRUEBA 12: get, getOrInsert, upsert y búsqueda heterogénea");
+
+    RedBlackTree<string, int> conteo;
+    vector<string> texto = {"uno", "dos", "uno", "tres", "uno", "dos"};
+    for (const string &palabra : texto)
+        conteo.upsert(palabra, [](int &c) { c++; });
+    printTest("upsert cuenta palabras", conteo.size() == 3 && *conteo.get("uno") == 3 && *conteo.get("dos") == 2);
+    printTest("upsert devuelve true solo al insertar", conteo.upsert("cuatro", [](int &c) { c = 4; }) &&
+                                                           !conteo.upsert("cuatro", [](int &c) { c++; }) &&
+                                                           *conteo.get("cuatro") == 5);
+
+    int creados = 0;
+    int &tres = conteo.getOrInsert("tres", [&creados]() { creados++; return 0; });
+    tres += 10;
+    int &cinco = conteo.getOrInsert("cinco", [&creados]() { creados++; return 5; });
+    printTest("getOrInsert solo llama a la fábrica si falta la clave", creados == 1 && cinco == 5);
+    printTest("getOrInsert devuelve una referencia al valor", *conteo.get("tres") == 11);
+
+    *conteo.get("dos") = 20;
+    printTest("get permite modificar el valor en el lugar", *conteo.getValue("dos") == 20);
+    printTest("get de una clave ausente devuelve nullptr", conteo.get("seis") == nullptr);
+
+    string_view vista = "uno";
+    const RedBlackTree<string, int> &conteoConst = conteo;
+    printTest("find y get con string_view, sin string temporal", conteo.find(vista) && *conteoConst.get(vista) == 3 &&
+                                                                       !conteo.find(string_view("siete")));
+    printTest("Árbol válido tras las actualizaciones", conteo.verifyProperties() && conteo.size() == 5);
+
+    RedBlackTree<int, int, SumAugmentation<int>> acumulados;
+    for (int i = 0; i < 1000; i++)
+        acumulados.upsert(i % 100, [i](int &v) { v += i; });
+    printTest("upsert recalcula los resúmenes", acumulados.verifyProperties() && acumulados.aggregate(0, 99) == 999 * 1000 / 2);
+
+    // ==================== PRUEBA 13: Centinela sin clave ni valor ====================
+    printHeader("PRUEBA 13: Claves y valores sin constructor por defecto");
+
+    RedBlackTree<SessionId, Payload> sesiones;
+    printTest("Árbol vacío sin construir Key() ni Value()", sesiones.empty() && sesiones.size() == 0 && sesiones.verifyProperties());
+    for (int i = 0; i < 2000; i++)
+        sesiones.insert(SessionId((i * 7919) % 2000), Payload(i));
+    for (int i = 0; i < 2000; i += 3)
+        sesiones.remove(SessionId(i));
+    printTest("insert y remove mantienen las propiedades", sesiones.size() == 1333 && sesiones.verifyProperties());
+    printTest("get devuelve el valor", sesiones.get(SessionId(7919 % 2000))->data == 1);
+
+    RedBlackTree<SessionId, Payload> otras = sesiones.split(SessionId(1000));
+    printTest("split con el centinela fuera del slab", sesiones.verifyProperties() && otras.verifyProperties() &&
+                                                          sesiones.size() + otras.size() == 1333);
+    sesiones.merge(std::move(otras));
+    printTest("merge vuelve a unir los dos árboles", sesiones.size() == 1333 && otras.empty() && sesiones.verifyProperties());
+
+    vector<pair<SessionId, Payload>> pares;
+    for (int i = 0; i < 100; i++)
+        pares.push_back(make_pair(SessionId(i), Payload(-i)));
+    RedBlackTree<SessionId, Payload> construido;
+    construido.buildFromSorted(pares.begin(), pares.end());
+    RedBlackTree<SessionId, Payload> copiaSesiones(construido);
+    construido.clear();
+    printTest("buildFromSorted, copia y clear", copiaSesiones.size() == 100 && copiaSesiones.verifyProperties() &&
+                                                    construido.empty() && construido.verifyProperties());
+
+    vector<RedBlackTree<int, int>> porSesion(100000);
+    for (unsigned int i = 0; i < porSesion.size(); i += 10)
+        porSesion[i].insert(static_cast<int>(i), 1);
+    unsigned int totalPorSesion = 0;
+    for (const RedBlackTree<int, int> &t : porSesion)
+        totalPorSesion += t.size();
+    printTest("100000 árboles chicos (la mayoría vacíos)", totalPorSesion == 10000);
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file BPlusTreeBenchmark.cpp
+ * @brief BPlusTree (256 B, 1 KB y 4 KB por nodo) vs BST y RedBlackTree: insertar, buscar y recorrer rangos
+ *
+ * Compilar con optimizaciones, por ejemplo:
+ *   g++ -O2 -std=c++17 BPlusTreeBenchmark.cpp -o BPlusTreeBenchmark
+ *
+ * Uso: ./BPlusTreeBenchmark [nMax]
+ * Mide n = 1e5, 1e6, ... hasta nMax (por defecto 1e6) con claves en orden
+ * aleatorio (BST no tiene balanceo: con claves ordenadas degeneraría en una lista).
+ * - insert: n inserciones
+ * - find: n búsquedas de claves al azar (la mitad no existe)
+ * - scan: SCANS rangos de SCAN_LENGTH claves consecutivas. BST no tiene
+ *   recorrido por rango, así que avanza con findSuccessor.
+ */
+
+#include "../Templates/B+ Tree/BPlusTree.hh"
+#include "../Templates/Binary Search Tree/MyBST.hh"
+#include "../Templates/Red-Black Tree/RedBlackTree.hh"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+const unsigned int SCANS = 10000;     ///< Rangos recorridos por corrida.
+const unsigned int SCAN_LENGTH = 100; ///< Claves por rango.
+
+double secondsSince(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Recorre un rango con forEachInRange (BPlusTree y RedBlackTree).
+ */
+template <typename Tree>
+long long scanRange(const Tree &tree, int lo, int hi)
+{
+    long long sum = 0;
+    tree.forEachInRange(lo, hi, [&](const int &k, const int &) { sum += k; });
+    return sum;
+}
+
+/**
+ * @brief Recorre un rango con findSuccessor (BST no tiene otra forma).
+ */
+long long scanRange(const BST<int, int> &tree, int lo, int hi)
+{
+    long long sum = 0;
+    if (tree.empty() || tree.findMaximum() < lo)
+        return 0;
+    int k = tree.find(lo) ? lo : tree.findSuccessor(lo);
+    while (k <= hi)
+    {
+        sum += k;
+        if (k == tree.findMaximum())
+            break;
+        k = tree.findSuccessor(k);
+    }
+    return sum;
+}
+
+/**
+ * @brief Mide insert, find y scan sobre un tipo de árbol.
+ */
+template <typename Tree>
+void runTree(const string &name, const vector<int> &keys, const vector<int> &queries, long long &checksum)
+{
+    auto start = chrono::steady_clock::now();
+    Tree tree;
+    for (int k : keys)
+        tree.insert(k, k);
+    double tInsert = secondsSince(start);
+
+    start = chrono::steady_clock::now();
+    long long found = 0;
+    for (int q : queries)
+        found += tree.find(q) ? 1 : 0;
+    double tFind = secondsSince(start);
+
+    start = chrono::steady_clock::now();
+    long long sum = 0;
+    for (unsigned int s = 0; s < SCANS; s++)
+    {
+        int lo = queries[s];
+        sum += scanRange(tree, lo, lo + 2 * static_cast<int>(SCAN_LENGTH));
+    }
+    double tScan = secondsSince(start);
+
+    checksum += found + sum;
+    cout << keys.size() << "\t" << name << "\t" << tInsert << "\t" << tFind << "\t" << tScan << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned long long nMax = 1000000;
+    if (argc > 1)
+        nMax = strtoull(argv[1], nullptr, 10);
+
+    cout << "n\tárbol\t\tinsert(s)\tfind(s)\tscan(s)" << endl;
+
+    long long checksum = 0;
+    mt19937 rng(2025);
+    for (unsigned long long n = 100000; n <= nMax; n *= 10)
+    {
+        // Claves pares en orden aleatorio; las consultas mezclan pares e impares
+        vector<int> keys(n);
+        for (unsigned int i = 0; i < n; i++)
+            keys[i] = static_cast<int>(2 * i);
+        shuffle(keys.begin(), keys.end(), rng);
+        vector<int> queries(n);
+        for (unsigned int i = 0; i < n; i++)
+            queries[i] = static_cast<int>(rng() % (2 * n));
+
+        runTree<BST<int, int>>("BST\t", keys, queries, checksum);
+        runTree<RedBlackTree<int, int>>("RedBlackTree", keys, queries, checksum);
+        runTree<BPlusTree<int, int, 256>>("B+ 256B", keys, queries, checksum);
+        runTree<BPlusTree<int, int, 1024>>("B+ 1KB", keys, queries, checksum);
+        runTree<BPlusTree<int, int, 4096>>("B+ 4KB", keys, queries, checksum);
+    }
+
+    cout << "checksum: " << checksum << endl;
+    return 0;
+}
@@ -0,0 +1,123 @@
+/**
+ * @file BSTBalancingBenchmark.cpp
+ * @brief BST con NoBalancing, Splay, Treap y Scapegoat sobre claves ordenadas, aleatorias y Zipf
+ *
+ * Compilar con optimizaciones, por ejemplo:
+ *   g++ -O2 -std=c++17 BSTBalancingBenchmark.cpp -o BSTBalancingBenchmark
+ *
+ * Uso: ./BSTBalancingBenchmark [n]
+ * Para cada flujo se insertan n claves en el orden del flujo y luego se hacen
+ * n búsquedas con la misma distribución:
+ * - ordenado: 0, 1, 2, ... (claves por tiempo), búsquedas en el mismo orden
+ * - aleatorio: permutación de 0..n-1, búsquedas uniformes
+ * - zipf: claves con distribución de Zipf (s = 1) sobre n claves, con las
+ *   más frecuentes repartidas al azar por el espacio de claves
+ * NoBalancing con el flujo ordenado es O(n^2): solo se mide si n <= 20000.
+ */
+
+#include "../Templates/Binary Search Tree/MyBST.hh"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+const unsigned int UNBALANCED_SORTED_MAX = 20000; ///< Mayor n con el que se mide NoBalancing sobre claves ordenadas.
+
+double secondsSince(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief n claves con distribución de Zipf (s = 1) sobre los rangos 0..n-1
+ * @param rankToKey Clave de cada rango (rango 0 = la más frecuente)
+ */
+vector<int> zipfStream(unsigned int n, const vector<int> &rankToKey, mt19937 &rng)
+{
+    vector<double> cdf(n);
+    double total = 0;
+    for (unsigned int r = 0; r < n; r++)
+    {
+        total += 1.0 / (r + 1);
+        cdf[r] = total;
+    }
+    uniform_real_distribution<double> uniform(0.0, total);
+    vector<int> stream(n);
+    for (unsigned int i = 0; i < n; i++)
+    {
+        unsigned int rank = lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+        stream[i] = rankToKey[min(rank, n - 1)];
+    }
+    return stream;
+}
+
+/**
+ * @brief Inserta el flujo, busca las consultas e imprime una fila.
+ */
+template <typename Balance>
+void runPolicy(const string &stream, const string &name, const vector<int> &inserts, const vector<int> &queries,
+               long long &checksum)
+{
+    auto start = chrono::steady_clock::now();
+    BST<int, int, Balance> tree;
+    for (int k : inserts)
+        tree.insert(k, k);
+    double tInsert = secondsSince(start);
+
+    start = chrono::steady_clock::now();
+    long long found = 0;
+    for (int q : queries)
+        found += tree.find(q) ? 1 : 0;
+    double tFind = secondsSince(start);
+
+    checksum += found + tree.size();
+    cout << stream << "\t" << name << "\t" << tInsert << "\t" << tFind << "\t" << tree.height() << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned int n = 200000;
+    if (argc > 1)
+        n = static_cast<unsigned int>(strtoul(argv[1], nullptr, 10));
+
+    mt19937 rng(2025);
+    vector<int> sorted(n);
+    for (unsigned int i = 0; i < n; i++)
+        sorted[i] = static_cast<int>(i);
+    vector<int> shuffled = sorted;
+    shuffle(shuffled.begin(), shuffled.end(), rng);
+    vector<int> uniformQueries(n);
+    for (unsigned int i = 0; i < n; i++)
+        uniformQueries[i] = static_cast<int>(rng() % n);
+    vector<int> zipfInserts = zipfStream(n, shuffled, rng);
+    vector<int> zipfQueries = zipfStream(n, shuffled, rng);
+
+    cout << "flujo\tpolítica\tinsert(s)\tfind(s)\taltura" << endl;
+
+    long long checksum = 0;
+    if (n <= UNBALANCED_SORTED_MAX)
+        runPolicy<NoBalancing>("ordenado", "NoBalancing", sorted, sorted, checksum);
+    else
+        cout << "ordenado\tNoBalancing\t-\t-\t-" << endl;
+    runPolicy<Splay>("ordenado", "Splay\t", sorted, sorted, checksum);
+    runPolicy<Treap>("ordenado", "Treap\t", sorted, sorted, checksum);
+    runPolicy<Scapegoat>("ordenado", "Scapegoat", sorted, sorted, checksum);
+
+    runPolicy<NoBalancing>("aleatorio", "NoBalancing", shuffled, uniformQueries, checksum);
+    runPolicy<Splay>("aleatorio", "Splay\t", shuffled, uniformQueries, checksum);
+    runPolicy<Treap>("aleatorio", "Treap\t", shuffled, uniformQueries, checksum);
+    runPolicy<Scapegoat>("aleatorio", "Scapegoat", shuffled, uniformQueries, checksum);
+
+    runPolicy<NoBalancing>("zipf\t", "NoBalancing", zipfInserts, zipfQueries, checksum);
+    runPolicy<Splay>("zipf\t", "Splay\t", zipfInserts, zipfQueries, checksum);
+    runPolicy<Treap>("zipf\t", "Treap\t", zipfInserts, zipfQueries, checksum);
+    runPolicy<Scapegoat>("zipf\t", "Scapegoat", zipfInserts, zipfQueries, checksum);
+
+    cout << "checksum: " << checksum << endl;
+    return 0;
+}
@@ -0,0 +1,115 @@
+/**
+ * @file HeapBuildBenchmark.cpp
+ * @brief Construcción de HeapTree: inserts uno a uno vs Floyd (rango / insertBatch) vs std::make_heap
+ *
+ * Compilar con optimizaciones, por ejemplo:
+ *   g++ -O2 -std=c++17 HeapBuildBenchmark.cpp -o HeapBuildBenchmark
+ *
+ * Uso: ./HeapBuildBenchmark [nMax]
+ * Mide n = 1e6, 1e7, ... hasta nMax (por defecto 1e7). Con nMax = 100000000
+ * llega a 1e8, que necesita unos 2 GB de memoria para pair<int, int>.
+ */
+
+#include "../Templates/HeapTree/HeapTree.hh"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+typedef pair<int, int> Item;
+
+double secondsSince(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Compara los pares solo por prioridad, igual que HeapTree.
+ */
+bool lessPriority(const Item &a, const Item &b)
+{
+    return a.first < b.first;
+}
+
+/**
+ * @brief Mide las distintas formas de construir un heap de n elementos.
+ */
+template <unsigned int Arity>
+void runScenario(const vector<Item> &items, long long &checksum)
+{
+    unsigned int n = items.size();
+    unsigned int half = n / 2;
+
+    auto start = chrono::steady_clock::now();
+    HeapTree<int, int, DaryHeap<Arity>> repeated;
+    for (const Item &it : items)
+        repeated.insert(it.first, it.second);
+    double tInsert = secondsSince(start);
+    checksum += repeated.max().first;
+
+    start = chrono::steady_clock::now();
+    HeapTree<int, int, DaryHeap<Arity>> floyd(items.begin(), items.end());
+    double tRange = secondsSince(start);
+    checksum += floyd.max().first;
+
+    // Mitad construida y la otra mitad agregada de un solo lote
+    HeapTree<int, int, DaryHeap<Arity>> batched(items.begin(), items.begin() + half);
+    start = chrono::steady_clock::now();
+    batched.insertBatch(items.begin() + half, items.end());
+    double tBatch = secondsSince(start);
+    checksum += batched.max().first;
+
+    // Unir dos heaps de n/2
+    HeapTree<int, int, DaryHeap<Arity>> left(items.begin(), items.begin() + half);
+    HeapTree<int, int, DaryHeap<Arity>> right(items.begin() + half, items.end());
+    start = chrono::steady_clock::now();
+    left.merge(std::move(right));
+    double tMerge = secondsSince(start);
+    checksum += left.max().first;
+
+    start = chrono::steady_clock::now();
+    auto top = floyd.extractTopK(1000);
+    double tTopK = secondsSince(start);
+    checksum += top.back().first;
+
+    cout << Arity << "-ario\t" << n << "\t" << tInsert << "\t\t" << tRange << "\t\t"
+         << tBatch << "\t\t" << tMerge << "\t\t" << tTopK << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned long long nMax = 10000000;
+    if (argc > 1)
+        nMax = strtoull(argv[1], nullptr, 10);
+
+    cout << "heap\tn\tinserts(s)\trango(s)\tinsertBatch(s)\tmerge(s)\ttop1000(s)" << endl;
+
+    long long checksum = 0;
+    mt19937 rng(42);
+    for (unsigned long long n = 1000000; n <= nMax; n *= 10)
+    {
+        vector<Item> items(n);
+        for (unsigned int i = 0; i < n; i++)
+            items[i] = Item(static_cast<int>(rng()), static_cast<int>(i));
+
+        runScenario<2>(items, checksum);
+        runScenario<4>(items, checksum);
+        runScenario<8>(items, checksum);
+
+        vector<Item> copy(items);
+        auto start = chrono::steady_clock::now();
+        make_heap(copy.begin(), copy.end(), lessPriority);
+        double tMakeHeap = secondsSince(start);
+        checksum += copy.front().first;
+        cout << "std::make_heap\t" << n << "\t-\t\t" << tMakeHeap << endl;
+        cout << endl;
+    }
+
+    cout << "checksum: " << checksum << endl;
+    return 0;
+}
@@ -0,0 +1,226 @@
+/**
+ * @file HeapTraceBenchmark.cpp
+ * @brief Reproduce trazas de operaciones contra cada motor de HeapTree
+ *
+ * Compilar con optimizaciones, por ejemplo:
+ *   g++ -O2 -std=c++17 HeapTraceBenchmark.cpp -o HeapTraceBenchmark
+ *
+ * Uso: ./HeapTraceBenchmark [traza1.txt traza2.txt ...]
+ * Sin argumentos genera tres trazas sintéticas: aleatoria, monótona
+ * (estilo Dijkstra) y con muchos merge.
+ *
+ * Formato de una traza (una operación por línea):
+ *   i <prioridad>               insert
+ *   x                           extractMax
+ *   m <k> <p1> <p2> ... <pk>    merge con un heap de k elementos
+ *
+ * RadixHeap solo acepta trazas monótonas (nunca se inserta una prioridad
+ * mayor que el último máximo); si no lo es se reporta "no monótona".
+ */
+
+#include "../Templates/HeapTree/HeapTree.hh"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Una operación de la traza.
+ */
+struct Op
+{
+    char kind;                   ///< 'i' insert, 'x' extractMax, 'm' merge.
+    long long priority;          ///< Prioridad del insert.
+    vector<long long> batch;     ///< Prioridades del heap a unir (solo 'm').
+};
+
+/**
+ * @brief Lee una traza de un archivo.
+ * @throws std::runtime_error si el archivo no existe o tiene una línea inválida.
+ */
+vector<Op> readTrace(const string &path)
+{
+    ifstream in(path);
+    if (!in)
+        throw runtime_error("No se pudo abrir " + path);
+
+    vector<Op> trace;
+    char kind;
+    while (in >> kind)
+    {
+        Op op{kind, 0, {}};
+        if (kind == 'i')
+        {
+            in >> op.priority;
+        }
+        else if (kind == 'm')
+        {
+            unsigned int k;
+            in >> k;
+            op.batch.resize(k);
+            for (unsigned int j = 0; j < k; j++)
+                in >> op.batch[j];
+        }
+        else if (kind != 'x')
+        {
+            throw runtime_error("Operación inválida en " + path + ": " + kind);
+        }
+        trace.push_back(op);
+    }
+    return trace;
+}
+
+/**
+ * @brief Traza con prioridades aleatorias: mitad inserts, mitad extracciones.
+ */
+vector<Op> randomTrace(unsigned int n, mt19937 &rng)
+{
+    vector<Op> trace;
+    for (unsigned int i = 0; i < n; i++)
+        trace.push_back(Op{'i', static_cast<long long>(rng() % 1000000000), {}});
+    for (unsigned int i = 0; i < n; i++)
+    {
+        trace.push_back(Op{'i', static_cast<long long>(rng() % 1000000000), {}});
+        trace.push_back(Op{'x', 0, {}});
+    }
+    return trace;
+}
+
+/**
+ * @brief Traza monótona: cada insert es el último máximo extraído menos una distancia (como en Dijkstra).
+ */
+vector<Op> monotoneTrace(unsigned int n, mt19937 &rng)
+{
+    vector<Op> trace;
+    priority_queue<long long> simulated; // Para saber cuál es el máximo que se extrae
+    long long current = 1000000000000LL;
+    for (unsigned int i = 0; i < n; i++)
+    {
+        // Expandir un nodo: extraer el máximo y agregar de 0 a 2 vecinos
+        if (!simulated.empty())
+        {
+            current = simulated.top();
+            simulated.pop();
+            trace.push_back(Op{'x', 0, {}});
+        }
+        unsigned int neighbours = simulated.empty() ? 1 + rng() % 2 : rng() % 3;
+        for (unsigned int j = 0; j < neighbours; j++)
+        {
+            long long p = current - static_cast<long long>(rng() % 1000);
+            simulated.push(p);
+            trace.push_back(Op{'i', p, {}});
+        }
+    }
+    return trace;
+}
+
+/**
+ * @brief Traza con muchos merge de heaps chicos.
+ */
+vector<Op> meldTrace(unsigned int n, mt19937 &rng)
+{
+    vector<Op> trace;
+    for (unsigned int i = 0; i < n / 16; i++)
+    {
+        Op op{'m', 0, vector<long long>(16)};
+        for (long long &p : op.batch)
+            p = rng() % 1000000000;
+        trace.push_back(op);
+        if (i % 2 == 1)
+            trace.push_back(Op{'x', 0, {}});
+    }
+    return trace;
+}
+
+/**
+ * @brief Reproduce la traza con un motor.
+ * @return Segundos, o -1 si el motor rechazó la traza.
+ */
+template <typename Engine>
+double replay(const vector<Op> &trace, long long &checksum)
+{
+    HeapTree<long long, unsigned int, Engine> heap;
+    unsigned int seq = 0;
+    auto start = chrono::steady_clock::now();
+    try
+    {
+        for (const Op &op : trace)
+        {
+            if (op.kind == 'i')
+            {
+                heap.insert(op.priority, seq++);
+            }
+            else if (op.kind == 'x')
+            {
+                if (!heap.isEmpty())
+                    checksum += heap.extractMax().first;
+            }
+            else
+            {
+                HeapTree<long long, unsigned int, Engine> other;
+                for (long long p : op.batch)
+                    other.insert(p, seq++);
+                heap.merge(std::move(other));
+            }
+        }
+    }
+    catch (const invalid_argument &)
+    {
+        return -1;
+    }
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Reproduce la traza con todos los motores e imprime una fila.
+ */
+void runTrace(const string &name, const vector<Op> &trace, long long &checksum)
+{
+    double times[] = {
+        replay<DaryHeap<2>>(trace, checksum),
+        replay<DaryHeap<4>>(trace, checksum),
+        replay<DaryHeap<8>>(trace, checksum),
+        replay<PairingHeap>(trace, checksum),
+        replay<RadixHeap>(trace, checksum),
+        replay<SoaDaryHeap<4>>(trace, checksum),
+    };
+
+    cout << name << "\t" << trace.size();
+    for (double t : times)
+    {
+        if (t < 0)
+            cout << "\tno monótona";
+        else
+            cout << "\t" << t;
+    }
+    cout << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    cout << "traza\t\tops\tbinario(s)\t4-ario(s)\t8-ario(s)\tpairing(s)\tradix(s)\tsoa 4-ario(s)" << endl;
+
+    long long checksum = 0;
+    if (argc > 1)
+    {
+        for (int i = 1; i < argc; i++)
+            runTrace(argv[i], readTrace(argv[i]), checksum);
+    }
+    else
+    {
+        const unsigned int N = 1000000;
+        mt19937 rng(42);
+        runTrace("aleatoria", randomTrace(N, rng), checksum);
+        runTrace("monótona", monotoneTrace(N, rng), checksum);
+        runTrace("merge", meldTrace(N, rng), checksum);
+    }
+
+    cout << "checksum: " << checksum << endl;
+    return 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file ListPoolBenchmark.cpp
+ * @brief Compara List<T> con nodos en el heap contra List<T> con PoolAllocator
+ *
+ * Compilar con optimizaciones, por ejemplo:
+ *   g++ -O2 -std=c++17 ListPoolBenchmark.cpp -o ListPoolBenchmark
+ */
+
+#include "../include/list.hh"
+#include "../include/NodePool.hh"
+#include <chrono>
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+const unsigned int CYCLES = 10000000; ///< Pares push/pop por escenario.
+const unsigned int BATCH = 1000;      ///< Elementos vivos por ronda.
+
+/**
+ * @brief Llena y vacía la lista en rondas de BATCH hasta completar CYCLES.
+ * @return Segundos transcurridos.
+ */
+template <typename ListType>
+double runCycles(ListType &list, long long &checksum)
+{
+    auto start = chrono::steady_clock::now();
+    for (unsigned int done = 0; done < CYCLES; done += BATCH)
+    {
+        for (unsigned int i = 0; i < BATCH; i++)
+        {
+            list.push_back(static_cast<int>(i));
+        }
+        for (unsigned int i = 0; i < BATCH; i++)
+        {
+            checksum += list.front();
+            list.pop_front();
+        }
+    }
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double>(end - start).count();
+}
+
+/**
+ * @brief Llena la lista y la vacía con clear() en cada ronda.
+ * @return Segundos transcurridos.
+ */
+template <typename ListType>
+double runClear(ListType &list)
+{
+    auto start = chrono::steady_clock::now();
+    for (unsigned int done = 0; done < CYCLES; done += BATCH)
+    {
+        for (unsigned int i = 0; i < BATCH; i++)
+        {
+            list.push_back(static_cast<int>(i));
+        }
+        list.clear();
+    }
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double>(end - start).count();
+}
+
+void report(const string &name, double seconds)
+{
+    cout << name << ": " << seconds << " s ("
+         << (CYCLES / seconds) / 1e6 << " M ciclos/s)" << endl;
+}
+
+int main()
+{
+    cout << "=== List<int>: heap vs pool (" << CYCLES << " ciclos push/pop) ===" << endl;
+
+    long long checksum = 0;
+
+    List<int> heapList;
+    report("heap push_back/pop_front", runCycles(heapList, checksum));
+
+    List<int, PoolAllocator<int>> poolList;
+    report("pool push_back/pop_front", runCycles(poolList, checksum));
+
+    List<int> heapClear;
+    report("heap push_back/clear", runClear(heapClear));
+
+    List<int, PoolAllocator<int>> poolClear;
+    report("pool push_back/clear", runClear(poolClear));
+
+    cout << "checksum: " << checksum << endl;
+    return 0;
+}
@@ -0,0 +1,124 @@
+/**
+ * @file LockFreeQueueBenchmark.cpp
+ * @brief LockFreeQueueList vs QueueList protegida con un mutex, de 1 a N hilos
+ *
+ * Compilar con optimizaciones, por ejemplo:
+ *   g++ -O2 -std=c++17 -pthread LockFreeQueueBenchmark.cpp -o LockFreeQueueBenchmark
+ *
+ * Para cada k = 1..N se lanzan k productores y k consumidores que mueven en
+ * total MESSAGES enteros. N es std::thread::hardware_concurrency() (al menos 4).
+ */
+
+#include "../Templates/Queues/ListQueue/QueueList.hh"
+#include "../Templates/Queues/ListQueue/LockFreeQueueList.hh"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+const unsigned long long MESSAGES = 2000000; ///< Mensajes por corrida (repartidos entre productores).
+
+/**
+ * @brief QueueList con un único mutex, como se usa hoy en el despachador de trabajos.
+ */
+class LockedQueueList
+{
+private:
+    QueueList<unsigned long long> queue;
+    mutex mtx;
+
+public:
+    void enqueue(unsigned long long val)
+    {
+        lock_guard<mutex> lock(mtx);
+        queue.enqueue(val);
+    }
+
+    bool try_dequeue(unsigned long long &out)
+    {
+        lock_guard<mutex> lock(mtx);
+        if (queue.isEmpty())
+            return false;
+        out = queue.front();
+        queue.dequeue();
+        return true;
+    }
+};
+
+/**
+ * @brief Corre k productores y k consumidores sobre la cola.
+ * @return Millones de mensajes por segundo.
+ */
+template <typename QueueType>
+double throughput(unsigned int k, unsigned long long &checksum)
+{
+    QueueType queue;
+    atomic<unsigned long long> consumed(0);
+    atomic<unsigned long long> sum(0);
+    unsigned long long perProducer = MESSAGES / k;
+    unsigned long long total = perProducer * k;
+
+    auto start = chrono::steady_clock::now();
+    vector<thread> threads;
+    for (unsigned int p = 0; p < k; p++)
+    {
+        threads.emplace_back([&]() {
+            for (unsigned long long i = 0; i < perProducer; i++)
+            {
+                queue.enqueue(i);
+            }
+        });
+    }
+    for (unsigned int c = 0; c < k; c++)
+    {
+        threads.emplace_back([&]() {
+            unsigned long long localSum = 0;
+            unsigned long long value;
+            while (consumed.load(memory_order_relaxed) < total)
+            {
+                if (queue.try_dequeue(value))
+                {
+                    localSum += value;
+                    consumed.fetch_add(1, memory_order_relaxed);
+                }
+                else
+                {
+                    this_thread::yield();
+                }
+            }
+            sum += localSum;
+        });
+    }
+    for (thread &t : threads)
+    {
+        t.join();
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    checksum += sum.load();
+    return total / seconds / 1e6;
+}
+
+int main()
+{
+    unsigned int maxThreads = thread::hardware_concurrency();
+    if (maxThreads < 4)
+        maxThreads = 4;
+
+    cout << "hilos(prod+cons)\tmutex(Mmsg/s)\tlock-free(Mmsg/s)" << endl;
+
+    unsigned long long checksum = 0;
+    for (unsigned int k = 1; k <= maxThreads; k++)
+    {
+        double locked = throughput<LockedQueueList>(k, checksum);
+        double lockFree = throughput<LockFreeQueueList<unsigned long long>>(k, checksum);
+        cout << k << "+" << k << "\t\t\t" << locked << "\t\t" << lockFree << endl;
+    }
+
+    cout << "checksum: " << checksum << endl;
+    return 0;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file MpmcQueueBenchmark.cpp
+ * @brief MpmcCircularQueue vs CircularQueue protegida con un mutex, de 1 a N hilos
+ *
+ * Compilar con optimizaciones, por ejemplo:
+ *   g++ -O2 -std=c++17 -pthread MpmcQueueBenchmark.cpp -o MpmcQueueBenchmark
+ *
+ * Para cada k = 1..N se lanzan k productores y k consumidores que mueven en
+ * total MESSAGES enteros. N es std::thread::hardware_concurrency() (al menos 4).
+ */
+
+#include "../Templates/Queues/CircularQueue/CircularQueue.hh"
+#include "../Templates/Queues/CircularQueue/MpmcCircularQueue.hh"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+const unsigned long long MESSAGES = 2000000; ///< Mensajes por corrida (repartidos entre productores).
+const unsigned int CAPACITY = 1024;          ///< Capacidad de las colas.
+
+/**
+ * @brief CircularQueue con un único mutex: la forma actual de compartirla entre hilos.
+ */
+class LockedCircularQueue
+{
+private:
+    CircularQueue<unsigned long long> queue;
+    mutex mtx;
+
+public:
+    LockedCircularQueue() : queue(CAPACITY) {}
+
+    bool try_enqueue(unsigned long long val)
+    {
+        lock_guard<mutex> lock(mtx);
+        if (queue.isFull())
+            return false;
+        queue.enqueue(val);
+        return true;
+    }
+
+    bool try_dequeue(unsigned long long &out)
+    {
+        lock_guard<mutex> lock(mtx);
+        if (queue.isEmpty())
+            return false;
+        out = queue.front();
+        queue.dequeue();
+        return true;
+    }
+};
+
+/**
+ * @brief Corre k productores y k consumidores sobre la cola.
+ * @return Millones de mensajes por segundo.
+ */
+template <typename QueueType>
+double throughput(unsigned int k, unsigned long long &checksum)
+{
+    QueueType queue;
+    atomic<unsigned long long> consumed(0);
+    atomic<unsigned long long> sum(0);
+    unsigned long long perProducer = MESSAGES / k;
+    unsigned long long total = perProducer * k;
+
+    auto start = chrono::steady_clock::now();
+    vector<thread> threads;
+    for (unsigned int p = 0; p < k; p++)
+    {
+        threads.emplace_back([&]() {
+            for (unsigned long long i = 0; i < perProducer; i++)
+            {
+                while (!queue.try_enqueue(i))
+                    this_thread::yield();
+            }
+        });
+    }
+    for (unsigned int c = 0; c < k; c++)
+    {
+        threads.emplace_back([&]() {
+            unsigned long long localSum = 0;
+            unsigned long long value;
+            while (consumed.load(memory_order_relaxed) < total)
+            {
+                if (queue.try_dequeue(value))
+                {
+                    localSum += value;
+                    consumed.fetch_add(1, memory_order_relaxed);
+                }
+                else
+                {
+                    this_thread::yield();
+                }
+            }
+            sum += localSum;
+        });
+    }
+    for (thread &t : threads)
+    {
+        t.join();
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    checksum += sum.load();
+    return total / seconds / 1e6;
+}
+
+/**
+ * @brief Adaptador para construir MpmcCircularQueue sin argumentos, como LockedCircularQueue.
+ */
+class Mpmc : public MpmcCircularQueue<unsigned long long>
+{
+public:
+    Mpmc() : MpmcCircularQueue<unsigned long long>(CAPACITY) {}
+};
+
+int main()
+{
+    unsigned int maxThreads = thread::hardware_concurrency();
+    if (maxThreads < 4)
+        maxThreads = 4;
+
+    cout << "hilos(prod+cons)\tmutex(Mmsg/s)\tmpmc(Mmsg/s)" << endl;
+
+    unsigned long long checksum = 0;
+    for (unsigned int k = 1; k <= maxThreads; k++)
+    {
+        double locked = throughput<LockedCircularQueue>(k, checksum);
+        double mpmc = throughput<Mpmc>(k, checksum);
+        cout << k << "+" << k << "\t\t\t" << locked << "\t\t" << mpmc << endl;
+    }
+
+    cout << "checksum: " << checksum << endl;
+    return 0;
+}
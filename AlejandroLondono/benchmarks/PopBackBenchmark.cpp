@@ -0,0 +1,56 @@
+/**
+ * @file PopBackBenchmark.cpp
+ * @brief Vaciar una lista por el final: List<T> (O(n) por pop_back) vs XorList<T> (O(1))
+ *
+ * Compilar con optimizaciones, por ejemplo:
+ *   g++ -O2 -std=c++17 PopBackBenchmark.cpp -o PopBackBenchmark
+ */
+
+#include "../include/list.hh"
+#include "../include/XorList.hh"
+#include <chrono>
+#include <iostream>
+
+using namespace std;
+
+/**
+ * @brief Llena la lista con n elementos y la vacía usándola como pila.
+ * @return Segundos que tomó vaciarla.
+ */
+template <typename ListType>
+double drainFromBack(unsigned int n, long long &checksum)
+{
+    ListType list;
+    for (unsigned int i = 0; i < n; i++)
+    {
+        list.push_back(static_cast<int>(i));
+    }
+
+    auto start = chrono::steady_clock::now();
+    while (!list.empty())
+    {
+        checksum += list.back();
+        list.pop_back();
+    }
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double>(end - start).count();
+}
+
+int main()
+{
+    cout << "=== pop_back hasta vaciar: List vs XorList ===" << endl;
+    cout << "n\tList (s)\tXorList (s)" << endl;
+
+    long long checksum = 0;
+    unsigned int sizes[] = {2000, 4000, 8000, 16000, 32000};
+    for (unsigned int n : sizes)
+    {
+        double singly = drainFromBack<List<int>>(n, checksum);
+        double xorList = drainFromBack<XorList<int>>(n, checksum);
+        cout << n << "\t" << singly << "\t" << xorList << endl;
+    }
+
+    // Al duplicar n el tiempo de List crece ~x4 (cuadrático) y el de XorList ~x2 (lineal)
+    cout << "checksum: " << checksum << endl;
+    return 0;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file RedBlackBuildBenchmark.cpp
+ * @brief Construcción de RedBlackTree desde datos ordenados: inserts vs buildFromSorted, y join/merge/split vs reinsertar
+ *
+ * Compilar con optimizaciones, por ejemplo:
+ *   g++ -O2 -std=c++17 RedBlackBuildBenchmark.cpp -o RedBlackBuildBenchmark
+ *
+ * Uso: ./RedBlackBuildBenchmark [nMax]
+ * Mide n = 1e6, 1e7, ... hasta nMax (por defecto 1e7). Con nMax = 20000000
+ * reproduce el índice de 20M claves del arranque.
+ */
+
+#include "../Templates/Red-Black Tree/RedBlackTree.hh"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+double secondsSince(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Mide las formas de construir y combinar un índice de n claves ordenadas.
+ */
+void runScenario(const vector<pair<int, int>> &snapshot, long long &checksum)
+{
+    unsigned int n = snapshot.size();
+    unsigned int half = n / 2;
+
+    auto start = chrono::steady_clock::now();
+    RedBlackTree<int, int> inserted;
+    for (const auto &kv : snapshot)
+        inserted.insert(kv.first, kv.second);
+    double tInsert = secondsSince(start);
+    checksum += inserted.findMax();
+
+    start = chrono::steady_clock::now();
+    RedBlackTree<int, int> built;
+    built.buildFromSorted(snapshot.begin(), snapshot.end());
+    double tBuild = secondsSince(start);
+    checksum += built.findMax();
+
+    start = chrono::steady_clock::now();
+    map<int, int> reference;
+    for (const auto &kv : snapshot)
+        reference.emplace_hint(reference.end(), kv.first, kv.second);
+    double tMap = secondsSince(start);
+    checksum += reference.rbegin()->first;
+
+    // Unir dos mitades: reinsertar la segunda mitad vs join
+    RedBlackTree<int, int> left, right;
+    left.buildFromSorted(snapshot.begin(), snapshot.begin() + half);
+    right.buildFromSorted(snapshot.begin() + half, snapshot.end());
+    RedBlackTree<int, int> reinserted(left);
+    start = chrono::steady_clock::now();
+    for (auto it = snapshot.begin() + half; it != snapshot.end(); ++it)
+        reinserted.insert(it->first, it->second);
+    double tReinsert = secondsSince(start);
+    checksum += reinserted.size();
+
+    start = chrono::steady_clock::now();
+    left.join(std::move(right));
+    double tJoin = secondsSince(start);
+    checksum += left.size();
+
+    // Dividir el 10% más alto
+    start = chrono::steady_clock::now();
+    RedBlackTree<int, int> top = left.split(snapshot[n - n / 10].first);
+    double tSplit = secondsSince(start);
+    checksum += top.size();
+
+    // Unión con claves intercaladas (rangos superpuestos)
+    RedBlackTree<int, int> odds;
+    vector<pair<int, int>> oddKeys;
+    for (unsigned int i = 0; i < n / 10; i++)
+        oddKeys.push_back(make_pair(snapshot[i * 10].first + 1, static_cast<int>(i)));
+    odds.buildFromSorted(oddKeys.begin(), oddKeys.end());
+    start = chrono::steady_clock::now();
+    built.merge(std::move(odds));
+    double tMerge = secondsSince(start);
+    checksum += built.size();
+
+    cout << n << "\t" << tInsert << "\t" << tBuild << "\t" << tMap << "\t"
+         << tReinsert << "\t" << tJoin << "\t" << tSplit << "\t" << tMerge << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned long long nMax = 10000000;
+    if (argc > 1)
+        nMax = strtoull(argv[1], nullptr, 10);
+
+    cout << "n\tinserts(s)\tbuildFromSorted(s)\tstd::map hint(s)\treinsertar n/2(s)\tjoin n/2(s)\tsplit 10%(s)\tmerge n/10(s)" << endl;
+
+    long long checksum = 0;
+    for (unsigned long long n = 1000000; n <= nMax; n *= 10)
+    {
+        vector<pair<int, int>> snapshot(n);
+        for (unsigned int i = 0; i < n; i++)
+            snapshot[i] = make_pair(static_cast<int>(i) * 2, static_cast<int>(i));
+        runScenario(snapshot, checksum);
+    }
+
+    cout << "checksum: " << checksum << endl;
+    return 0;
+}
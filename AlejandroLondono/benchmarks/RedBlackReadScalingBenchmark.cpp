@@ -0,0 +1,132 @@
+/**
+ * @file RedBlackReadScalingBenchmark.cpp
+ * @brief ConcurrentRedBlackTree vs RedBlackTree con un shared_mutex, de 1 a 32 hilos con 1% de escrituras
+ *
+ * Compilar con optimizaciones, por ejemplo:
+ *   g++ -O2 -std=c++17 -pthread RedBlackReadScalingBenchmark.cpp -o RedBlackReadScalingBenchmark
+ *
+ * Uso: ./RedBlackReadScalingBenchmark [claves]
+ * El índice empieza con las claves pares de [0, 2 * claves) (por defecto 1e6
+ * claves). Cada hilo hace OPS_PER_THREAD operaciones: 99% búsquedas de una
+ * clave al azar y 1% escrituras (insertar o eliminar una clave impar).
+ * Con más hilos que núcleos, el resultado mide contención y no escalamiento.
+ */
+
+#include "../Templates/Red-Black Tree/RedBlackTree.hh"
+#include "../Templates/Red-Black Tree/ConcurrentRedBlackTree.hh"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+const unsigned long long OPS_PER_THREAD = 500000; ///< Operaciones por hilo en cada corrida.
+const unsigned int WRITE_PERCENT = 1;             ///< Porcentaje de escrituras.
+
+/**
+ * @brief RedBlackTree protegido con un lock de lectores/escritores.
+ */
+class LockedRedBlackTree
+{
+private:
+    RedBlackTree<int, int> tree;
+    mutable shared_mutex mtx;
+
+public:
+    void insert(int k, int v)
+    {
+        unique_lock<shared_mutex> lock(mtx);
+        tree.insert(k, v);
+    }
+
+    bool remove(int k)
+    {
+        unique_lock<shared_mutex> lock(mtx);
+        return tree.remove(k);
+    }
+
+    bool get(int k, int &out) const
+    {
+        shared_lock<shared_mutex> lock(mtx);
+        const int *v = tree.getValue(k);
+        if (v == nullptr)
+            return false;
+        out = *v;
+        return true;
+    }
+};
+
+/**
+ * @brief Corre k hilos con 1% de escrituras sobre un índice de n claves pares.
+ * @return Millones de operaciones por segundo (todas las de todos los hilos).
+ */
+template <typename TreeType>
+double throughput(unsigned int n, unsigned int k, unsigned long long &checksum)
+{
+    TreeType tree;
+    for (unsigned int i = 0; i < n; i++)
+        tree.insert(static_cast<int>(2 * i), static_cast<int>(i));
+
+    atomic<unsigned long long> sum(0);
+    auto start = chrono::steady_clock::now();
+    vector<thread> threads;
+    for (unsigned int t = 0; t < k; t++)
+    {
+        threads.emplace_back([&, t]() {
+            mt19937 rng(t + 1);
+            unsigned long long localSum = 0;
+            for (unsigned long long i = 0; i < OPS_PER_THREAD; i++)
+            {
+                unsigned int r = rng();
+                int key = static_cast<int>(r % (2 * n));
+                if (r / (2 * n) % 100 < WRITE_PERCENT)
+                {
+                    key |= 1;
+                    if (i % 2 == 0)
+                        tree.insert(key, -key);
+                    else
+                        tree.remove(key);
+                }
+                else
+                {
+                    int v;
+                    if (tree.get(key, v))
+                        localSum += v;
+                }
+            }
+            sum += localSum;
+        });
+    }
+    for (thread &th : threads)
+        th.join();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    checksum += sum.load();
+    return OPS_PER_THREAD * k / seconds / 1e6;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned int n = 1000000;
+    if (argc > 1)
+        n = static_cast<unsigned int>(strtoul(argv[1], nullptr, 10));
+
+    cout << "núcleos: " << thread::hardware_concurrency() << ", claves: " << n << endl;
+    cout << "hilos\tshared_mutex(Mops/s)\tRCU(Mops/s)" << endl;
+
+    unsigned long long checksum = 0;
+    for (unsigned int k = 1; k <= 32; k *= 2)
+    {
+        double locked = throughput<LockedRedBlackTree>(n, k, checksum);
+        double rcu = throughput<ConcurrentRedBlackTree<int, int>>(n, k, checksum);
+        cout << k << "\t" << locked << "\t\t\t" << rcu << endl;
+    }
+
+    cout << "checksum: " << checksum << endl;
+    return 0;
+}
@@ -0,0 +1,60 @@
+/**
+ * @file RedBlackSmallTreesBenchmark.cpp
+ * @brief Millones de RedBlackTree chicos (uno por sesión): crear, llenar con k claves y destruir
+ *
+ * Compilar con optimizaciones, por ejemplo:
+ *   g++ -O2 -std=c++17 RedBlackSmallTreesBenchmark.cpp -o RedBlackSmallTreesBenchmark
+ *
+ * Uso: ./RedBlackSmallTreesBenchmark [árboles]
+ * Para k = 0, 1, 4 y 16 claves por árbol crea los árboles (por defecto 1e6)
+ * en un vector, inserta k claves en cada uno, busca una y los destruye.
+ * Con k = 0 solo se mide el costo de un árbol vacío.
+ */
+
+#include "../Templates/Red-Black Tree/RedBlackTree.hh"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+    unsigned int trees = 1000000;
+    if (argc > 1)
+        trees = static_cast<unsigned int>(strtoul(argv[1], nullptr, 10));
+
+    cout << "árboles: " << trees << ", sizeof(RedBlackTree<int, int>): " << sizeof(RedBlackTree<int, int>) << endl;
+    cout << "claves/árbol\tcrear+llenar(s)\tbuscar(s)\tdestruir(s)" << endl;
+
+    long long checksum = 0;
+    const int sizes[] = {0, 1, 4, 16};
+    for (int k : sizes)
+    {
+        auto start = chrono::steady_clock::now();
+        vector<RedBlackTree<int, int>> sessions(trees);
+        for (unsigned int t = 0; t < trees; t++)
+            for (int i = 0; i < k; i++)
+                sessions[t].insert(static_cast<int>((t + i * 7) % 64), i);
+        double tBuild = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        start = chrono::steady_clock::now();
+        for (unsigned int t = 0; t < trees; t++)
+        {
+            const int *v = sessions[t].get(static_cast<int>(t % 64));
+            checksum += (v == nullptr) ? 0 : *v + 1;
+        }
+        double tFind = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        start = chrono::steady_clock::now();
+        sessions.clear();
+        sessions.shrink_to_fit();
+        double tDestroy = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        cout << k << "\t\t" << tBuild << "\t\t" << tFind << "\t" << tDestroy << endl;
+    }
+
+    cout << "checksum: " << checksum << endl;
+    return 0;
+}
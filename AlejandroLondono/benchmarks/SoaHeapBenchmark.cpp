@@ -0,0 +1,75 @@
+/**
+ * @file SoaHeapBenchmark.cpp
+ * @brief HeapTree (pair<Priority, Value>) vs SoaHeapTree (prioridades y valores separados)
+ *
+ * Compilar con optimizaciones, por ejemplo:
+ *   g++ -O2 -std=c++17 SoaHeapBenchmark.cpp -o SoaHeapBenchmark
+ *
+ * Cada valor es un string de PAYLOAD caracteres (se guarda fuera del objeto
+ * string), como los trabajos con payload grande del scheduler.
+ */
+
+#include "../Templates/HeapTree/HeapTree.hh"
+#include "../Templates/HeapTree/SoaHeapTree.hh"
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+const unsigned int PAYLOAD = 64; ///< Caracteres de cada valor.
+
+double secondsSince(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Inserta todos los trabajos y luego los extrae en orden.
+ */
+template <typename HeapType>
+void runScenario(const string &name, const vector<int> &priorities, const vector<string> &payloads, size_t &checksum)
+{
+    HeapType heap;
+    heap.reserve(priorities.size());
+
+    auto start = chrono::steady_clock::now();
+    for (unsigned int i = 0; i < priorities.size(); i++)
+        heap.insert(priorities[i], payloads[i]);
+    double tInsert = secondsSince(start);
+
+    start = chrono::steady_clock::now();
+    while (!heap.isEmpty())
+        checksum += heap.extractMax().second.size();
+    double tExtract = secondsSince(start);
+
+    cout << name << "\t" << priorities.size() << "\t" << tInsert << "\t\t" << tExtract << endl;
+}
+
+int main()
+{
+    cout << "heap\t\tn\tinsert(s)\textractMax(s)" << endl;
+
+    size_t checksum = 0;
+    mt19937 rng(42);
+    unsigned int sizes[] = {100000, 1000000, 4000000};
+    for (unsigned int n : sizes)
+    {
+        vector<int> priorities(n);
+        vector<string> payloads(n);
+        for (unsigned int i = 0; i < n; i++)
+        {
+            priorities[i] = static_cast<int>(rng());
+            payloads[i] = string(PAYLOAD, static_cast<char>('a' + i % 26));
+        }
+
+        runScenario<HeapTree<int, string>>("HeapTree", priorities, payloads, checksum);
+        runScenario<SoaHeapTree<int, string>>("SoaHeapTree", priorities, payloads, checksum);
+        cout << endl;
+    }
+
+    cout << "checksum: " << checksum << endl;
+    return 0;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file TraversalBenchmark.cpp
+ * @brief Recorrido por índice (at) vs recorrido con iteradores en List y DoubleLinkedList
+ *
+ * Compilar con optimizaciones, por ejemplo:
+ *   g++ -O2 -std=c++17 TraversalBenchmark.cpp -o TraversalBenchmark
+ */
+
+#include "../include/list.hh"
+#include "../include/DoubleLinkedList.hh"
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <string>
+
+using namespace std;
+
+const unsigned int N = 100000; ///< Elementos en cada lista.
+
+/**
+ * @brief Suma los elementos con un for por índice, como hacen los consumidores actuales.
+ */
+template <typename ListType>
+long long sumByIndex(const ListType &list)
+{
+    long long sum = 0;
+    for (unsigned int i = 0; i < list.size(); i++)
+    {
+        sum += list[i];
+    }
+    return sum;
+}
+
+/**
+ * @brief Suma los elementos con un range-for (iteradores).
+ */
+template <typename ListType>
+long long sumByIterator(const ListType &list)
+{
+    long long sum = 0;
+    for (const int &x : list)
+    {
+        sum += x;
+    }
+    return sum;
+}
+
+/**
+ * @brief Mide una función de recorrido y reporta el tiempo.
+ */
+template <typename ListType>
+void measure(const string &name, long long (*fn)(const ListType &), const ListType &list)
+{
+    auto start = chrono::steady_clock::now();
+    long long sum = fn(list);
+    auto end = chrono::steady_clock::now();
+    cout << name << ": " << chrono::duration<double>(end - start).count()
+         << " s (suma = " << sum << ")" << endl;
+}
+
+int main()
+{
+    List<int> list;
+    DoubleLinkedList<int> dlist;
+    for (unsigned int i = 0; i < N; i++)
+    {
+        list.push_back(static_cast<int>(i));
+        dlist.push_back(static_cast<int>(i));
+    }
+
+    cout << "=== Recorrido de " << N << " elementos ===" << endl;
+
+    measure<List<int>>("List, indice", sumByIndex, list);
+    measure<List<int>>("List, iterador", sumByIterator, list);
+    measure<DoubleLinkedList<int>>("DoubleLinkedList, indice", sumByIndex, dlist);
+    measure<DoubleLinkedList<int>>("DoubleLinkedList, iterador", sumByIterator, dlist);
+
+    auto start = chrono::steady_clock::now();
+    long long sum = accumulate(list.begin(), list.end(), 0LL);
+    auto end = chrono::steady_clock::now();
+    cout << "List, std::accumulate: " << chrono::duration<double>(end - start).count()
+         << " s (suma = " << sum << ")" << endl;
+
+    return 0;
+}
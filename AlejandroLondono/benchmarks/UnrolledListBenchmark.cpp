@@ -0,0 +1,145 @@
+/**
+ * @file UnrolledListBenchmark.cpp
+ * @brief UnrolledList vs List vs DoubleLinkedList: recorrido, inserción aleatoria y memoria
+ *
+ * Compilar con optimizaciones, por ejemplo:
+ *   g++ -O2 -std=c++17 UnrolledListBenchmark.cpp -o UnrolledListBenchmark
+ *
+ * La memoria se mide reemplazando operator new/delete globales para contar
+ * los bytes pedidos (no incluye el overhead interno de malloc).
+ */
+
+#include "../include/list.hh"
+#include "../include/DoubleLinkedList.hh"
+#include "../include/UnrolledList.hh"
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+
+using namespace std;
+
+static size_t liveBytes = 0; ///< Bytes pedidos con new y aún no liberados.
+
+// noinline evita que GCC vea el malloc/free de estos reemplazos y avise
+// de un new/delete "desemparejado" que no es tal.
+// Cada bloque lleva delante una cabecera con su tamaño; se reserva
+// alignof(max_align_t) para no romper la alineación que garantiza new.
+const size_t HEADER = alignof(max_align_t);
+
+__attribute__((noinline)) void *operator new(size_t size)
+{
+    char *p = static_cast<char *>(malloc(size + HEADER));
+    if (p == nullptr)
+        throw bad_alloc();
+    *reinterpret_cast<size_t *>(p) = size;
+    liveBytes += size;
+    return p + HEADER;
+}
+
+__attribute__((noinline)) void operator delete(void *ptr) noexcept
+{
+    if (ptr == nullptr)
+        return;
+    char *p = static_cast<char *>(ptr) - HEADER;
+    liveBytes -= *reinterpret_cast<size_t *>(p);
+    free(p);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+double secondsSince(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Recorre la lista con iteradores.
+ * @return Segundos por elemento recorrido (en nanosegundos).
+ */
+template <typename ListType>
+double traversalNs(const ListType &list, long long &checksum)
+{
+    const int rounds = 3;
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++)
+    {
+        for (const int &x : list)
+        {
+            checksum += x;
+        }
+    }
+    return secondsSince(start) * 1e9 / (static_cast<double>(list.size()) * rounds);
+}
+
+/**
+ * @brief Inserta en posiciones aleatorias.
+ * @return Microsegundos por inserción.
+ */
+template <typename ListType>
+double randomInsertUs(ListType &list, unsigned int inserts)
+{
+    mt19937 rng(42);
+    auto start = chrono::steady_clock::now();
+    for (unsigned int i = 0; i < inserts; i++)
+    {
+        unsigned int pos = rng() % (list.size() + 1);
+        list.insert(pos, static_cast<int>(i));
+    }
+    return secondsSince(start) * 1e6 / inserts;
+}
+
+/**
+ * @brief Corre los tres escenarios para una lista de n elementos.
+ */
+template <typename ListType>
+void runScenario(const string &name, unsigned int n, long long &checksum)
+{
+    size_t before = liveBytes;
+    ListType *list = new ListType();
+    for (unsigned int i = 0; i < n; i++)
+    {
+        list->push_back(static_cast<int>(i));
+    }
+    double bytesPerElement = static_cast<double>(liveBytes - before) / n;
+
+    double traversal = traversalNs(*list, checksum);
+
+    // Las inserciones aleatorias son O(n) cada una en las tres estructuras,
+    // así que se limita el total de trabajo para los tamaños grandes.
+    unsigned int inserts = static_cast<unsigned int>(100000000ULL / n);
+    if (inserts > 1000)
+        inserts = 1000;
+    if (inserts == 0)
+        inserts = 1;
+    double insert = randomInsertUs(*list, inserts);
+
+    delete list;
+
+    cout << name << "\t" << n << "\t" << traversal << "\t\t" << insert << "\t\t" << bytesPerElement << endl;
+}
+
+int main()
+{
+    cout << "estructura\tn\trecorrido(ns/elem)\tinsert(us/op)\tbytes/elem" << endl;
+
+    long long checksum = 0;
+    unsigned int sizes[] = {1000, 10000, 100000, 1000000, 10000000};
+    for (unsigned int n : sizes)
+    {
+        runScenario<List<int>>("List", n, checksum);
+        runScenario<DoubleLinkedList<int>>("DLL", n, checksum);
+        runScenario<UnrolledList<int, 16>>("Unrolled16", n, checksum);
+        runScenario<UnrolledList<int, 64>>("Unrolled64", n, checksum);
+        cout << endl;
+    }
+
+    cout << "checksum: " << checksum << endl;
+    return 0;
+}
@@ -2,8 +2,11 @@
 #define DOUBLE_LINKED_LIST_HH
 
 
+#include <cstddef>
 #include <iostream>
+#include <iterator>
 #include <stdexcept>
+#include <type_traits>
 
 using namespace std;
 
@@ -80,6 +83,84 @@ private:
   Node *last;      ///< Pointer to the last node in the list.
   unsigned int sz; ///< Number of elements in the list.
 
+  // Finger: último nodo accedido por índice y su posición. Si el siguiente
+  // acceso es cercano se camina desde aquí (O(delta)) en lugar de desde un extremo.
+  // Solo los métodos no const lo mueven: at() const lo usa pero no lo escribe,
+  // así varias lecturas concurrentes sobre una lista const siguen siendo seguras.
+  Node *finger;           ///< Last node reached by index (nullptr if invalid).
+  unsigned int fingerIdx; ///< Index of finger.
+
+  /**
+   * @brief Forget the cached finger.
+   */
+  void invalidateFinger()
+  {
+    finger = nullptr;
+    fingerIdx = 0;
+  }
+
+  /**
+   * @brief Find the node at a position, walking from the closest of first, last or the finger.
+   *
+   * The finger is only read, so this is safe to call concurrently on a const list.
+   *
+   * @param index Index of the node (must be < sz).
+   * @return Pointer to the node at index.
+   */
+  Node *findNode(unsigned int index) const
+  {
+    Node *current;
+    unsigned int pos;
+    unsigned int best;
+
+    if (index <= sz - 1 - index)
+    {
+      current = first;
+      pos = 0;
+      best = index;
+    }
+    else
+    {
+      current = last;
+      pos = sz - 1;
+      best = sz - 1 - index;
+    }
+
+    if (finger != nullptr)
+    {
+      unsigned int delta = (index > fingerIdx) ? index - fingerIdx : fingerIdx - index;
+      if (delta < best)
+      {
+        current = finger;
+        pos = fingerIdx;
+      }
+    }
+
+    while (pos < index)
+    {
+      current = current->getNext();
+      pos++;
+    }
+    while (pos > index)
+    {
+      current = current->getPrev();
+      pos--;
+    }
+    return current;
+  }
+
+  /**
+   * @brief Find the node at a position and move the finger to it.
+   * @param index Index of the node (must be < sz).
+   * @return Pointer to the node at index.
+   */
+  Node *nodeAt(unsigned int index)
+  {
+    finger = findNode(index);
+    fingerIdx = index;
+    return finger;
+  }
+
   /**
    * @brief Free all nodes starting from a given node.
    * @param node Pointer to the starting node.
@@ -95,10 +176,104 @@ private:
   }
 
 public:
+  /**
+   * @brief Bidirectional iterator over the elements of the list.
+   *
+   * Moving in either direction is O(1), so range-for loops and <algorithm>
+   * traverse the list in linear time instead of calling at() for every index.
+   * The iterator keeps a pointer to its list so that --end() reaches back().
+   *
+   * @tparam IsConst true for const_iterator, false for iterator.
+   */
+  template <bool IsConst>
+  class Iterator
+  {
+  private:
+    Node *node;                   ///< Current node (nullptr for end()).
+    const DoubleLinkedList *list; ///< List the iterator belongs to.
+
+    Iterator(Node *n, const DoubleLinkedList *l) : node(n), list(l) {}
+
+    friend class DoubleLinkedList;
+    friend class Iterator<!IsConst>;
+
+  public:
+    typedef std::bidirectional_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef typename std::conditional<IsConst, const T *, T *>::type pointer;
+    typedef typename std::conditional<IsConst, const T &, T &>::type reference;
+
+    /**
+     * @brief Default constructor. Creates a singular iterator.
+     */
+    Iterator() : node(nullptr), list(nullptr) {}
+
+    /**
+     * @brief Conversion from iterator to const_iterator.
+     * @param other Iterator to convert.
+     */
+    template <bool WasConst, typename = typename std::enable_if<IsConst && !WasConst>::type>
+    Iterator(const Iterator<WasConst> &other) : node(other.node), list(other.list) {}
+
+    reference operator*() const { return node->getData(); }
+    pointer operator->() const { return &node->getData(); }
+
+    /**
+     * @brief Advance to the next element (prefix).
+     * @return Reference to this iterator.
+     */
+    Iterator &operator++()
+    {
+      node = node->getNext();
+      return *this;
+    }
+
+    /**
+     * @brief Advance to the next element (postfix).
+     * @return Copy of the iterator before advancing.
+     */
+    Iterator operator++(int)
+    {
+      Iterator temp = *this;
+      ++(*this);
+      return temp;
+    }
+
+    /**
+     * @brief Move back to the previous element (prefix).
+     * @return Reference to this iterator.
+     */
+    Iterator &operator--()
+    {
+      node = (node == nullptr) ? list->last : node->getPrev();
+      return *this;
+    }
+
+    /**
+     * @brief Move back to the previous element (postfix).
+     * @return Copy of the iterator before moving.
+     */
+    Iterator operator--(int)
+    {
+      Iterator temp = *this;
+      --(*this);
+      return temp;
+    }
+
+    bool operator==(const Iterator &other) const { return node == other.node; }
+    bool operator!=(const Iterator &other) const { return node != other.node; }
+  };
+
+  typedef Iterator<false> iterator;
+  typedef Iterator<true> const_iterator;
+  typedef std::reverse_iterator<iterator> reverse_iterator;
+  typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
   /**
    * @brief Default constructor. Initializes an empty list.
    */
-  DoubleLinkedList() : first(nullptr), last(nullptr), sz(0) {}
+  DoubleLinkedList() : first(nullptr), last(nullptr), sz(0), finger(nullptr), fingerIdx(0) {}
 
   /**
    * @brief Destructor. Deletes all nodes in the list.
@@ -149,6 +324,9 @@ public:
     if (empty())
       throw std::out_of_range("list is empty");
 
+    if (finger == last)
+      invalidateFinger();
+
     Node *temp = last;
     last = last->getPrev();
 
@@ -183,6 +361,9 @@ public:
       first = newNode;
     }
     sz++;
+
+    if (finger != nullptr)
+      fingerIdx++;
   }
 
   /**
@@ -197,6 +378,11 @@ public:
     if (empty())
       throw std::out_of_range("list is empty");
 
+    if (finger == first)
+      invalidateFinger();
+    else if (finger != nullptr)
+      fingerIdx--;
+
     Node *temp = first;
     first = first->getNext();
 
@@ -305,12 +491,14 @@ public:
     freeNodes(first);
     first = last = nullptr;
     sz = 0;
+    invalidateFinger();
   }
 
   /**
    * @brief Get the element at a specific index (const version).
    *
    * This function returns a const reference to the data stored in the node at the specified index.
+   * It uses the finger but does not move it, so concurrent const reads are safe.
    *
    * @param index Index of the element to retrieve.
    * @return Const reference to the element at the specified index.
@@ -323,24 +511,8 @@ public:
       throw out_of_range("Index out of range");
     }
 
-    Node *current; // ahora con este tipo de lista podemos hacerlo un poco mas eficiente O(n/2)
-
-    if (index <= sz / 2) // dependiendo en donde se encuentre el index podemos comenzar en first hasta la mitado en last hasta la mitad
-    {
-      current = first;
-      for (unsigned int i = 0; i < index; i++)
-      {
-        current = current->getNext();
-      }
-    }
-    else
-    {
-      current = last;
-      for (unsigned int i = sz - 1; i > index; i--)
-      {
-        current = current->getPrev();
-      }
-    }
+    // Se camina desde el extremo más cercano o desde el finger, pero sin moverlo (ver findNode)
+    Node *current = findNode(index);
     return current->getData();
   }
 
@@ -348,6 +520,7 @@ public:
    * @brief Get the element at a specific index.
    *
    * This function returns a reference to the data stored in the node at the specified index.
+   * The finger is moved to that node, so nearby accesses that follow are O(delta).
    *
    * @param index Index of the element to retrieve.
    * @return Reference to the element at the specified index.
@@ -360,24 +533,8 @@ public:
       throw out_of_range("Index out of range");
     }
 
-    Node *current; // ahora con este tipo de lista podemos hacerlo un poco mas eficiente O(n/2)
-
-    if (index <= sz / 2) // dependiendo en donde se encuentre el index podemos comenzar en first hasta la mitado en last hasta la mitad
-    {
-      current = first;
-      for (unsigned int i = 0; i < index; i++)
-      {
-        current = current->getNext();
-      }
-    }
-    else
-    {
-      current = last;
-      for (unsigned int i = sz - 1; i > index; i--)
-      {
-        current = current->getPrev();
-      }
-    }
+    // Se camina desde el extremo más cercano o desde el finger, lo que esté más cerca
+    Node *current = nodeAt(index);
     return current->getData();
   }
 
@@ -432,24 +589,7 @@ public:
     else
     {
       Node *newNode = new Node(val);
-      Node *current;
-
-      if (index < sz / 2)
-      {
-        current = first;
-        for (unsigned int i = 0; i < index - 1; i++)
-        {
-          current = current->getNext();
-        }
-      }
-      else
-      {
-        current = last;
-        for (unsigned int i = sz - 1; i > index - 1; i--)
-        {
-          current = current->getPrev();
-        }
-      }
+      Node *current = nodeAt(index - 1); // el finger queda en index - 1, que no se mueve
 
       Node *nextNode = (current->getNext());
 
@@ -486,24 +626,7 @@ public:
     }
     else
     {
-      Node *current;
-
-      if (index < sz / 2)
-      {
-        current = first;
-        for (unsigned int i = 0; i < index - 1; i++)
-        {
-          current = current->getNext();
-        }
-      }
-      else
-      {
-        current = last;
-        for (unsigned int i = sz - 1; i > index - 1; i--)
-        {
-          current = current->getPrev();
-        }
-      }
+      Node *current = nodeAt(index - 1); // el finger queda en index - 1, que no se mueve
 
       Node *temp = current->getNext();
 
@@ -544,6 +667,9 @@ public:
 
     last = first;
     first = temp->getPrev(); // No es un swap (temp = first; first = last; last = temp;), sino una reasignación apoyándome en la estructura enlazada de la lista.
+
+    if (finger != nullptr)
+      fingerIdx = sz - 1 - fingerIdx; // el nodo sigue siendo el mismo, pero ahora se cuenta desde el otro extremo
   }
 
   /**
@@ -557,6 +683,8 @@ public:
   {
     first = last = nullptr;
     sz = 0;
+    finger = nullptr;
+    fingerIdx = 0;
 
     Node *current = other.first; // el codigo queda igual a el de list, existe una forma de intentar optimizar, pero es una mejora muy pequeña a comparacion de los bugs que puede ocacionar
     while (current != nullptr)
@@ -637,6 +765,128 @@ DoubleLinkedList& operator=(const DoubleLinkedList &other) {  //operador de asig
     }
     cout << endl;
   }
+  // ==================== ITERADORES ====================
+
+  /**
+   * @brief Get an iterator to the first element.
+   * @return Iterator to the first element (end() if the list is empty).
+   */
+  iterator begin() { return iterator(first, this); }
+
+  /**
+   * @brief Get an iterator past the last element.
+   * @return Iterator that compares equal to an iterator advanced past back().
+   */
+  iterator end() { return iterator(nullptr, this); }
+
+  const_iterator begin() const { return const_iterator(first, this); }
+  const_iterator end() const { return const_iterator(nullptr, this); }
+  const_iterator cbegin() const { return const_iterator(first, this); }
+  const_iterator cend() const { return const_iterator(nullptr, this); }
+
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+  const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+  /**
+   * @brief Insert an element before a position in O(1).
+   * @param pos Iterator to an element of this list, or end() to append.
+   * @param val Value to insert.
+   * @return Iterator to the inserted element.
+   */
+  iterator insert(const_iterator pos, const T &val)
+  {
+    if (pos.node == nullptr)
+    {
+      push_back(val);
+      return iterator(last, this);
+    }
+    if (pos.node == first)
+    {
+      push_front(val);
+      return iterator(first, this);
+    }
+
+    Node *newNode = new Node(val);
+    Node *prevNode = pos.node->getPrev();
+    invalidateFinger(); // no se conoce el índice de pos
+
+    newNode->setNext(pos.node);
+    newNode->setPrev(prevNode);
+    prevNode->setNext(newNode);
+    pos.node->setPrev(newNode);
+
+    sz++;
+    return iterator(newNode, this);
+  }
+
+  /**
+   * @brief Remove the element at a position in O(1).
+   * @param pos Iterator to an element of this list.
+   * @return Iterator to the element that followed the erased one.
+   * @throws std::out_of_range if pos is end().
+   */
+  iterator erase(const_iterator pos)
+  {
+    if (pos.node == nullptr)
+      throw std::out_of_range("Cannot erase end()");
+
+    Node *nextNode = pos.node->getNext();
+    if (pos.node == first)
+    {
+      pop_front();
+    }
+    else if (pos.node == last)
+    {
+      pop_back();
+    }
+    else
+    {
+      invalidateFinger(); // no se conoce el índice de pos
+      pos.node->getPrev()->setNext(nextNode);
+      nextNode->setPrev(pos.node->getPrev());
+      delete pos.node;
+      sz--;
+    }
+    return iterator(nextNode, this);
+  }
+
+  /**
+   * @brief Move all the elements of another list before a position in O(1).
+   *
+   * No element is copied; the nodes of other are relinked into this list.
+   *
+   * @param pos Iterator to an element of this list, or end() to append.
+   * @param other List whose elements are moved; it is left empty.
+   */
+  void splice(const_iterator pos, DoubleLinkedList &other)
+  {
+    if (this == &other || other.empty())
+      return;
+
+    Node *nextNode = pos.node;
+    Node *prevNode = (nextNode == nullptr) ? last : nextNode->getPrev();
+    invalidateFinger();
+    other.invalidateFinger(); // el finger de other apuntaría a nodos que ahora son de esta lista
+
+    other.first->setPrev(prevNode);
+    other.last->setNext(nextNode);
+
+    if (prevNode != nullptr)
+      prevNode->setNext(other.first);
+    else
+      first = other.first;
+
+    if (nextNode != nullptr)
+      nextNode->setPrev(other.last);
+    else
+      last = other.last;
+
+    sz += other.sz;
+    other.first = other.last = nullptr;
+    other.sz = 0;
+  }
 };
 
 #endif // DOUBLE_LINKED_LIST_HH
\ No newline at end of file
@@ -0,0 +1,352 @@
+/**
+ * @file DoubleLinkedListTest.cpp
+ * @brief Pruebas para DoubleLinkedList (include/DoubleLinkedList.hh): iteradores bidireccionales,
+ *        insert / erase / splice por iterador y el finger de at()
+ *
+ * Compilar, por ejemplo:
+ *   g++ -std=c++17 -fsanitize=address,undefined DoubleLinkedListTest.cpp -o DoubleLinkedListTest
+ */
+
+#include "DoubleLinkedList.hh"
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+int failures = 0;
+
+void printHeader(const string &title)
+{
+    cout << "\n" << string(70, '=') << endl;
+    cout << "  " << title << endl;
+    cout << string(70, '=') << endl;
+}
+
+void printTest(const string &test, bool passed)
+{
+    if (!passed)
+        failures++;
+    cout << "[" << (passed ? "✓ PASS" : "✗ FAIL") << "] " << test << endl;
+}
+
+/**
+ * @brief Compara la lista con el modelo de frente, de atrás (reverse_iterator) y en front/back/size
+ */
+template <typename T>
+bool sameAs(const DoubleLinkedList<T> &list, const vector<T> &model)
+{
+    if (list.size() != model.size() || list.empty() != model.empty())
+        return false;
+    if (vector<T>(list.begin(), list.end()) != model)
+        return false;
+    if (vector<T>(list.rbegin(), list.rend()) != vector<T>(model.rbegin(), model.rend()))
+        return false;
+    return model.empty() || (list.front() == model.front() && list.back() == model.back());
+}
+
+/**
+ * @brief Iterador a la posición index, avanzando desde begin()
+ */
+template <typename T>
+typename DoubleLinkedList<T>::iterator iterAt(DoubleLinkedList<T> &list, unsigned int index)
+{
+    typename DoubleLinkedList<T>::iterator it = list.begin();
+    std::advance(it, index);
+    return it;
+}
+
+int main()
+{
+    cout << "\n╔══════════════════════════════════════════════════════════════════╗\n";
+    cout << "║                  PRUEBAS DE DOUBLELINKEDLIST                     ║\n";
+    cout << "╚══════════════════════════════════════════════════════════════════╝\n";
+
+    // ==================== PRUEBA 1: iteradores bidireccionales ====================
+    printHeader("PRUEBA 1: Iteradores bidireccionales y reverse_iterator");
+
+    {
+        DoubleLinkedList<int> list;
+        printTest("begin() == end() en una lista vacía", list.begin() == list.end() && list.rbegin() == list.rend());
+        for (int i = 0; i < 5; i++)
+            list.push_back(i);
+
+        DoubleLinkedList<int>::iterator it = list.end();
+        --it;
+        printTest("--end() llega a back()", *it == 4);
+        it--;
+        printTest("Decremento postfijo", *it == 3);
+        printTest("reverse_iterator recorre al revés", vector<int>(list.rbegin(), list.rend()) == vector<int>({4, 3, 2, 1, 0}));
+
+        const DoubleLinkedList<int> &constList = list;
+        DoubleLinkedList<int>::const_iterator cit = constList.end();
+        std::advance(cit, -5);
+        printTest("const_iterator retrocede hasta begin()", cit == constList.begin() && *cit == 0);
+
+        for (int &value : list)
+            value *= 10;
+        printTest("range-for modifica los elementos", sameAs(list, vector<int>({0, 10, 20, 30, 40})));
+        printTest("<algorithm> con iteradores bidireccionales",
+                  std::find(list.begin(), list.end(), 30) == iterAt(list, 3) &&
+                      std::find(list.rbegin(), list.rend(), 10).base() == iterAt(list, 2));
+    }
+
+    // ==================== PRUEBA 2: insert y erase por iterador ====================
+    printHeader("PRUEBA 2: insert / erase por iterador en O(1)");
+
+    {
+        DoubleLinkedList<int> list;
+        DoubleLinkedList<int>::iterator it = list.insert(list.end(), 2);
+        printTest("insert(end()) en una lista vacía", sameAs(list, vector<int>({2})) && *it == 2);
+        it = list.insert(list.begin(), 0);
+        printTest("insert(begin()) actualiza front()", sameAs(list, vector<int>({0, 2})) && it == list.begin());
+        it = list.insert(iterAt(list, 1), 1);
+        printTest("insert en medio enlaza prev y next", sameAs(list, vector<int>({0, 1, 2})) && *it == 1);
+        list.insert(list.end(), 3);
+        printTest("insert(end()) agrega al final", sameAs(list, vector<int>({0, 1, 2, 3})));
+
+        it = list.erase(iterAt(list, 1));
+        printTest("erase en medio devuelve el siguiente", sameAs(list, vector<int>({0, 2, 3})) && *it == 2);
+        it = list.erase(list.begin());
+        printTest("erase(begin()) actualiza front()", sameAs(list, vector<int>({2, 3})) && it == list.begin());
+        it = list.erase(--list.end());
+        printTest("erase del último devuelve end() y actualiza back()", sameAs(list, vector<int>({2})) && it == list.end());
+        it = list.erase(list.begin());
+        printTest("erase del único elemento deja la lista vacía", list.empty() && it == list.end());
+        try
+        {
+            list.erase(list.end());
+            printTest("erase(end()) lanza out_of_range", false);
+        }
+        catch (const out_of_range &)
+        {
+            printTest("erase(end()) lanza out_of_range", true);
+        }
+    }
+
+    {
+        mt19937 rng(11);
+        DoubleLinkedList<int> list;
+        vector<int> model;
+        bool ok = true;
+        for (int step = 0; step < 3000 && ok; step++)
+        {
+            if (model.empty() || rng() % 2 == 0)
+            {
+                unsigned int index = rng() % (model.size() + 1);
+                list.insert(iterAt(list, index), step);
+                model.insert(model.begin() + index, step);
+            }
+            else
+            {
+                unsigned int index = rng() % model.size();
+                list.erase(iterAt(list, index));
+                model.erase(model.begin() + index);
+            }
+            ok = list.size() == model.size() && (model.empty() || (list.front() == model.front() && list.back() == model.back()));
+        }
+        printTest("3000 insert / erase por iterador al azar contra std::vector", ok && sameAs(list, model));
+    }
+
+    // ==================== PRUEBA 3: splice ====================
+    printHeader("PRUEBA 3: splice en O(1)");
+
+    {
+        DoubleLinkedList<int> a;
+        DoubleLinkedList<int> b;
+        for (int i = 0; i < 3; i++)
+            a.push_back(i);
+        for (int i = 10; i < 13; i++)
+            b.push_back(i);
+        int *addr = &b.front();
+        a.splice(iterAt(a, 1), b);
+        printTest("splice en medio re-enlaza los nodos (misma dirección)",
+                  sameAs(a, vector<int>({0, 10, 11, 12, 1, 2})) && &a.at(1) == addr);
+        printTest("other queda vacía y usable", b.empty() && b.size() == 0 && b.begin() == b.end());
+
+        b.push_back(-2);
+        b.push_back(-1);
+        a.splice(a.begin(), b);
+        printTest("splice(begin()) actualiza front()", sameAs(a, vector<int>({-2, -1, 0, 10, 11, 12, 1, 2})));
+
+        b.push_back(20);
+        a.splice(a.end(), b);
+        a.push_back(21);
+        printTest("splice(end()) actualiza back()", sameAs(a, vector<int>({-2, -1, 0, 10, 11, 12, 1, 2, 20, 21})));
+
+        DoubleLinkedList<int> empty;
+        empty.splice(empty.end(), a);
+        printTest("splice sobre una lista vacía", sameAs(empty, vector<int>({-2, -1, 0, 10, 11, 12, 1, 2, 20, 21})) && a.empty());
+        empty.splice(empty.begin(), empty);
+        empty.splice(empty.begin(), a);
+        printTest("splice de sí misma o de una lista vacía no hace nada", empty.size() == 10);
+    }
+
+    {
+        DoubleLinkedList<string> a;
+        DoubleLinkedList<string> b;
+        for (int i = 0; i < 5; i++)
+        {
+            a.push_back("a" + to_string(i));
+            b.push_back("b" + to_string(i));
+        }
+        a.splice(iterAt(a, 2), b);
+        a.reverse();
+        DoubleLinkedList<string> copy(a);
+        a.clear();
+        b.push_back("x");
+        printTest("Strings: splice, reverse, copia y clear (sin fugas con ASan)",
+                  copy.size() == 10 && copy.front() == "a4" && copy.at(5) == "b2" && copy.back() == "a0" &&
+                      b.size() == 1 && a.empty());
+    }
+
+    // ==================== PRUEBA 4: finger ====================
+    printHeader("PRUEBA 4: El finger se invalida o se ajusta en cada modificación");
+
+    {
+        DoubleLinkedList<int> a;
+        DoubleLinkedList<int> b;
+        for (int i = 0; i < 10; i++)
+        {
+            a.push_back(i);
+            b.push_back(100 + i);
+        }
+        b.at(5); // el finger de b queda en su nodo 5
+        a.splice(a.begin(), b);
+        for (int i = 200; i < 210; i++)
+            b.push_back(i);
+        printTest("splice invalida el finger de other", b.at(5) == 205);
+        a.erase(5);
+        printTest("at() sobre other sigue siendo correcto después de borrar el nodo en la lista destino",
+                  b.at(5) == 205 && a.at(5) == 106);
+    }
+
+    {
+        DoubleLinkedList<int> list;
+        for (int i = 0; i < 10; i++)
+            list.push_back(i);
+        const DoubleLinkedList<int> &constList = list;
+        list.at(7);
+        list.erase(iterAt(list, 7));
+        printTest("erase(iterador) del nodo del finger", list.at(7) == 8 && constList.at(6) == 6);
+        list.at(3);
+        list.insert(iterAt(list, 2), -1);
+        printTest("insert(iterador) antes del finger", list.at(3) == 2 && list.at(4) == 3);
+        list.at(2);
+        list.reverse();
+        printTest("reverse ajusta la posición del finger", list.at(2) == 6 && list.at(list.size() - 3) == -1);
+        DoubleLinkedList<int> prefix;
+        prefix.push_back(-20);
+        prefix.push_back(-10);
+        list.at(4);
+        list.push_front(prefix);
+        printTest("push_front(lista) corre el finger", list.at(6) == 4 && list.at(0) == -20 && list.at(2) == 9);
+        list.at(5);
+        list.clear();
+        list.push_back(42);
+        printTest("clear invalida el finger", list.at(0) == 42 && list.size() == 1);
+    }
+
+    {
+        mt19937 rng(23);
+        DoubleLinkedList<int> lists[2];
+        vector<int> models[2];
+        bool ok = true;
+        for (int step = 0; step < 20000 && ok; step++)
+        {
+            unsigned int w = rng() % 2;
+            DoubleLinkedList<int> &list = lists[w];
+            vector<int> &model = models[w];
+            DoubleLinkedList<int> &other = lists[1 - w];
+            vector<int> &otherModel = models[1 - w];
+            unsigned int op = rng() % 14;
+
+            if (op <= 4 && !model.empty())
+            {
+                // Lectura que mueve el finger (no const) o que solo lo usa (const)
+                unsigned int index = rng() % model.size();
+                const DoubleLinkedList<int> &constList = list;
+                ok = (op % 2 == 0 ? list.at(index) : constList.at(index)) == model[index];
+            }
+            else if (op == 5)
+            {
+                unsigned int index = rng() % (model.size() + 1);
+                list.insert(index, step);
+                model.insert(model.begin() + index, step);
+            }
+            else if (op == 6 && !model.empty())
+            {
+                unsigned int index = rng() % model.size();
+                list.erase(index);
+                model.erase(model.begin() + index);
+            }
+            else if (op == 7)
+            {
+                unsigned int index = rng() % (model.size() + 1);
+                list.insert(iterAt(list, index), step);
+                model.insert(model.begin() + index, step);
+            }
+            else if (op == 8 && !model.empty())
+            {
+                unsigned int index = rng() % model.size();
+                list.erase(iterAt(list, index));
+                model.erase(model.begin() + index);
+            }
+            else if (op == 9)
+            {
+                list.reverse();
+                std::reverse(model.begin(), model.end());
+            }
+            else if (op == 10)
+            {
+                list.push_front(other);
+                model.insert(model.begin(), otherModel.begin(), otherModel.end());
+            }
+            else if (op == 11 && !model.empty())
+            {
+                if (rng() % 2 == 0)
+                {
+                    list.pop_front();
+                    model.erase(model.begin());
+                }
+                else
+                {
+                    list.pop_back();
+                    model.pop_back();
+                }
+            }
+            else if (op == 12)
+            {
+                unsigned int index = rng() % (model.size() + 1);
+                list.splice(iterAt(list, index), other);
+                model.insert(model.begin() + index, otherModel.begin(), otherModel.end());
+                otherModel.clear();
+            }
+            else if (op == 13 && rng() % 8 == 0)
+            {
+                list.clear();
+                model.clear();
+            }
+            else
+            {
+                list.push_back(step);
+                model.push_back(step);
+            }
+
+            if (model.size() > 200)
+            {
+                list.clear();
+                model.clear();
+            }
+        }
+        printTest("20000 operaciones al azar sobre dos listas: at() coincide con std::vector",
+                  ok && sameAs(lists[0], models[0]) && sameAs(lists[1], models[1]));
+    }
+
+    cout << "\n" << (failures == 0 ? "Todas las pruebas pasaron" : "Hay pruebas que fallaron") << endl;
+    return failures == 0 ? 0 : 1;
+}
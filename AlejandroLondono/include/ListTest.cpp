@@ -0,0 +1,361 @@
+/**
+ * @file ListTest.cpp
+ * @brief Pruebas para List (include/list.hh) y PoolAllocator (include/NodePool.hh)
+ *
+ * Compilar, por ejemplo:
+ *   g++ -std=c++17 -fsanitize=address,undefined ListTest.cpp -o ListTest
+ */
+
+#include "list.hh"
+#include "NodePool.hh"
+#include <iostream>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+int failures = 0;
+
+void printHeader(const string &title)
+{
+    cout << "\n" << string(70, '=') << endl;
+    cout << "  " << title << endl;
+    cout << string(70, '=') << endl;
+}
+
+void printTest(const string &test, bool passed)
+{
+    if (!passed)
+        failures++;
+    cout << "[" << (passed ? "✓ PASS" : "✗ FAIL") << "] " << test << endl;
+}
+
+/**
+ * @brief Cuenta los objetos vivos para verificar que clear() y el destructor destruyen todo
+ */
+struct Counted
+{
+    static int live;
+    int value;
+
+    Counted(int v) : value(v) { live++; }
+    Counted(const Counted &other) : value(other.value) { live++; }
+    ~Counted() { live--; }
+    bool operator!=(const Counted &other) const { return value != other.value; }
+};
+
+int Counted::live = 0;
+
+/**
+ * @brief Contenido de una lista, recorrida con at()
+ */
+template <typename L>
+vector<int> contents(const L &list)
+{
+    vector<int> out;
+    for (unsigned int i = 0; i < list.size(); i++)
+        out.push_back(static_cast<int>(list.at(i)));
+    return out;
+}
+
+/**
+ * @brief Contenido de una lista, recorrida con sus iteradores
+ */
+template <typename L>
+vector<int> iterValues(const L &list)
+{
+    return vector<int>(list.begin(), list.end());
+}
+
+int main()
+{
+    cout << "\n╔══════════════════════════════════════════════════════════════════╗\n";
+    cout << "║                PRUEBAS DE LIST Y POOLALLOCATOR                   ║\n";
+    cout << "╚══════════════════════════════════════════════════════════════════╝\n";
+
+    // ==================== PRUEBA 1: NodeArena ====================
+    printHeader("PRUEBA 1: NodeArena (bump pointer, lista de libres y release)");
+
+    {
+        NodeArena arena(sizeof(int), 8);
+        vector<void *> blocks;
+        for (int i = 0; i < 20; i++)
+            blocks.push_back(arena.allocate());
+        set<void *> distinct(blocks.begin(), blocks.end());
+        printTest("20 bloques distintos repartidos en 3 chunks", distinct.size() == 20);
+
+        arena.deallocate(blocks[5]);
+        printTest("deallocate + allocate reusa el mismo bloque", arena.allocate() == blocks[5]);
+
+        arena.release();
+        vector<void *> again;
+        for (int i = 0; i < 20; i++)
+            again.push_back(arena.allocate());
+        printTest("Después de release() se reusan los mismos chunks en el mismo orden", again == blocks);
+        void *extra = arena.allocate();
+        printTest("Pasado el último chunk se pide uno nuevo", distinct.count(extra) == 0);
+    }
+    try
+    {
+        NodeArena invalid(8, 0);
+        printTest("NodeArena con 0 bloques por chunk lanza invalid_argument", false);
+    }
+    catch (const invalid_argument &)
+    {
+        printTest("NodeArena con 0 bloques por chunk lanza invalid_argument", true);
+    }
+
+    // ==================== PRUEBA 2: PoolAllocator ====================
+    printHeader("PRUEBA 2: PoolAllocator (copias y rebinds comparten las arenas)");
+
+    {
+        PoolAllocator<int, 4> a;
+        PoolAllocator<int, 4> b(a);
+        PoolAllocator<int, 4> c;
+        printTest("Una copia comparte la arena (==)", a == b && !(a != b));
+        printTest("Dos allocators por defecto tienen arenas distintas", a != c);
+
+        int *p = a.allocate(1);
+        *p = 7;
+        b.deallocate(p, 1);
+        printTest("Un bloque liberado por una copia vuelve a la arena compartida", a.allocate(1) == p);
+
+        int *arr = a.allocate(10);
+        for (int i = 0; i < 10; i++)
+            arr[i] = i;
+        a.deallocate(arr, 10);
+        printTest("allocate(n > 1) usa el allocator global", true);
+
+        PoolAllocator<double, 4> rebound(a);
+        double *d = rebound.allocate(1);
+        *d = 1.5;
+        rebound.deallocate(d, 1);
+        printTest("Rebind a otro tipo comparte el store (==)", rebound == a && rebound != c);
+
+        PoolAllocator<int, 4> back(rebound);
+        printTest("A(B(a)) == a", back == a && back != c);
+        int *q = back.allocate(1);
+        a.deallocate(q, 1);
+        printTest("El rebind de vuelta usa la misma arena para int", a.allocate(1) == q);
+
+        struct Big
+        {
+            char bytes[100];
+        };
+        PoolAllocator<Big, 4> big(a);
+        Big *bp = big.allocate(1);
+        int *ip = a.allocate(1);
+        printTest("Un tamaño distinto usa otra arena del store", reinterpret_cast<void *>(bp) != reinterpret_cast<void *>(ip));
+        big.deallocate(bp, 1);
+        a.deallocate(ip, 1);
+    }
+
+    // ==================== PRUEBA 3: List con pool, clear y reuso ====================
+    printHeader("PRUEBA 3: List<Counted, PoolAllocator>: clear() destruye y reusa los chunks");
+
+    {
+        List<Counted, PoolAllocator<Counted, 16>> pooled;
+        for (int i = 0; i < 100; i++)
+            pooled.push_back(Counted(i));
+        printTest("100 elementos vivos", Counted::live == 100 && pooled.size() == 100);
+
+        pooled.clear();
+        printTest("clear() destruye todos los elementos", Counted::live == 0 && pooled.empty() && pooled.size() == 0);
+
+        for (int i = 0; i < 50; i++)
+            pooled.push_front(Counted(i));
+        printTest("La lista se vuelve a llenar después de clear()", pooled.size() == 50 && pooled.front().value == 49 &&
+                                                                         pooled.back().value == 0 && Counted::live == 50);
+        pooled.erase(10);
+        pooled.pop_front();
+        pooled.pop_back();
+        printTest("erase / pop_front / pop_back devuelven los nodos a la arena", pooled.size() == 47 && Counted::live == 47);
+        pooled.push_back(Counted(-1));
+        printTest("Un nodo devuelto se reusa", pooled.back().value == -1 && Counted::live == 48);
+    }
+    printTest("El destructor destruye los elementos antes de soltar la arena", Counted::live == 0);
+
+    {
+        List<string, PoolAllocator<string, 8>> words;
+        for (int i = 0; i < 40; i++)
+            words.push_back(string(50, static_cast<char>('a' + i % 26)));
+        List<string, PoolAllocator<string, 8>> copy(words);
+        words.clear();
+        for (int i = 0; i < 40; i++)
+            words.push_back(to_string(i));
+        bool ok = words.size() == 40 && words.at(39) == "39" && copy.size() == 40 && copy.at(1) == string(50, 'b');
+        copy = words;
+        ok = ok && copy.size() == 40 && copy.at(0) == "0";
+        printTest("Strings (sin fugas con ASan) en una lista con pool: copia, clear y asignación", ok);
+    }
+
+    {
+        List<int, PoolAllocator<int, 32>> ints;
+        for (int i = 0; i < 1000; i++)
+            ints.push_back(i);
+        ints.clear();
+        for (int i = 0; i < 1000; i++)
+            ints.push_back(2 * i);
+        vector<int> expected;
+        for (int i = 0; i < 1000; i++)
+            expected.push_back(2 * i);
+        printTest("Tipo trivial: clear() suelta la arena entera y se puede volver a llenar", contents(ints) == expected);
+    }
+
+    // ==================== PRUEBA 4: insert_after y erase_after ====================
+    printHeader("PRUEBA 4: insert_after / erase_after en O(1)");
+
+    {
+        List<int> list;
+        list.push_back(1);
+        auto it = list.insert_after(list.begin(), 3);
+        list.insert_after(list.cbegin(), 2);
+        it = list.insert_after(it, 4); // después del último: back() debe actualizarse
+        printTest("insert_after en medio y después del último", iterValues(list) == vector<int>({1, 2, 3, 4}) &&
+                                                                   *it == 4 && list.back() == 4 && list.size() == 4);
+        list.push_back(5);
+        printTest("push_back después de insert_after al final", list.back() == 5 && iterValues(list).back() == 5);
+
+        auto next = list.erase_after(list.begin());
+        printTest("erase_after devuelve el siguiente al borrado", next != list.end() && *next == 3 &&
+                                                                     iterValues(list) == vector<int>({1, 3, 4, 5}));
+        auto pos = list.begin();
+        ++pos;
+        ++pos; // 4
+        next = list.erase_after(pos);
+        printTest("erase_after del último actualiza back()", next == list.end() && list.back() == 4 && list.size() == 3);
+        list.push_back(6);
+        printTest("push_back después de borrar el último", iterValues(list) == vector<int>({1, 3, 4, 6}));
+
+        bool threw = false;
+        try
+        {
+            list.insert_after(list.end(), 0);
+        }
+        catch (const out_of_range &)
+        {
+            threw = true;
+        }
+        printTest("insert_after(end()) lanza out_of_range", threw);
+        threw = false;
+        try
+        {
+            auto lastIt = list.begin();
+            for (unsigned int i = 1; i < list.size(); i++)
+                ++lastIt;
+            list.erase_after(lastIt);
+        }
+        catch (const out_of_range &)
+        {
+            threw = true;
+        }
+        printTest("erase_after(último) lanza out_of_range", threw && list.size() == 4);
+    }
+
+    {
+        mt19937 rng(7);
+        List<int, PoolAllocator<int, 16>> list;
+        vector<int> model;
+        list.push_back(0);
+        model.push_back(0);
+        bool ok = true;
+        for (int step = 0; step < 3000 && ok; step++)
+        {
+            unsigned int index = rng() % model.size();
+            auto pos = list.begin();
+            for (unsigned int i = 0; i < index; i++)
+                ++pos;
+            if (rng() % 2 == 0 || index + 1 == model.size())
+            {
+                list.insert_after(pos, step);
+                model.insert(model.begin() + index + 1, step);
+            }
+            else
+            {
+                list.erase_after(pos);
+                model.erase(model.begin() + index + 1);
+            }
+            ok = list.size() == model.size() && list.back() == model.back();
+        }
+        printTest("3000 insert_after / erase_after al azar contra std::vector (PoolAllocator)",
+                  ok && iterValues(list) == model);
+    }
+
+    // ==================== PRUEBA 5: splice_after ====================
+    printHeader("PRUEBA 5: splice_after (enlazando nodos o copiando entre pools)");
+
+    {
+        List<int> a;
+        List<int> b;
+        for (int i = 0; i < 3; i++)
+            a.push_back(i);
+        for (int i = 10; i < 13; i++)
+            b.push_back(i);
+        List<int>::iterator firstB = b.begin();
+        int *addr = &*firstB;
+        a.splice_after(a.begin(), b);
+        printTest("Con std::allocator los nodos se re-enlazan (misma dirección)",
+                  iterValues(a) == vector<int>({0, 10, 11, 12, 1, 2}) && &a.at(1) == addr);
+        printTest("other queda vacía", b.empty() && b.size() == 0 && b.begin() == b.end());
+
+        b.push_back(20);
+        b.push_back(21);
+        a.splice_after(a.end(), b);
+        a.push_back(22);
+        printTest("splice_after(end()) agrega al final y actualiza back()",
+                  iterValues(a) == vector<int>({0, 10, 11, 12, 1, 2, 20, 21, 22}) && a.size() == 9);
+
+        List<int> empty;
+        empty.splice_after(empty.end(), a);
+        empty.push_back(23);
+        printTest("splice_after sobre una lista vacía", empty.size() == 10 && empty.front() == 0 && empty.back() == 23 &&
+                                                            a.empty());
+        empty.splice_after(empty.begin(), empty);
+        printTest("splice_after de sí misma no hace nada", empty.size() == 10);
+    }
+
+    {
+        List<string, PoolAllocator<string, 8>> a;
+        List<string, PoolAllocator<string, 8>> b;
+        a.push_back("a0");
+        a.push_back("a1");
+        for (int i = 0; i < 20; i++)
+            b.push_back("b" + to_string(i));
+        a.splice_after(a.begin(), b);
+        bool ok = a.size() == 22 && a.at(0) == "a0" && a.at(1) == "b0" && a.at(20) == "b19" && a.back() == "a1";
+        printTest("Con pools distintos se copian los elementos y other queda vacía", ok && b.empty());
+        b.push_back("reuse");
+        a.splice_after(a.end(), b);
+        a.push_back("end");
+        printTest("Ambas listas siguen usables (sin fugas con ASan)", a.size() == 24 && a.at(22) == "reuse" &&
+                                                                          a.back() == "end" && b.empty());
+    }
+
+    {
+        PoolAllocator<string, 8> pool;
+        List<string, PoolAllocator<string, 8>> a(pool);
+        List<string, PoolAllocator<string, 8>> b(pool);
+        for (int i = 0; i < 3; i++)
+            a.push_back("a" + to_string(i));
+        for (int i = 0; i < 20; i++)
+            b.push_back("b" + to_string(i));
+        string *addr = &b.front();
+        a.splice_after(a.begin(), b);
+        printTest("Listas creadas con el mismo PoolAllocator re-enlazan los nodos (misma dirección)",
+                  a.size() == 23 && &a.at(1) == addr && a.at(20) == "b19" && a.back() == "a2" && b.empty());
+
+        // b comparte la arena: su clear() no puede soltarla entera
+        for (int i = 0; i < 10; i++)
+            b.push_back("c" + to_string(i));
+        b.clear();
+        a.push_back("end");
+        printTest("clear() de una lista que comparte el pool no toca los nodos de la otra",
+                  a.size() == 24 && a.at(1) == "b0" && a.at(21) == "a1" && a.back() == "end");
+    }
+
+    cout << "\n" << (failures == 0 ? "Todas las pruebas pasaron" : "Hay pruebas que fallaron") << endl;
+    return failures == 0 ? 0 : 1;
+}
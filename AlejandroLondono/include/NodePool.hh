@@ -0,0 +1,273 @@
+#ifndef NODE_POOL_HH
+#define NODE_POOL_HH
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+/**
+ * @brief Fixed-size block arena used by PoolAllocator.
+ *
+ * Memory is requested from the global allocator in chunks of
+ * `blocksPerChunk` blocks. Blocks are handed out with a bump pointer and
+ * recycled through an intrusive free list, so allocating N blocks costs
+ * O(N / blocksPerChunk) calls to the global allocator.
+ */
+class NodeArena
+{
+private:
+  /**
+   * @brief Header placed at the beginning of every chunk.
+   */
+  struct Chunk
+  {
+    Chunk *next; ///< Next chunk in the chain.
+  };
+
+  /**
+   * @brief A free block reuses its own storage as a list link.
+   */
+  struct FreeBlock
+  {
+    FreeBlock *next; ///< Next free block.
+  };
+
+  std::size_t blockSize;      ///< Size in bytes of each block.
+  std::size_t blocksPerChunk; ///< Number of blocks in every chunk.
+  Chunk *chunks;              ///< First chunk ever allocated.
+  Chunk *current;             ///< Chunk the bump pointer is working on.
+  std::size_t used;           ///< Blocks already handed out from `current`.
+  FreeBlock *freeList;        ///< Blocks returned by deallocate().
+
+  /**
+   * @brief Offset of the first block inside a chunk, keeping max alignment.
+   */
+  static std::size_t headerSize()
+  {
+    std::size_t a = alignof(std::max_align_t);
+    return (sizeof(Chunk) + a - 1) / a * a;
+  }
+
+  char *blockAt(Chunk *chunk, std::size_t i) const
+  {
+    return reinterpret_cast<char *>(chunk) + headerSize() + i * blockSize;
+  }
+
+public:
+  /**
+   * @brief Constructor.
+   * @param size Size in bytes of every block.
+   * @param perChunk Number of blocks requested from the system at once.
+   * @throws std::invalid_argument if perChunk is 0.
+   */
+  NodeArena(std::size_t size, std::size_t perChunk)
+      : blockSize(size), blocksPerChunk(perChunk), chunks(nullptr), current(nullptr), used(0), freeList(nullptr)
+  {
+    if (perChunk == 0)
+      throw std::invalid_argument("Chunk size must be greater than 0");
+
+    std::size_t a = alignof(std::max_align_t);
+    if (blockSize < sizeof(FreeBlock))
+      blockSize = sizeof(FreeBlock);
+    blockSize = (blockSize + a - 1) / a * a;
+  }
+
+  NodeArena(const NodeArena &) = delete;
+  NodeArena &operator=(const NodeArena &) = delete;
+
+  /**
+   * @brief Destructor. Returns every chunk to the system.
+   */
+  ~NodeArena()
+  {
+    while (chunks != nullptr)
+    {
+      Chunk *temp = chunks->next;
+      ::operator delete(chunks);
+      chunks = temp;
+    }
+  }
+
+  /**
+   * @brief Get one block of memory.
+   * @return Pointer to an uninitialized block of `blockSize` bytes.
+   */
+  void *allocate()
+  {
+    if (freeList != nullptr)
+    {
+      FreeBlock *block = freeList;
+      freeList = block->next;
+      return block;
+    }
+
+    if (current == nullptr || used == blocksPerChunk)
+    {
+      if (current != nullptr && current->next != nullptr)
+      {
+        // Reusar un chunk que quedó libre después de release()
+        current = current->next;
+      }
+      else
+      {
+        Chunk *chunk = static_cast<Chunk *>(::operator new(headerSize() + blockSize * blocksPerChunk));
+        chunk->next = nullptr;
+        if (current == nullptr)
+          chunks = chunk;
+        else
+          current->next = chunk;
+        current = chunk;
+      }
+      used = 0;
+    }
+
+    return blockAt(current, used++);
+  }
+
+  /**
+   * @brief Give a block back to the arena.
+   * @param p Pointer previously returned by allocate().
+   */
+  void deallocate(void *p)
+  {
+    FreeBlock *block = static_cast<FreeBlock *>(p);
+    block->next = freeList;
+    freeList = block;
+  }
+
+  /**
+   * @brief Mark every block as free at once.
+   *
+   * Chunks are kept for reuse, so refilling the arena does not touch the
+   * global allocator again.
+   *
+   * @warning Objects living in the arena are not destroyed.
+   */
+  void release()
+  {
+    freeList = nullptr;
+    current = chunks;
+    used = 0;
+  }
+};
+
+/**
+ * @brief The arenas of one PoolAllocator and all its copies and rebinds.
+ *
+ * There is one NodeArena per block size. Each arena is created the first
+ * time an allocator of that size asks for it.
+ */
+class ArenaStore
+{
+private:
+  std::size_t blocksPerChunk;                                 ///< Blocks per chunk of every arena.
+  std::map<std::size_t, std::unique_ptr<NodeArena>> arenas;   ///< Arenas indexed by block size.
+
+public:
+  /**
+   * @brief Constructor.
+   * @param perChunk Number of blocks per chunk of every arena.
+   * @throws std::invalid_argument if perChunk is 0.
+   */
+  explicit ArenaStore(std::size_t perChunk) : blocksPerChunk(perChunk)
+  {
+    if (perChunk == 0)
+      throw std::invalid_argument("Chunk size must be greater than 0");
+  }
+
+  ArenaStore(const ArenaStore &) = delete;
+  ArenaStore &operator=(const ArenaStore &) = delete;
+
+  /**
+   * @brief Get the arena for blocks of a given size, creating it if needed.
+   * @param size Size in bytes of every block.
+   * @return Arena that lives as long as the store.
+   */
+  NodeArena &arenaFor(std::size_t size)
+  {
+    std::unique_ptr<NodeArena> &arena = arenas[size];
+    if (!arena)
+      arena.reset(new NodeArena(size, blocksPerChunk));
+    return *arena;
+  }
+};
+
+/**
+ * @brief Standard-compatible allocator that serves objects from a NodeArena.
+ *
+ * Meant for node-based containers. Copies and rebinds share one ArenaStore,
+ * so `A(B(a)) == a` holds, and each object size gets its own arena. All the
+ * nodes of a container live in a few contiguous chunks and can be dropped
+ * together with release().
+ *
+ * @tparam T Type of objects allocated.
+ * @tparam ChunkSize Number of objects requested from the system at once.
+ */
+template <typename T, std::size_t ChunkSize = 1024>
+class PoolAllocator
+{
+private:
+  std::shared_ptr<ArenaStore> store; ///< Arenas shared by copies and rebinds of this allocator.
+  NodeArena *arena;                  ///< Arena of the store for blocks of sizeof(T).
+
+  template <typename U, std::size_t C>
+  friend class PoolAllocator;
+
+public:
+  typedef T value_type;
+
+  template <typename U>
+  struct rebind
+  {
+    typedef PoolAllocator<U, ChunkSize> other;
+  };
+
+  /**
+   * @brief Default constructor. Creates a fresh arena store.
+   */
+  PoolAllocator() : store(std::make_shared<ArenaStore>(ChunkSize)), arena(&store->arenaFor(sizeof(T))) {}
+
+  /**
+   * @brief Copy constructor. Shares the arenas of other.
+   */
+  PoolAllocator(const PoolAllocator &other) = default;
+
+  /**
+   * @brief Rebind constructor. Shares the store of other and uses its arena for sizeof(T).
+   */
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U, ChunkSize> &other) : store(other.store), arena(&store->arenaFor(sizeof(T))) {}
+
+  T *allocate(std::size_t n)
+  {
+    if (n != 1)
+      return static_cast<T *>(::operator new(n * sizeof(T)));
+    return static_cast<T *>(arena->allocate());
+  }
+
+  void deallocate(T *p, std::size_t n)
+  {
+    if (n != 1)
+    {
+      ::operator delete(p);
+      return;
+    }
+    arena->deallocate(p);
+  }
+
+  /**
+   * @brief Drop every object of the arena for sizeof(T) at once.
+   * @warning Objects are not destroyed; the owner must do it first if needed.
+   * @warning Every allocator sharing the store loses its blocks of this size.
+   */
+  void release() { arena->release(); }
+
+  template <typename U>
+  bool operator==(const PoolAllocator<U, ChunkSize> &other) const { return store == other.store; }
+  template <typename U>
+  bool operator!=(const PoolAllocator<U, ChunkSize> &other) const { return store != other.store; }
+};
+
+#endif // NODE_POOL_HH
@@ -0,0 +1,706 @@
+#ifndef UNROLLED_LIST_HH
+#define UNROLLED_LIST_HH
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+using namespace std;
+
+/**
+ * @brief An unrolled linked list with the same interface as List<T>.
+ *
+ * Each node stores up to `BlockSize` elements in an inline array, so a
+ * traversal touches one node (and usually one or two cache lines) for
+ * several elements instead of chasing a pointer per element. Nodes are
+ * doubly linked, which keeps push/pop at both ends O(1) and lets indexed
+ * access start from the closer end.
+ *
+ * Invariant: every node holds at least one element.
+ *
+ * @tparam T Type of elements stored in the list.
+ * @tparam BlockSize Maximum number of elements per node.
+ */
+template <typename T, unsigned int BlockSize = 16>
+class UnrolledList
+{
+  static_assert(BlockSize >= 2, "BlockSize must be at least 2");
+
+private:
+  /**
+   * @brief Node class holding a block of elements.
+   *
+   * Only the slots [0, count) are constructed.
+   */
+  class Node
+  {
+  private:
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type slots[BlockSize]; ///< Raw storage for the elements.
+
+  public:
+    unsigned int count; ///< Number of constructed elements in the block.
+    Node *next;         ///< Pointer to the next node.
+    Node *prev;         ///< Pointer to the previous node.
+
+    /**
+     * @brief Default constructor. Creates an empty block.
+     */
+    Node() : count(0), next(nullptr), prev(nullptr) {}
+
+    /**
+     * @brief Get the element at a slot of the block.
+     * @param i Slot index (must be < count, or == count when constructing).
+     * @return Pointer to the slot.
+     */
+    T *item(unsigned int i) { return reinterpret_cast<T *>(&slots[i]); }
+
+    const T *item(unsigned int i) const { return reinterpret_cast<const T *>(&slots[i]); }
+
+    bool full() const { return count == BlockSize; }
+  };
+
+  Node *first;     ///< Pointer to the first node in the list.
+  Node *last;      ///< Pointer to the last node in the list.
+  unsigned int sz; ///< Number of elements in the list.
+
+  // ==================== MANEJO DE BLOQUES ====================
+
+  /**
+   * @brief Insert a value in a block that still has room, shifting the tail right.
+   * @param node Block with count < BlockSize.
+   * @param off Position inside the block (0..count).
+   * @param val Value to insert.
+   */
+  static void insertInBlock(Node *node, unsigned int off, const T &val)
+  {
+    if (off == node->count)
+    {
+      ::new (static_cast<void *>(node->item(off))) T(val);
+    }
+    else
+    {
+      T temp(val); // val puede ser un elemento de este mismo bloque
+      ::new (static_cast<void *>(node->item(node->count))) T(std::move(*node->item(node->count - 1)));
+      for (unsigned int i = node->count - 1; i > off; i--)
+      {
+        *node->item(i) = std::move(*node->item(i - 1));
+      }
+      *node->item(off) = std::move(temp);
+    }
+    node->count++;
+  }
+
+  /**
+   * @brief Remove the value at a position of a block, shifting the tail left.
+   * @param node Block.
+   * @param off Position inside the block (0..count-1).
+   */
+  static void removeFromBlock(Node *node, unsigned int off)
+  {
+    for (unsigned int i = off; i + 1 < node->count; i++)
+    {
+      *node->item(i) = std::move(*node->item(i + 1));
+    }
+    node->item(node->count - 1)->~T();
+    node->count--;
+  }
+
+  /**
+   * @brief Move the elements [from, count) of src to the end of dst.
+   * @param src Source block.
+   * @param from First slot of src to move.
+   * @param dst Destination block with enough room.
+   */
+  static void moveTail(Node *src, unsigned int from, Node *dst)
+  {
+    for (unsigned int i = from; i < src->count; i++)
+    {
+      ::new (static_cast<void *>(dst->item(dst->count))) T(std::move(*src->item(i)));
+      dst->count++;
+      src->item(i)->~T();
+    }
+    src->count = from;
+  }
+
+  /**
+   * @brief Create an empty block and link it after `node` (or at the front if node is nullptr).
+   * @param node Block that will precede the new one.
+   * @return Pointer to the new block.
+   */
+  Node *linkAfter(Node *node)
+  {
+    Node *newNode = new Node();
+    Node *nextNode = (node == nullptr) ? first : node->next;
+    newNode->prev = node;
+    newNode->next = nextNode;
+    if (node != nullptr)
+      node->next = newNode;
+    else
+      first = newNode;
+    if (nextNode != nullptr)
+      nextNode->prev = newNode;
+    else
+      last = newNode;
+    return newNode;
+  }
+
+  /**
+   * @brief Unlink and free a block that holds no elements.
+   * @param node Empty block.
+   */
+  void unlink(Node *node)
+  {
+    if (node->prev != nullptr)
+      node->prev->next = node->next;
+    else
+      first = node->next;
+    if (node->next != nullptr)
+      node->next->prev = node->prev;
+    else
+      last = node->prev;
+    delete node;
+  }
+
+  /**
+   * @brief Free all blocks and their elements.
+   */
+  void freeNodes()
+  {
+    Node *node = first;
+    while (node != nullptr)
+    {
+      Node *temp = node->next;
+      for (unsigned int i = 0; i < node->count; i++)
+        node->item(i)->~T();
+      delete node;
+      node = temp;
+    }
+  }
+
+  /**
+   * @brief Find the block and slot of an element, walking from the closer end.
+   * @param index Index of the element (must be < sz).
+   * @param off Set to the slot of the element inside the returned block.
+   * @return Block that holds the element.
+   */
+  Node *locate(unsigned int index, unsigned int &off) const
+  {
+    Node *node;
+    if (index < sz / 2)
+    {
+      node = first;
+      while (index >= node->count)
+      {
+        index -= node->count;
+        node = node->next;
+      }
+      off = index;
+    }
+    else
+    {
+      unsigned int fromEnd = sz - 1 - index;
+      node = last;
+      while (fromEnd >= node->count)
+      {
+        fromEnd -= node->count;
+        node = node->prev;
+      }
+      off = node->count - 1 - fromEnd;
+    }
+    return node;
+  }
+
+public:
+  /**
+   * @brief Forward iterator over the elements of the list.
+   * @tparam IsConst true for const_iterator, false for iterator.
+   */
+  template <bool IsConst>
+  class Iterator
+  {
+  private:
+    Node *node;       ///< Current block (nullptr for end()).
+    unsigned int off; ///< Slot inside the current block.
+
+    Iterator(Node *n, unsigned int o) : node(n), off(o) {}
+
+    friend class UnrolledList;
+    friend class Iterator<!IsConst>;
+
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef typename std::conditional<IsConst, const T *, T *>::type pointer;
+    typedef typename std::conditional<IsConst, const T &, T &>::type reference;
+
+    /**
+     * @brief Default constructor. Creates a singular iterator.
+     */
+    Iterator() : node(nullptr), off(0) {}
+
+    /**
+     * @brief Conversion from iterator to const_iterator.
+     * @param other Iterator to convert.
+     */
+    template <bool WasConst, typename = typename std::enable_if<IsConst && !WasConst>::type>
+    Iterator(const Iterator<WasConst> &other) : node(other.node), off(other.off) {}
+
+    reference operator*() const { return *node->item(off); }
+    pointer operator->() const { return node->item(off); }
+
+    /**
+     * @brief Advance to the next element (prefix).
+     * @return Reference to this iterator.
+     */
+    Iterator &operator++()
+    {
+      if (++off == node->count)
+      {
+        node = node->next;
+        off = 0;
+      }
+      return *this;
+    }
+
+    /**
+     * @brief Advance to the next element (postfix).
+     * @return Copy of the iterator before advancing.
+     */
+    Iterator operator++(int)
+    {
+      Iterator temp = *this;
+      ++(*this);
+      return temp;
+    }
+
+    bool operator==(const Iterator &other) const { return node == other.node && off == other.off; }
+    bool operator!=(const Iterator &other) const { return !(*this == other); }
+  };
+
+  typedef Iterator<false> iterator;
+  typedef Iterator<true> const_iterator;
+
+  /**
+   * @brief Default constructor. Initializes an empty list.
+   */
+  UnrolledList() : first(nullptr), last(nullptr), sz(0) {}
+
+  /**
+   * @brief Copy constructor. Creates a deep copy of another list.
+   * @param other List to copy.
+   */
+  UnrolledList(const UnrolledList &other) : first(nullptr), last(nullptr), sz(0)
+  {
+    push_back(other);
+  }
+
+  /**
+   * @brief Destructor. Deletes all nodes in the list.
+   */
+  ~UnrolledList()
+  {
+    freeNodes();
+  }
+
+  /**
+   * @brief Assignment operator. Replaces the contents with a copy of other.
+   * @param other List to copy.
+   * @return Reference to this list.
+   */
+  UnrolledList &operator=(const UnrolledList &other)
+  {
+    if (this != &other)
+    {
+      clear();
+      push_back(other);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Check if the list is empty.
+   * @return true if the list is empty, false otherwise.
+   */
+  bool empty() const { return sz == 0; }
+
+  /**
+   * @brief Get the number of elements in the list.
+   * @return The size of the list.
+   */
+  unsigned int size() const { return sz; }
+
+  /**
+   * @brief Get the number of blocks currently allocated.
+   * @return The number of nodes in the list.
+   */
+  unsigned int blockCount() const
+  {
+    unsigned int blocks = 0;
+    for (Node *node = first; node != nullptr; node = node->next)
+      blocks++;
+    return blocks;
+  }
+
+  /**
+   * @brief Add an element to the end of the list.
+   * @param val Value to add.
+   */
+  void push_back(const T &val)
+  {
+    if (last == nullptr || last->full())
+    {
+      Node *newNode = linkAfter(last);
+      try
+      {
+        insertInBlock(newNode, 0, val);
+      }
+      catch (...)
+      {
+        unlink(newNode);
+        throw;
+      }
+    }
+    else
+    {
+      insertInBlock(last, last->count, val);
+    }
+    sz++;
+  }
+
+  /**
+   * @brief Add an element to the beginning of the list.
+   * @param val Value to add.
+   */
+  void push_front(const T &val)
+  {
+    if (first == nullptr || first->full())
+    {
+      Node *newNode = linkAfter(nullptr);
+      try
+      {
+        insertInBlock(newNode, 0, val);
+      }
+      catch (...)
+      {
+        unlink(newNode);
+        throw;
+      }
+    }
+    else
+    {
+      insertInBlock(first, 0, val);
+    }
+    sz++;
+  }
+
+  /**
+   * @brief Remove the last element from the list.
+   *
+   * @note If the list is empty, this function does nothing.
+   */
+  void pop_back()
+  {
+    if (empty())
+      return;
+
+    removeFromBlock(last, last->count - 1);
+    if (last->count == 0)
+      unlink(last);
+    sz--;
+  }
+
+  /**
+   * @brief Remove the first element from the list.
+   *
+   * @note If the list is empty, this function does nothing.
+   */
+  void pop_front()
+  {
+    if (empty())
+      return;
+
+    removeFromBlock(first, 0);
+    if (first->count == 0)
+      unlink(first);
+    sz--;
+  }
+
+  /**
+   * @brief Get the first element in the list.
+   * @return Reference to the first element.
+   * @throws std::out_of_range if the list is empty.
+   */
+  T &front()
+  {
+    if (empty())
+      throw std::out_of_range("List is empty");
+    return *first->item(0);
+  }
+
+  /**
+   * @brief Get the first element in the list (const version).
+   * @return Const reference to the first element.
+   * @throws std::out_of_range if the list is empty.
+   */
+  const T &front() const
+  {
+    if (empty())
+      throw std::out_of_range("List is empty");
+    return *first->item(0);
+  }
+
+  /**
+   * @brief Get the last element in the list.
+   * @return Reference to the last element.
+   * @throws std::out_of_range if the list is empty.
+   */
+  T &back()
+  {
+    if (empty())
+      throw std::out_of_range("list is empty");
+    return *last->item(last->count - 1);
+  }
+
+  /**
+   * @brief Get the last element in the list (const version).
+   * @return Const reference to the last element.
+   * @throws std::out_of_range if the list is empty.
+   */
+  const T &back() const
+  {
+    if (empty())
+      throw std::out_of_range("list is empty");
+    return *last->item(last->count - 1);
+  }
+
+  /**
+   * @brief Remove all elements from the list.
+   */
+  void clear()
+  {
+    freeNodes();
+    first = last = nullptr;
+    sz = 0;
+  }
+
+  /**
+   * @brief Get the element at a specific index.
+   * @param index Index of the element to retrieve.
+   * @return Reference to the element at the specified index.
+   * @throws std::out_of_range if the index is out of bounds.
+   */
+  T &at(unsigned int index)
+  {
+    if (index >= sz)
+      throw out_of_range("Index out of range");
+    unsigned int off;
+    Node *node = locate(index, off);
+    return *node->item(off);
+  }
+
+  /**
+   * @brief Get the element at a specific index (const version).
+   * @param index Index of the element to retrieve.
+   * @return Const reference to the element at the specified index.
+   * @throws std::out_of_range if the index is out of bounds.
+   */
+  const T &at(unsigned int index) const
+  {
+    if (index >= sz)
+      throw out_of_range("Index out of range");
+    unsigned int off;
+    Node *node = locate(index, off);
+    return *node->item(off);
+  }
+
+  /**
+   * @brief Access an element using the subscript operator.
+   * @param index Index of the element to access.
+   * @return Reference to the element at the specified index.
+   */
+  T &operator[](unsigned int index) { return at(index); }
+
+  /**
+   * @brief Access an element using the subscript operator (const version).
+   * @param index Index of the element to access.
+   * @return Const reference to the element at the specified index.
+   */
+  const T &operator[](unsigned int index) const { return at(index); }
+
+  /**
+   * @brief Insert an element at a specific index.
+   *
+   * If the target block is full it is split in two halves first, so the
+   * cost is O(n / BlockSize) to find the block plus O(BlockSize) to shift.
+   *
+   * @param index Index where the element will be inserted.
+   * @param val Value to insert.
+   * @throws std::out_of_range if the index is out of bounds.
+   */
+  void insert(unsigned int index, const T &val)
+  {
+    if (index > sz)
+      throw out_of_range("Index out of range");
+
+    if (index == sz)
+    {
+      push_back(val);
+      return;
+    }
+
+    unsigned int off;
+    Node *node = locate(index, off);
+
+    if (node->full())
+    {
+      T temp(val); // val puede vivir en la mitad que se va a mover
+      Node *newNode = linkAfter(node);
+      moveTail(node, BlockSize / 2, newNode);
+      if (off > node->count)
+      {
+        off -= node->count;
+        node = newNode;
+      }
+      insertInBlock(node, off, temp);
+    }
+    else
+    {
+      insertInBlock(node, off, val);
+    }
+    sz++;
+  }
+
+  /**
+   * @brief Remove an element at a specific index.
+   *
+   * A block that falls below half capacity is merged with the next one when
+   * both fit in a single block, so blocks stay reasonably full.
+   *
+   * @param index Index of the element to remove.
+   * @throws std::out_of_range if the index is out of bounds.
+   */
+  void erase(unsigned int index)
+  {
+    if (index >= sz)
+      throw out_of_range("index out of range");
+
+    unsigned int off;
+    Node *node = locate(index, off);
+    removeFromBlock(node, off);
+    sz--;
+
+    if (node->count == 0)
+    {
+      unlink(node);
+    }
+    else if (node->count < BlockSize / 2 && node->next != nullptr &&
+             node->count + node->next->count <= BlockSize)
+    {
+      Node *nextNode = node->next;
+      moveTail(nextNode, 0, node);
+      unlink(nextNode);
+    }
+  }
+
+  /**
+   * @brief Reverse the order of elements in the list.
+   *
+   * Reverses the order of the blocks and the elements inside each block.
+   */
+  void reverse()
+  {
+    Node *node = first;
+    while (node != nullptr)
+    {
+      for (unsigned int i = 0, j = node->count - 1; i < j; i++, j--)
+      {
+        std::swap(*node->item(i), *node->item(j));
+      }
+      std::swap(node->next, node->prev);
+      node = node->prev; // después del swap, prev apunta al que era el siguiente
+    }
+    std::swap(first, last);
+  }
+
+  /**
+   * @brief Append the elements of another list to the end of this list.
+   * @param other List whose elements will be appended.
+   */
+  void push_back(const UnrolledList &other)
+  {
+    if (this == &other)
+    {
+      UnrolledList copy(other);
+      push_back(copy);
+      return;
+    }
+    for (const T &val : other)
+    {
+      push_back(val);
+    }
+  }
+
+  /**
+   * @brief Prepend the elements of another list to the beginning of this list.
+   * @param other List whose elements will be prepended.
+   */
+  void push_front(const UnrolledList &other)
+  {
+    if (other.empty())
+      return;
+
+    UnrolledList copy(other);
+    copy.push_back(*this);
+    std::swap(first, copy.first);
+    std::swap(last, copy.last);
+    std::swap(sz, copy.sz);
+  }
+
+  /**
+   * @brief Check if two lists are equal.
+   * @param other List to compare with.
+   * @return true if lists are equal, false otherwise.
+   */
+  bool operator==(const UnrolledList &other) const
+  {
+    if (sz != other.sz)
+      return false;
+
+    const_iterator a = begin();
+    const_iterator b = other.begin();
+    for (; a != end(); ++a, ++b)
+    {
+      if (*a != *b)
+        return false;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Print the elements of the list.
+   */
+  void print() const
+  {
+    for (const T &val : *this)
+    {
+      cout << val << " ";
+    }
+    cout << endl;
+  }
+
+  // ==================== ITERADORES ====================
+
+  iterator begin() { return iterator(first, 0); }
+  iterator end() { return iterator(nullptr, 0); }
+  const_iterator begin() const { return const_iterator(first, 0); }
+  const_iterator end() const { return const_iterator(nullptr, 0); }
+  const_iterator cbegin() const { return const_iterator(first, 0); }
+  const_iterator cend() const { return const_iterator(nullptr, 0); }
+};
+
+#endif // UNROLLED_LIST_HH
@@ -0,0 +1,262 @@
+/**
+ * @file UnrolledListTest.cpp
+ * @brief Pruebas para UnrolledList (include/UnrolledList.hh): división y fusión de bloques
+ *
+ * Compilar, por ejemplo:
+ *   g++ -std=c++17 -fsanitize=address,undefined UnrolledListTest.cpp -o UnrolledListTest
+ */
+
+#include "UnrolledList.hh"
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+int failures = 0;
+
+void printHeader(const string &title)
+{
+    cout << "\n" << string(70, '=') << endl;
+    cout << "  " << title << endl;
+    cout << string(70, '=') << endl;
+}
+
+void printTest(const string &test, bool passed)
+{
+    if (!passed)
+        failures++;
+    cout << "[" << (passed ? "✓ PASS" : "✗ FAIL") << "] " << test << endl;
+}
+
+/**
+ * @brief Cuenta los objetos vivos: mover elementos entre bloques no debe perder ni duplicar ninguno
+ */
+struct Counted
+{
+    static int live;
+    int value;
+
+    Counted(int v) : value(v) { live++; }
+    Counted(const Counted &other) : value(other.value) { live++; }
+    Counted(Counted &&other) noexcept : value(other.value) { live++; }
+    Counted &operator=(const Counted &other) = default;
+    Counted &operator=(Counted &&other) = default;
+    ~Counted() { live--; }
+    bool operator==(const Counted &other) const { return value == other.value; }
+    bool operator!=(const Counted &other) const { return value != other.value; }
+};
+
+int Counted::live = 0;
+
+/**
+ * @brief Compara la lista con el modelo por índice y con iteradores, y revisa el número de bloques
+ */
+template <typename T, unsigned int B>
+bool sameAs(const UnrolledList<T, B> &list, const vector<T> &model)
+{
+    if (list.size() != model.size() || list.empty() != model.empty())
+        return false;
+    for (unsigned int i = 0; i < model.size(); i++)
+        if (list.at(i) != model[i])
+            return false;
+    if (!std::equal(list.begin(), list.end(), model.begin()))
+        return false;
+    // Cada bloque tiene entre 1 y B elementos
+    unsigned int blocks = list.blockCount();
+    return blocks >= (model.size() + B - 1) / B && blocks <= model.size();
+}
+
+/**
+ * @brief Operaciones al azar contra std::vector; devuelve false en la primera diferencia
+ */
+template <unsigned int B>
+bool randomOps(unsigned int seed, int steps)
+{
+    mt19937 rng(seed);
+    UnrolledList<Counted, B> list;
+    vector<Counted> model;
+    for (int step = 0; step < steps; step++)
+    {
+        unsigned int op = rng() % 10;
+        // Sesgo hacia insertar al principio y hacia borrar después, para pasar por bloques llenos y casi vacíos
+        bool grow = (step / 500) % 2 == 0;
+        if (model.empty() || op < (grow ? 6u : 3u))
+        {
+            unsigned int index = rng() % (model.size() + 1);
+            list.insert(index, Counted(step));
+            model.insert(model.begin() + index, Counted(step));
+        }
+        else if (op < 8)
+        {
+            unsigned int index = rng() % model.size();
+            list.erase(index);
+            model.erase(model.begin() + index);
+        }
+        else if (op == 8)
+        {
+            list.pop_front();
+            model.erase(model.begin());
+        }
+        else
+        {
+            list.reverse();
+            std::reverse(model.begin(), model.end());
+        }
+        if (step % 100 == 0 && !sameAs(list, model))
+            return false;
+    }
+    return sameAs(list, model) && Counted::live == static_cast<int>(2 * model.size());
+}
+
+int main()
+{
+    cout << "\n╔══════════════════════════════════════════════════════════════════╗\n";
+    cout << "║                   PRUEBAS DE UNROLLEDLIST                        ║\n";
+    cout << "╚══════════════════════════════════════════════════════════════════╝\n";
+
+    // ==================== PRUEBA 1: división de bloques ====================
+    printHeader("PRUEBA 1: insert en un bloque lleno lo divide a la mitad");
+
+    {
+        UnrolledList<int, 4> list;
+        vector<int> model;
+        for (int i = 0; i < 8; i++)
+        {
+            list.push_back(i);
+            model.push_back(i);
+        }
+        printTest("8 elementos en 2 bloques llenos", sameAs(list, model) && list.blockCount() == 2);
+
+        list.insert(1, 100); // en la primera mitad del bloque que se divide
+        model.insert(model.begin() + 1, 100);
+        printTest("Insertar en la mitad izquierda divide el bloque", sameAs(list, model) && list.blockCount() == 3);
+
+        list.insert(8, 200); // en la segunda mitad del último bloque (lleno)
+        model.insert(model.begin() + 8, 200);
+        printTest("Insertar en la mitad derecha divide el bloque", sameAs(list, model) && list.blockCount() == 4);
+
+        list.insert(list.size(), 300);
+        list.push_front(-1);
+        model.push_back(300);
+        model.insert(model.begin(), -1);
+        printTest("push_back / push_front después de dividir", sameAs(list, model));
+
+        UnrolledList<int, 4> same;
+        for (int i = 0; i < 4; i++)
+            same.push_back(i);
+        same.insert(2, same.at(3)); // el valor vive en la mitad que se mueve
+        printTest("insert(i, list.at(j)) cuando j está en la mitad que se mueve",
+                  same.size() == 5 && same.at(2) == 3 && same.at(4) == 3);
+    }
+
+    // ==================== PRUEBA 2: fusión de bloques ====================
+    printHeader("PRUEBA 2: erase fusiona un bloque con menos de la mitad con el siguiente");
+
+    {
+        UnrolledList<int, 4> list;
+        vector<int> model;
+        for (int i = 0; i < 12; i++)
+        {
+            list.push_back(i);
+            model.push_back(i);
+        }
+        printTest("12 elementos en 3 bloques", list.blockCount() == 3);
+
+        // Bloques: [0 1 2 3] [4 5 6 7] [8 9 10 11]
+        list.erase(8);
+        list.erase(8);
+        model.erase(model.begin() + 8, model.begin() + 10);
+        printTest("El último bloque queda con 2 elementos sin fusionarse", sameAs(list, model) && list.blockCount() == 3);
+
+        list.erase(4);
+        list.erase(4);
+        model.erase(model.begin() + 4, model.begin() + 6);
+        printTest("Un bloque con la mitad justa no se fusiona", sameAs(list, model) && list.blockCount() == 3);
+
+        list.erase(4);
+        model.erase(model.begin() + 4);
+        printTest("Con 1 + 2 <= 4 elementos los bloques se fusionan", sameAs(list, model) && list.blockCount() == 2);
+
+        UnrolledList<int, 4> full;
+        for (int i = 0; i < 8; i++)
+            full.push_back(i);
+        full.erase(0);
+        full.erase(0);
+        full.erase(0);
+        printTest("No se fusiona si no caben en un bloque (1 + 4 > 4)", full.blockCount() == 2 && full.front() == 3);
+
+        full.erase(0);
+        printTest("Un bloque que queda vacío se desenlaza", full.blockCount() == 1 && full.front() == 4 && full.size() == 4);
+        while (!full.empty())
+            full.erase(full.size() - 1);
+        printTest("Borrar todo deja 0 bloques", full.blockCount() == 0);
+        full.push_back(9);
+        printTest("La lista vacía se puede volver a usar", full.size() == 1 && full.front() == 9 && full.back() == 9);
+    }
+
+    // ==================== PRUEBA 3: reverse con varios bloques ====================
+    printHeader("PRUEBA 3: reverse invierte los bloques y el contenido de cada uno");
+
+    {
+        UnrolledList<int, 4> list;
+        vector<int> model;
+        for (int i = 0; i < 10; i++)
+        {
+            list.insert(i / 2, i);
+            model.insert(model.begin() + i / 2, i);
+        }
+        list.reverse();
+        std::reverse(model.begin(), model.end());
+        printTest("reverse sobre bloques a medio llenar", sameAs(list, model));
+        list.insert(3, 50);
+        list.erase(0);
+        model.insert(model.begin() + 3, 50);
+        model.erase(model.begin());
+        printTest("insert / erase después de reverse", sameAs(list, model));
+    }
+
+    // ==================== PRUEBA 4: operaciones al azar ====================
+    printHeader("PRUEBA 4: Operaciones al azar contra std::vector");
+
+    {
+        bool ok = true;
+        for (unsigned int seed = 1; seed <= 10 && ok; seed++)
+            ok = randomOps<2>(seed, 3000);
+        printTest("BlockSize = 2: 10 secuencias de 3000 operaciones", ok);
+        ok = true;
+        for (unsigned int seed = 1; seed <= 10 && ok; seed++)
+            ok = randomOps<4>(seed, 3000);
+        printTest("BlockSize = 4: 10 secuencias de 3000 operaciones", ok);
+        ok = true;
+        for (unsigned int seed = 1; seed <= 5 && ok; seed++)
+            ok = randomOps<16>(seed, 3000);
+        printTest("BlockSize = 16: 5 secuencias de 3000 operaciones", ok);
+        printTest("Cada elemento movido entre bloques se destruyó una sola vez", Counted::live == 0);
+    }
+
+    {
+        UnrolledList<string, 4> words;
+        vector<string> model;
+        for (int i = 0; i < 40; i++)
+        {
+            string w(30, static_cast<char>('a' + i % 26));
+            words.insert(i / 3, w);
+            model.insert(model.begin() + i / 3, w);
+        }
+        for (int i = 0; i < 25; i++)
+        {
+            words.erase((i * 7) % words.size());
+            model.erase(model.begin() + (i * 7) % model.size());
+        }
+        UnrolledList<string, 4> copy(words);
+        words.clear();
+        printTest("Strings: división, fusión, copia y clear (sin fugas con ASan)", sameAs(copy, model) && words.empty());
+    }
+
+    cout << "\n" << (failures == 0 ? "Todas las pruebas pasaron" : "Hay pruebas que fallaron") << endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -1,14 +1,19 @@
 #ifndef VECTOR_HH
 #define VECTOR_HH
 
+#include <cstring>
+#include <initializer_list>
 #include <iostream>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 template <typename T>
 class Vector
 {
 private:
-    // Stores the elements of the vector
+    // Stores the elements of the vector (raw memory, only [0, sz) is constructed)
     T *storage;
     // Current number of elements in the vector
     unsigned int sz;
@@ -17,13 +22,111 @@ private:
     // Policy for resizing the vector
     double policy;
 
+    // --- Manejo de memoria cruda ---------------------------------------
+
+    // Reserva espacio para c elementos sin construir ninguno
+    static T *allocate(unsigned int c)
+    {
+        if (c == 0)
+            return nullptr;
+        return static_cast<T *>(::operator new(sizeof(T) * c));
+    }
+
+    static void deallocate(T *p)
+    {
+        ::operator delete(p);
+    }
+
+    // Destruye los elementos en [from, to)
+    static void destroyRange(T *p, unsigned int from, unsigned int to)
+    {
+        if (!std::is_trivially_destructible<T>::value)
+        {
+            for (unsigned int i = from; i < to; i++)
+                p[i].~T();
+        }
+    }
+
+    // Mueve n elementos de src a dst (memoria sin construir) y destruye los de src.
+    // Para tipos trivialmente copiables basta con un memcpy; para el resto se usa
+    // move_if_noexcept, así un move que puede lanzar no deja el vector a medias.
+    static void relocate(T *src, T *dst, unsigned int n)
+    {
+        if (n == 0)
+            return;
+        if (std::is_trivially_copyable<T>::value)
+        {
+            std::memcpy(static_cast<void *>(dst), static_cast<const void *>(src), sizeof(T) * n);
+            return;
+        }
+        unsigned int i = 0;
+        try
+        {
+            for (; i < n; i++)
+                ::new (static_cast<void *>(dst + i)) T(std::move_if_noexcept(src[i]));
+        }
+        catch (...)
+        {
+            destroyRange(dst, 0, i);
+            throw;
+        }
+        destroyRange(src, 0, n);
+    }
+
+    // Copia n elementos de src a dst (memoria sin construir)
+    static void copyConstruct(const T *src, T *dst, unsigned int n)
+    {
+        if (std::is_trivially_copyable<T>::value)
+        {
+            if (n > 0)
+                std::memcpy(static_cast<void *>(dst), static_cast<const void *>(src), sizeof(T) * n);
+            return;
+        }
+        unsigned int i = 0;
+        try
+        {
+            for (; i < n; i++)
+                ::new (static_cast<void *>(dst + i)) T(src[i]);
+        }
+        catch (...)
+        {
+            destroyRange(dst, 0, i);
+            throw;
+        }
+    }
+
+    // Cambia la capacidad a new_capacity (>= sz) reubicando los elementos
+    void reallocate(unsigned int new_capacity)
+    {
+        T *new_storage = allocate(new_capacity);
+        try
+        {
+            relocate(storage, new_storage, sz);
+        }
+        catch (...)
+        {
+            deallocate(new_storage);
+            throw;
+        }
+        deallocate(storage);
+        storage = new_storage;
+        cap = new_capacity;
+    }
+
+    // Capacidad siguiente según la política, siempre al menos un espacio más
+    unsigned int grownCapacity() const
+    {
+        unsigned int next = static_cast<unsigned int>(cap * policy);
+        return next > cap ? next : cap + 1;
+    }
+
 public:
     // --- Constructores ---------------------------------------
 
     // Constructor por defecto
     Vector()
     {
-        storage = new T[5];
+        storage = allocate(5);
         sz = 0;
         cap = 5;
         policy = 1.5;
@@ -32,7 +135,7 @@ public:
     // Constructor con capacidad inicial y factor de crecimiento opcional
     Vector(unsigned int c, double p = 1.5)
     {
-        storage = new T[c];
+        storage = allocate(c);
         sz = 0;
         cap = c;
         policy = p;
@@ -41,27 +144,48 @@ public:
     // Constructor copia
     Vector(const Vector<T> &other)
     {
-        sz = other.size();
+        sz = 0;
         cap = other.cap;
         policy = other.policy;
-        storage = new T[cap];
-        for (unsigned int i = 0; i < sz; i++)
+        storage = allocate(cap);
+        try
         {
-            storage[i] = other.storage[i];
+            copyConstruct(other.storage, storage, other.sz);
         }
+        catch (...)
+        {
+            deallocate(storage);
+            throw;
+        }
+        sz = other.sz;
+    }
+
+    // Constructor de movimiento: roba el buffer, no copia elementos
+    Vector(Vector<T> &&other) noexcept
+        : storage(other.storage), sz(other.sz), cap(other.cap), policy(other.policy)
+    {
+        other.storage = nullptr;
+        other.sz = 0;
+        other.cap = 0;
     }
 
     // Constructor por lista de inicialización
     Vector(std::initializer_list<T> init)
     {
         cap = (init.size() > 0 ? static_cast<unsigned int>(init.size()) : 5);
-        storage = new T[cap];
+        storage = allocate(cap);
         sz = 0;
         policy = 1.5;
-        for (const auto &val : init)
+        try
+        {
+            copyConstruct(init.begin(), storage, static_cast<unsigned int>(init.size()));
+        }
+        catch (...)
         {
-            storage[sz++] = val;
+            deallocate(storage);
+            throw;
         }
+        sz = static_cast<unsigned int>(init.size());
     }
 
     // --- Operador de asignación ---------------------
@@ -69,20 +193,48 @@ public:
     {
         if (this != &other)
         {
-            delete[] storage;
-            sz = other.sz;
-            cap = other.cap; // Para LAVector
-            storage = new T[cap];
-            for (unsigned int i = 0; i < sz; i++)
+            T *new_storage = allocate(other.cap);
+            try
             {
-                storage[i] = other.storage[i];
+                copyConstruct(other.storage, new_storage, other.sz);
             }
+            catch (...)
+            {
+                deallocate(new_storage);
+                throw;
+            }
+            destroyRange(storage, 0, sz);
+            deallocate(storage);
+            storage = new_storage;
+            sz = other.sz;
+            cap = other.cap; // Para LAVector
+        }
+        return *this;
+    }
+
+    Vector<T> &operator=(Vector<T> &&other) noexcept
+    {
+        if (this != &other)
+        {
+            destroyRange(storage, 0, sz);
+            deallocate(storage);
+            storage = other.storage;
+            sz = other.sz;
+            cap = other.cap;
+            policy = other.policy;
+            other.storage = nullptr;
+            other.sz = 0;
+            other.cap = 0;
         }
         return *this;
     }
 
     // Destructor
-    ~Vector() { delete[] storage; }
+    ~Vector()
+    {
+        destroyRange(storage, 0, sz);
+        deallocate(storage);
+    }
 
     // --- Métodos de acceso (getters) ---------------------------------------
 
@@ -94,41 +246,82 @@ public:
 
     void push_back(const Vector<T> &other)
     {
-        reserve(sz + other.size());
-        for (unsigned int i = 0; i < other.size(); i++)
+        if (this == &other)
         {
-            push_back(other.storage[i]);
+            Vector<T> copy(other);
+            push_back(copy);
+            return;
         }
+        reserve(sz + other.size());
+        copyConstruct(other.storage, storage + sz, other.sz);
+        sz += other.sz;
     }
 
     void push_back(const T &elem)
+    {
+        emplace_back(elem);
+    }
+
+    void push_back(T &&elem)
+    {
+        emplace_back(std::move(elem));
+    }
+
+    // Construye el elemento directamente en su posición final
+    template <typename... Args>
+    T &emplace_back(Args &&...args)
     {
         if (sz == cap)
         {
-            resize();
+            // El elemento se construye antes de reubicar, por si args referencia
+            // a un elemento del propio vector
+            unsigned int new_capacity = grownCapacity();
+            T *new_storage = allocate(new_capacity);
+            try
+            {
+                ::new (static_cast<void *>(new_storage + sz)) T(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                deallocate(new_storage);
+                throw;
+            }
+            try
+            {
+                relocate(storage, new_storage, sz);
+            }
+            catch (...)
+            {
+                new_storage[sz].~T();
+                deallocate(new_storage);
+                throw;
+            }
+            deallocate(storage);
+            storage = new_storage;
+            cap = new_capacity;
+        }
+        else
+        {
+            ::new (static_cast<void *>(storage + sz)) T(std::forward<Args>(args)...);
         }
-        storage[sz] = elem;
         sz++;
+        return storage[sz - 1];
     }
 
     void pop_back()
     {
         if (sz > 0)
+        {
             sz--;
+            destroyRange(storage, sz, sz + 1);
+        }
     }
 
     void shrink_to_fit()
     {
         if (sz < cap)
         {
-            T *new_storage = new T[sz];
-            for (unsigned int i = 0; i < sz; i++)
-            {
-                new_storage[i] = storage[i];
-            }
-            delete[] storage;
-            storage = new_storage;
-            cap = sz;
+            reallocate(sz);
         }
     }
     // --- Acceso por índice ---------------------------------------
@@ -149,7 +342,7 @@ public:
     {
         if (index >= sz)
         {
-            throw out_of_range("Index out of range");
+            throw std::out_of_range("Index out of range");
         }
         return storage[index];
     }
@@ -158,38 +351,19 @@ public:
     {
         if (index >= sz)
         {
-            throw out_of_range("Index out of range");
+            throw std::out_of_range("Index out of range");
         }
         return storage[index];
     }
 
-private:
-    void resize()
-    {
-        cap *= policy;
-        T *new_storage = new T[cap];
-        for (unsigned int i = 0; i < sz; i++)
-        {
-            new_storage[i] = storage[i];
-        }
-        delete[] storage;
-        storage = new_storage;
-    }
-
+    // Garantiza espacio para new_capacity elementos sin reubicar de nuevo
     void reserve(unsigned int new_capacity)
     {
         if (new_capacity > cap)
         {
-            cap = new_capacity;
-            T *new_storage = new T[cap];
-            for (unsigned int i = 0; i < sz; i++)
-            {
-                new_storage[i] = storage[i];
-            }
-            delete[] storage;
-            storage = new_storage;
+            reallocate(new_capacity);
         }
     }
 };
 
-#endif // !VECTOR_HH
\ No newline at end of file
+#endif // !VECTOR_HH
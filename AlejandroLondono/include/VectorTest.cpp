@@ -0,0 +1,235 @@
+/**
+ * @file VectorTest.cpp
+ * @brief Pruebas para Vector (include/Vector.hh): emplace, reubicación y copias
+ *
+ * Compilar, por ejemplo:
+ *   g++ -std=c++17 -fsanitize=address,undefined VectorTest.cpp -o VectorTest
+ */
+
+#include "Vector.hh"
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+using namespace std;
+
+int failures = 0;
+
+void printHeader(const string &title)
+{
+    cout << "\n" << string(70, '=') << endl;
+    cout << "  " << title << endl;
+    cout << string(70, '=') << endl;
+}
+
+void printTest(const string &test, bool passed)
+{
+    if (!passed)
+        failures++;
+    cout << "[" << (passed ? "✓ PASS" : "✗ FAIL") << "] " << test << endl;
+}
+
+/**
+ * @brief Tipo no trivialmente copiable que se apunta a sí mismo
+ *
+ * Si Vector lo reubicara con memcpy, self dejaría de apuntar al objeto.
+ * Cuenta los objetos vivos y los movimientos para comprobar que cada
+ * elemento se construye y se destruye exactamente una vez.
+ */
+struct Tracked
+{
+    static int live;  ///< Objetos construidos y aún no destruidos
+    static int moves; ///< Constructores de movimiento llamados
+
+    int value;
+    Tracked *self;
+
+    explicit Tracked(int v) : value(v), self(this) { live++; }
+    Tracked(const Tracked &other) : value(other.value), self(this) { live++; }
+    Tracked(Tracked &&other) noexcept : value(other.value), self(this)
+    {
+        other.value = -1;
+        live++;
+        moves++;
+    }
+    Tracked &operator=(const Tracked &other)
+    {
+        value = other.value;
+        return *this;
+    }
+    ~Tracked() { live--; }
+
+    bool intact() const { return self == this; }
+};
+
+int Tracked::live = 0;
+int Tracked::moves = 0;
+
+/**
+ * @brief Tipo cuyo constructor de movimiento puede lanzar: al reubicar se debe copiar
+ */
+struct ThrowingMove
+{
+    static int copies;
+    int value;
+
+    explicit ThrowingMove(int v) : value(v) {}
+    ThrowingMove(const ThrowingMove &other) : value(other.value) { copies++; }
+    ThrowingMove(ThrowingMove &&other) : value(other.value) { other.value = -1; }
+};
+
+int ThrowingMove::copies = 0;
+
+/**
+ * @brief Tipo cuya copia lanza a partir de cierto número de copias
+ */
+struct FragileCopy
+{
+    static int budget; ///< Copias permitidas antes de lanzar
+    static int live;
+    int value;
+
+    explicit FragileCopy(int v) : value(v) { live++; }
+    FragileCopy(const FragileCopy &other) : value(other.value)
+    {
+        if (budget-- <= 0)
+            throw runtime_error("copy failed");
+        live++;
+    }
+    ~FragileCopy() { live--; }
+};
+
+int FragileCopy::budget = 0;
+int FragileCopy::live = 0;
+
+template <typename V>
+bool allIntact(const V &v)
+{
+    for (unsigned int i = 0; i < v.size(); i++)
+        if (!v[i].intact() || v[i].value != static_cast<int>(i))
+            return false;
+    return true;
+}
+
+int main()
+{
+    cout << "\n╔══════════════════════════════════════════════════════════════════╗\n";
+    cout << "║                      PRUEBAS DE VECTOR                           ║\n";
+    cout << "╚══════════════════════════════════════════════════════════════════╝\n";
+
+    // ==================== PRUEBA 1: emplace_back y reubicación ====================
+    printHeader("PRUEBA 1: emplace_back con un tipo no trivialmente copiable");
+
+    {
+        Vector<Tracked> v(2);
+        for (int i = 0; i < 1000; i++)
+            v.emplace_back(i);
+        printTest("1000 elementos tras varias reubicaciones", v.size() == 1000 && v.getCapacity() >= 1000);
+        printTest("Cada elemento se reubicó con su constructor (self apunta a sí mismo)", allIntact(v));
+        printTest("Objetos vivos == size()", Tracked::live == 1000);
+        printTest("La reubicación usa el move noexcept", Tracked::moves > 0);
+
+        Tracked &ref = v.emplace_back(1000);
+        printTest("emplace_back devuelve una referencia al nuevo elemento", &ref == &v[1000] && ref.value == 1000);
+
+        v.pop_back();
+        v.shrink_to_fit();
+        printTest("shrink_to_fit reubica a capacidad exacta", v.getCapacity() == 1000 && allIntact(v) && Tracked::live == 1000);
+    }
+    printTest("El destructor destruye todos los elementos", Tracked::live == 0);
+
+    // ==================== PRUEBA 2: argumento que vive en el propio vector ====================
+    printHeader("PRUEBA 2: emplace_back(v[0]) cuando hay que crecer");
+
+    {
+        Vector<string> v(2);
+        v.push_back(string(100, 'a'));
+        v.push_back(string(100, 'b'));
+        v.emplace_back(v[0]); // v[0] se reubica en medio de la inserción
+        printTest("La copia se hace antes de reubicar", v.size() == 3 && v[2] == string(100, 'a') && v[0] == v[2]);
+        v.push_back(v[1]);
+        printTest("push_back(v[1]) también es seguro", v[3] == string(100, 'b'));
+    }
+
+    // ==================== PRUEBA 3: move que puede lanzar ====================
+    printHeader("PRUEBA 3: move_if_noexcept con un move que puede lanzar");
+
+    {
+        Vector<ThrowingMove> v(1);
+        v.emplace_back(7);
+        ThrowingMove::copies = 0;
+        v.emplace_back(8);
+        printTest("Al crecer se copia en lugar de mover", ThrowingMove::copies == 1 && v[0].value == 7 && v[1].value == 8);
+    }
+
+    // ==================== PRUEBA 4: excepción durante una copia ====================
+    printHeader("PRUEBA 4: copia que lanza a la mitad");
+
+    {
+        Vector<FragileCopy> v(4);
+        for (int i = 0; i < 4; i++)
+            v.emplace_back(i);
+        FragileCopy::budget = 2;
+        bool threw = false;
+        try
+        {
+            Vector<FragileCopy> copy(v);
+        }
+        catch (const runtime_error &)
+        {
+            threw = true;
+        }
+        printTest("El constructor de copia propaga la excepción", threw);
+        printTest("Los elementos copiados antes del fallo se destruyen", FragileCopy::live == 4);
+
+        FragileCopy::budget = 1;
+        Vector<FragileCopy> target(1);
+        target.emplace_back(42);
+        threw = false;
+        try
+        {
+            target = v;
+        }
+        catch (const runtime_error &)
+        {
+            threw = true;
+        }
+        printTest("operator= con fallo deja el destino intacto",
+                  threw && target.size() == 1 && target[0].value == 42 && FragileCopy::live == 5);
+    }
+    printTest("Sin fugas de FragileCopy", FragileCopy::live == 0);
+
+    // ==================== PRUEBA 5: copia, movimiento y push_back(Vector) ====================
+    printHeader("PRUEBA 5: Copia, movimiento y push_back de otro Vector");
+
+    {
+        Vector<Tracked> a(1);
+        for (int i = 0; i < 10; i++)
+            a.emplace_back(i);
+        Vector<Tracked> b(a);
+        printTest("Constructor de copia", b.size() == 10 && allIntact(b) && Tracked::live == 20);
+        Vector<Tracked> c(std::move(b));
+        printTest("Constructor de movimiento roba el buffer", c.size() == 10 && b.size() == 0 && Tracked::live == 20);
+        b = c;
+        printTest("Asignación por copia a un vector movido", b.size() == 10 && allIntact(b) && Tracked::live == 30);
+        a = std::move(c);
+        printTest("Asignación por movimiento libera el contenido anterior", a.size() == 10 && allIntact(a) && Tracked::live == 20);
+
+        Vector<string> s = {"x", "y"};
+        s.push_back(s);
+        printTest("push_back de sí mismo duplica el contenido", s.size() == 4 && s[2] == "x" && s[3] == "y");
+        try
+        {
+            s.at(4);
+            printTest("at() fuera de rango lanza out_of_range", false);
+        }
+        catch (const out_of_range &)
+        {
+            printTest("at() fuera de rango lanza out_of_range", true);
+        }
+    }
+    printTest("Sin fugas de Tracked", Tracked::live == 0);
+
+    cout << "\n" << (failures == 0 ? "Todas las pruebas pasaron" : "Hay pruebas que fallaron") << endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,572 @@
+#ifndef XOR_LIST_HH
+#define XOR_LIST_HH
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+/**
+ * @brief A XOR-linked list with the same interface as List<T>.
+ *
+ * Every node stores a single link: the XOR of the addresses of its
+ * neighbours. Knowing one neighbour is enough to reach the other, so the
+ * list can be walked in both directions with the memory of a singly-linked
+ * list. That gives O(1) pop_back (List<T> needs O(n)), O(1) reverse, and
+ * indexed access that starts from the closer end.
+ *
+ * @tparam T Type of elements stored in the list.
+ * @tparam Alloc Allocator used for the nodes (std::allocator by default).
+ */
+template <typename T, typename Alloc = std::allocator<T>>
+class XorList
+{
+private:
+  /**
+   * @brief Node class representing an element in the list.
+   */
+  class Node
+  {
+  private:
+    T data;         ///< Value stored in the node.
+    uintptr_t link; ///< Address of the previous node XOR address of the next one.
+
+  public:
+    /**
+     * @brief Constructor with value.
+     * @param v Value to store in the node.
+     */
+    Node(const T &v) : data(v), link(0) {}
+
+    /**
+     * @brief Get the neighbour that is not `from`.
+     * @param from One of the neighbours of this node (nullptr at the ends).
+     * @return Pointer to the other neighbour.
+     */
+    Node *other(Node *from) const
+    {
+      return reinterpret_cast<Node *>(link ^ reinterpret_cast<uintptr_t>(from));
+    }
+
+    /**
+     * @brief Replace neighbour `oldNode` with `newNode`.
+     * @param oldNode Current neighbour (nullptr at the ends).
+     * @param newNode New neighbour (nullptr at the ends).
+     */
+    void replace(Node *oldNode, Node *newNode)
+    {
+      link ^= reinterpret_cast<uintptr_t>(oldNode) ^ reinterpret_cast<uintptr_t>(newNode);
+    }
+
+    /**
+     * @brief Get a reference to the data stored in the node.
+     * @return Reference to the data stored in the node.
+     */
+    T &getData() { return data; }
+
+    /**
+     * @brief Get a const reference to the data stored in the node.
+     * @return Const reference to the data stored in the node.
+     */
+    const T &getData() const { return data; }
+  };
+
+  typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node> NodeAlloc;
+  typedef std::allocator_traits<NodeAlloc> NodeTraits;
+
+private:
+  Node *first;         ///< Pointer to the first node in the list.
+  Node *last;          ///< Pointer to the last node in the list.
+  unsigned int sz;     ///< Number of elements in the list.
+  NodeAlloc nodeAlloc; ///< Allocator for the nodes, owned by this list only.
+
+  /**
+   * @brief Allocate and construct a node.
+   * @param val Value to store in the node.
+   * @return Pointer to the new node.
+   */
+  Node *createNode(const T &val)
+  {
+    Node *node = NodeTraits::allocate(nodeAlloc, 1);
+    try
+    {
+      NodeTraits::construct(nodeAlloc, node, val);
+    }
+    catch (...)
+    {
+      NodeTraits::deallocate(nodeAlloc, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  /**
+   * @brief Destroy and deallocate a node.
+   * @param node Pointer to the node.
+   */
+  void destroyNode(Node *node)
+  {
+    NodeTraits::destroy(nodeAlloc, node);
+    NodeTraits::deallocate(nodeAlloc, node, 1);
+  }
+
+  /**
+   * @brief Free all nodes of the list.
+   */
+  void freeNodes()
+  {
+    Node *prev = nullptr;
+    Node *current = first;
+    while (current != nullptr)
+    {
+      Node *next = current->other(prev);
+      prev = current;
+      destroyNode(current);
+      current = next;
+    }
+  }
+
+  /**
+   * @brief Find the node at a position and its predecessor.
+   *
+   * Walks from the closer end of the list.
+   *
+   * @param index Position of the node (must be < sz).
+   * @param before Set to the node at index - 1 (nullptr if index is 0).
+   * @param current Set to the node at index.
+   */
+  void locate(unsigned int index, Node *&before, Node *&current) const
+  {
+    if (index <= sz / 2)
+    {
+      before = nullptr;
+      current = first;
+      for (unsigned int i = 0; i < index; i++)
+      {
+        Node *next = current->other(before);
+        before = current;
+        current = next;
+      }
+    }
+    else
+    {
+      Node *after = nullptr;
+      current = last;
+      for (unsigned int i = sz - 1; i > index; i--)
+      {
+        Node *prev = current->other(after);
+        after = current;
+        current = prev;
+      }
+      before = current->other(after);
+    }
+  }
+
+public:
+  /**
+   * @brief Default constructor. Initializes an empty list.
+   */
+  XorList() : first(nullptr), last(nullptr), sz(0), nodeAlloc() {}
+
+  /**
+   * @brief Copy constructor. Creates a deep copy of another list.
+   * @param other List to copy.
+   */
+  XorList(const XorList &other) : first(nullptr), last(nullptr), sz(0), nodeAlloc()
+  {
+    push_back(other);
+  }
+
+  /**
+   * @brief Destructor. Deletes all nodes in the list.
+   */
+  ~XorList()
+  {
+    freeNodes();
+  }
+
+  /**
+   * @brief Assignment operator. Replaces the contents with a copy of other.
+   * @param other List to copy.
+   * @return Reference to this list.
+   */
+  XorList &operator=(const XorList &other)
+  {
+    if (this != &other)
+    {
+      clear();
+      push_back(other);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Check if the list is empty.
+   * @return true if the list is empty, false otherwise.
+   */
+  bool empty() const
+  {
+    return first == nullptr && last == nullptr;
+  }
+
+  /**
+   * @brief Get the number of elements in the list.
+   * @return The size of the list.
+   */
+  unsigned int size() const { return sz; }
+
+  /**
+   * @brief Add an element to the end of the list.
+   * @param val Value to add.
+   */
+  void push_back(const T &val)
+  {
+    Node *newNode = createNode(val);
+    newNode->replace(nullptr, last);
+    if (!empty())
+    {
+      last->replace(nullptr, newNode);
+    }
+    else
+    {
+      first = newNode;
+    }
+    last = newNode;
+    sz++;
+  }
+
+  /**
+   * @brief Add an element to the beginning of the list.
+   * @param val Value to add.
+   */
+  void push_front(const T &val)
+  {
+    Node *newNode = createNode(val);
+    newNode->replace(nullptr, first);
+    if (!empty())
+    {
+      first->replace(nullptr, newNode);
+    }
+    else
+    {
+      last = newNode;
+    }
+    first = newNode;
+    sz++;
+  }
+
+  /**
+   * @brief Remove the last element from the list in O(1).
+   *
+   * @note If the list is empty, this function does nothing.
+   */
+  void pop_back()
+  {
+    if (empty())
+      return;
+
+    Node *prev = last->other(nullptr);
+    if (prev != nullptr)
+    {
+      prev->replace(last, nullptr);
+    }
+    else
+    {
+      first = nullptr;
+    }
+    destroyNode(last);
+    last = prev;
+    sz--;
+  }
+
+  /**
+   * @brief Remove the first element from the list.
+   *
+   * @note If the list is empty, this function does nothing.
+   */
+  void pop_front()
+  {
+    if (empty())
+      return;
+
+    Node *next = first->other(nullptr);
+    if (next != nullptr)
+    {
+      next->replace(first, nullptr);
+    }
+    else
+    {
+      last = nullptr;
+    }
+    destroyNode(first);
+    first = next;
+    sz--;
+  }
+
+  /**
+   * @brief Get the first element in the list.
+   * @return Reference to the first element.
+   * @throws std::out_of_range if the list is empty.
+   */
+  T &front()
+  {
+    if (empty())
+      throw std::out_of_range("List is empty");
+    return first->getData();
+  }
+
+  /**
+   * @brief Get the first element in the list (const version).
+   * @return Const reference to the first element.
+   * @throws std::out_of_range if the list is empty.
+   */
+  const T &front() const
+  {
+    if (empty())
+      throw std::out_of_range("List is empty");
+    return first->getData();
+  }
+
+  /**
+   * @brief Get the last element in the list.
+   * @return Reference to the last element.
+   * @throws std::out_of_range if the list is empty.
+   */
+  T &back()
+  {
+    if (empty())
+      throw std::out_of_range("list is empty");
+    return last->getData();
+  }
+
+  /**
+   * @brief Get the last element in the list (const version).
+   * @return Const reference to the last element.
+   * @throws std::out_of_range if the list is empty.
+   */
+  const T &back() const
+  {
+    if (empty())
+      throw std::out_of_range("list is empty");
+    return last->getData();
+  }
+
+  /**
+   * @brief Remove all elements from the list.
+   */
+  void clear()
+  {
+    freeNodes();
+    first = last = nullptr;
+    sz = 0;
+  }
+
+  /**
+   * @brief Get the element at a specific index.
+   * @param index Index of the element to retrieve.
+   * @return Reference to the element at the specified index.
+   * @throws std::out_of_range if the index is out of bounds.
+   */
+  T &at(unsigned int index)
+  {
+    if (index >= sz)
+      throw out_of_range("Index out of range");
+    Node *before;
+    Node *current;
+    locate(index, before, current);
+    return current->getData();
+  }
+
+  /**
+   * @brief Get the element at a specific index (const version).
+   * @param index Index of the element to retrieve.
+   * @return Const reference to the element at the specified index.
+   * @throws std::out_of_range if the index is out of bounds.
+   */
+  const T &at(unsigned int index) const
+  {
+    if (index >= sz)
+      throw out_of_range("Index out of range");
+    Node *before;
+    Node *current;
+    locate(index, before, current);
+    return current->getData();
+  }
+
+  /**
+   * @brief Access an element using the subscript operator.
+   * @param index Index of the element to access.
+   * @return Reference to the element at the specified index.
+   */
+  T &operator[](unsigned int index) { return at(index); }
+
+  /**
+   * @brief Access an element using the subscript operator (const version).
+   * @param index Index of the element to access.
+   * @return Const reference to the element at the specified index.
+   */
+  const T &operator[](unsigned int index) const { return at(index); }
+
+  /**
+   * @brief Insert an element at a specific index.
+   * @param index Index where the element will be inserted.
+   * @param val Value to insert.
+   * @throws std::out_of_range if the index is out of bounds.
+   */
+  void insert(unsigned int index, const T &val)
+  {
+    if (index > sz)
+      throw out_of_range("Index out of range");
+
+    if (index == 0)
+    {
+      push_front(val);
+    }
+    else if (index == sz)
+    {
+      push_back(val);
+    }
+    else
+    {
+      Node *before;
+      Node *current;
+      locate(index, before, current);
+
+      Node *newNode = createNode(val);
+      newNode->replace(nullptr, before);
+      newNode->replace(nullptr, current);
+      before->replace(current, newNode);
+      current->replace(before, newNode);
+      sz++;
+    }
+  }
+
+  /**
+   * @brief Remove an element at a specific index.
+   * @param index Index of the element to remove.
+   * @throws std::out_of_range if the index is out of bounds.
+   */
+  void erase(unsigned int index)
+  {
+    if (index >= sz)
+      throw out_of_range("index out of range");
+
+    if (index == 0)
+    {
+      pop_front();
+    }
+    else if (index == sz - 1)
+    {
+      pop_back();
+    }
+    else
+    {
+      Node *before;
+      Node *current;
+      locate(index, before, current);
+
+      Node *after = current->other(before);
+      before->replace(current, after);
+      after->replace(current, before);
+      destroyNode(current);
+      sz--;
+    }
+  }
+
+  /**
+   * @brief Reverse the order of elements in the list in O(1).
+   *
+   * A XOR link does not know which neighbour is "next", so swapping the
+   * ends is enough.
+   */
+  void reverse()
+  {
+    std::swap(first, last);
+  }
+
+  /**
+   * @brief Append the elements of another list to the end of this list.
+   * @param other List whose elements will be appended.
+   */
+  void push_back(const XorList &other)
+  {
+    unsigned int n = other.sz; // other puede ser *this
+    Node *prev = nullptr;
+    Node *current = other.first;
+    for (unsigned int i = 0; i < n; i++)
+    {
+      Node *next = current->other(prev);
+      push_back(current->getData());
+      prev = current;
+      current = next;
+    }
+  }
+
+  /**
+   * @brief Prepend the elements of another list to the beginning of this list.
+   * @param other List whose elements will be prepended.
+   */
+  void push_front(const XorList &other)
+  {
+    unsigned int n = other.sz; // other puede ser *this
+    Node *next = nullptr;
+    Node *current = other.last;
+    for (unsigned int i = 0; i < n; i++)
+    {
+      Node *prev = current->other(next);
+      push_front(current->getData());
+      next = current;
+      current = prev;
+    }
+  }
+
+  /**
+   * @brief Check if two lists are equal.
+   * @param other List to compare with.
+   * @return true if lists are equal, false otherwise.
+   */
+  bool operator==(const XorList &other) const
+  {
+    if (sz != other.sz)
+      return false;
+
+    Node *prev = nullptr;
+    Node *current = first;
+    Node *otherPrev = nullptr;
+    Node *otherCurrent = other.first;
+    while (current != nullptr)
+    {
+      if (current->getData() != otherCurrent->getData())
+        return false;
+      Node *next = current->other(prev);
+      Node *otherNext = otherCurrent->other(otherPrev);
+      prev = current;
+      current = next;
+      otherPrev = otherCurrent;
+      otherCurrent = otherNext;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Print the elements of the list.
+   */
+  void print() const
+  {
+    Node *prev = nullptr;
+    Node *current = first;
+    while (current != nullptr)
+    {
+      cout << current->getData() << " ";
+      Node *next = current->other(prev);
+      prev = current;
+      current = next;
+    }
+    cout << endl;
+  }
+};
+
+#endif // XOR_LIST_HH
@@ -0,0 +1,250 @@
+/**
+ * @file XorListTest.cpp
+ * @brief Pruebas para XorList (include/XorList.hh): pop_back, reverse y acceso por índice
+ *
+ * Compilar, por ejemplo:
+ *   g++ -std=c++17 -fsanitize=address,undefined XorListTest.cpp -o XorListTest
+ */
+
+#include "XorList.hh"
+#include "NodePool.hh"
+#include <algorithm>
+#include <deque>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+using namespace std;
+
+int failures = 0;
+
+void printHeader(const string &title)
+{
+    cout << "\n" << string(70, '=') << endl;
+    cout << "  " << title << endl;
+    cout << string(70, '=') << endl;
+}
+
+void printTest(const string &test, bool passed)
+{
+    if (!passed)
+        failures++;
+    cout << "[" << (passed ? "✓ PASS" : "✗ FAIL") << "] " << test << endl;
+}
+
+/**
+ * @brief Compara la lista con el modelo, de frente (at) y de atrás hacia adelante (copia invertida)
+ */
+template <typename L, typename T>
+bool sameAs(const L &list, const deque<T> &model)
+{
+    if (list.size() != model.size() || list.empty() != model.empty())
+        return false;
+    for (unsigned int i = 0; i < model.size(); i++)
+        if (list.at(i) != model[i])
+            return false;
+    if (!model.empty() && (list.front() != model.front() || list.back() != model.back()))
+        return false;
+    L reversed(list);
+    reversed.reverse();
+    for (unsigned int i = 0; i < model.size(); i++)
+        if (reversed.at(i) != model[model.size() - 1 - i])
+            return false;
+    return true;
+}
+
+/**
+ * @brief Operaciones al azar sobre la lista y sobre un std::deque; devuelve false en la primera diferencia
+ */
+template <typename L>
+bool randomOps(unsigned int seed, int steps)
+{
+    mt19937 rng(seed);
+    L list;
+    deque<int> model;
+    for (int step = 0; step < steps; step++)
+    {
+        int value = static_cast<int>(rng() % 1000);
+        switch (rng() % 8)
+        {
+        case 0:
+            list.push_back(value);
+            model.push_back(value);
+            break;
+        case 1:
+            list.push_front(value);
+            model.push_front(value);
+            break;
+        case 2:
+            list.pop_back();
+            if (!model.empty())
+                model.pop_back();
+            break;
+        case 3:
+            list.pop_front();
+            if (!model.empty())
+                model.pop_front();
+            break;
+        case 4:
+            list.reverse();
+            std::reverse(model.begin(), model.end());
+            break;
+        case 5:
+        {
+            unsigned int index = rng() % (model.size() + 1);
+            list.insert(index, value);
+            model.insert(model.begin() + index, value);
+            break;
+        }
+        case 6:
+            if (!model.empty())
+            {
+                unsigned int index = rng() % model.size();
+                list.erase(index);
+                model.erase(model.begin() + index);
+            }
+            break;
+        default:
+            if (!model.empty())
+            {
+                unsigned int index = rng() % model.size();
+                list.at(index) = value;
+                model[index] = value;
+            }
+            break;
+        }
+        if (step % 50 == 0 && !sameAs(list, model))
+            return false;
+    }
+    return sameAs(list, model);
+}
+
+int main()
+{
+    cout << "\n╔══════════════════════════════════════════════════════════════════╗\n";
+    cout << "║                      PRUEBAS DE XORLIST                          ║\n";
+    cout << "╚══════════════════════════════════════════════════════════════════╝\n";
+
+    // ==================== PRUEBA 1: pop_back ====================
+    printHeader("PRUEBA 1: pop_back en O(1) hasta vaciar la lista");
+
+    {
+        XorList<int> list;
+        list.pop_back();
+        printTest("pop_back en una lista vacía no hace nada", list.empty() && list.size() == 0);
+
+        for (int i = 0; i < 10; i++)
+            list.push_back(i);
+        bool ok = true;
+        for (int i = 9; i >= 0; i--)
+        {
+            ok = ok && list.back() == i && list.front() == 0;
+            list.pop_back();
+        }
+        printTest("pop_back quita los elementos del último al primero", ok && list.empty());
+
+        list.push_back(1);
+        list.pop_back();
+        list.push_front(2);
+        printTest("pop_back del único elemento deja la lista reutilizable", list.size() == 1 && list.front() == 2 &&
+                                                                                    list.back() == 2);
+        try
+        {
+            list.pop_back();
+            list.back();
+            printTest("back() en una lista vacía lanza out_of_range", false);
+        }
+        catch (const out_of_range &)
+        {
+            printTest("back() en una lista vacía lanza out_of_range", true);
+        }
+    }
+
+    // ==================== PRUEBA 2: reverse ====================
+    printHeader("PRUEBA 2: reverse en O(1)");
+
+    {
+        XorList<int> list;
+        list.reverse();
+        printTest("reverse de una lista vacía", list.empty());
+
+        deque<int> model;
+        for (int i = 0; i < 7; i++)
+        {
+            list.push_back(i);
+            model.push_back(i);
+        }
+        list.reverse();
+        std::reverse(model.begin(), model.end());
+        printTest("reverse invierte el orden", sameAs(list, model));
+
+        list.push_back(100);
+        list.push_front(-100);
+        list.insert(4, 50);
+        list.erase(2);
+        model.push_back(100);
+        model.push_front(-100);
+        model.insert(model.begin() + 4, 50);
+        model.erase(model.begin() + 2);
+        printTest("push/insert/erase después de reverse", sameAs(list, model));
+
+        list.reverse();
+        list.pop_back();
+        list.pop_front();
+        std::reverse(model.begin(), model.end());
+        model.pop_back();
+        model.pop_front();
+        printTest("Dos reverse seguidos y pops en ambos extremos", sameAs(list, model));
+
+        XorList<int> other;
+        other.push_back(list);
+        other.reverse();
+        other.push_front(list);
+        deque<int> expected(model);
+        expected.insert(expected.end(), model.rbegin(), model.rend());
+        printTest("push_back(list) y push_front(list) sobre una lista invertida", sameAs(other, expected));
+
+        list.push_back(list);
+        model.insert(model.end(), model.begin(), model.end());
+        printTest("push_back de sí misma", sameAs(list, model));
+    }
+
+    // ==================== PRUEBA 3: operaciones al azar ====================
+    printHeader("PRUEBA 3: Operaciones al azar contra std::deque");
+
+    {
+        bool ok = true;
+        for (unsigned int seed = 1; seed <= 20; seed++)
+            ok = ok && randomOps<XorList<int>>(seed, 2000);
+        printTest("20 secuencias de 2000 operaciones (std::allocator)", ok);
+
+        ok = true;
+        for (unsigned int seed = 1; seed <= 5; seed++)
+            ok = ok && randomOps<XorList<int, PoolAllocator<int, 32>>>(seed, 2000);
+        printTest("5 secuencias de 2000 operaciones (PoolAllocator)", ok);
+    }
+
+    {
+        XorList<string> words;
+        deque<string> model;
+        for (int i = 0; i < 30; i++)
+        {
+            words.push_back(string(40, static_cast<char>('a' + i % 26)));
+            model.push_back(string(40, static_cast<char>('a' + i % 26)));
+        }
+        words.reverse();
+        words.pop_back();
+        words.erase(3);
+        std::reverse(model.begin(), model.end());
+        model.pop_back();
+        model.erase(model.begin() + 3);
+        XorList<string> copy;
+        copy = words;
+        printTest("Strings: reverse, pop_back, erase y asignación (sin fugas con ASan)", sameAs(copy, model) &&
+                                                                                            copy == words);
+    }
+
+    cout << "\n" << (failures == 0 ? "Todas las pruebas pasaron" : "Hay pruebas que fallaron") << endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -1,17 +1,25 @@
 #ifndef LIST_HH
 #define LIST_HH
 
+#include <cstddef>
 #include <iostream>
+#include <iterator>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
 
 using namespace std;
 
 /**
  * @brief A simple singly-linked list implementation.
  *
+ * Nodes are obtained from `Alloc` (rebound to the node type), so the list
+ * can be backed by a PoolAllocator to avoid one global allocation per element.
+ *
  * @tparam T Type of elements stored in the list.
+ * @tparam Alloc Allocator used for the nodes (std::allocator by default).
  */
-template <typename T>
+template <typename T, typename Alloc = std::allocator<T>>
 class List
 {
 private:
@@ -61,10 +69,58 @@ private:
     T &getData() { return data; }
   };
 
+  typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node> NodeAlloc;
+  typedef std::allocator_traits<NodeAlloc> NodeTraits;
+
+  /**
+   * @brief Detects allocators that can drop all their blocks at once.
+   */
+  template <typename A, typename = void>
+  struct HasRelease : std::false_type
+  {
+  };
+
+  template <typename A>
+  struct HasRelease<A, decltype(std::declval<A &>().release(), void())> : std::true_type
+  {
+  };
+
 private:
-  Node *first;     ///< Pointer to the first node in the list.
-  Node *last;      ///< Pointer to the last node in the list.
-  unsigned int sz; ///< Number of elements in the list.
+  Node *first;         ///< Pointer to the first node in the list.
+  Node *last;          ///< Pointer to the last node in the list.
+  unsigned int sz;     ///< Number of elements in the list.
+  NodeAlloc nodeAlloc; ///< Allocator for the nodes.
+  bool ownsArena;      ///< false when nodeAlloc came from the user and may be shared with other lists.
+
+  /**
+   * @brief Allocate and construct a node.
+   * @param val Value to store in the node.
+   * @return Pointer to the new node.
+   */
+  Node *createNode(const T &val)
+  {
+    Node *node = NodeTraits::allocate(nodeAlloc, 1);
+    try
+    {
+      NodeTraits::construct(nodeAlloc, node, val);
+    }
+    catch (...)
+    {
+      NodeTraits::deallocate(nodeAlloc, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  /**
+   * @brief Destroy and deallocate a node.
+   * @param node Pointer to the node.
+   */
+  void destroyNode(Node *node)
+  {
+    NodeTraits::destroy(nodeAlloc, node);
+    NodeTraits::deallocate(nodeAlloc, node, 1);
+  }
 
   /**
    * @brief Free all nodes starting from a given node.
@@ -75,23 +131,133 @@ private:
     while (node != nullptr)
     {
       Node *temp = node->getNext();
-      delete node;
+      destroyNode(node);
       node = temp;
     }
   }
 
+  /**
+   * @brief Free every node of the list.
+   *
+   * When the allocator supports it and is not shared with other lists,
+   * the whole arena is released at once (after destroying the elements).
+   */
+  void freeAll(std::true_type)
+  {
+    if (!ownsArena)
+    {
+      freeNodes(first);
+      return;
+    }
+    if (!std::is_trivially_destructible<T>::value)
+    {
+      Node *node = first;
+      while (node != nullptr)
+      {
+        Node *temp = node->getNext();
+        NodeTraits::destroy(nodeAlloc, node);
+        node = temp;
+      }
+    }
+    nodeAlloc.release();
+  }
+
+  void freeAll(std::false_type)
+  {
+    freeNodes(first);
+  }
+
 public:
+  /**
+   * @brief Forward iterator over the elements of the list.
+   *
+   * Advancing is O(1), so range-for loops and <algorithm> traverse the
+   * list in linear time instead of calling at() for every index.
+   *
+   * @tparam IsConst true for const_iterator, false for iterator.
+   */
+  template <bool IsConst>
+  class Iterator
+  {
+  private:
+    Node *node; ///< Current node (nullptr for end()).
+
+    explicit Iterator(Node *n) : node(n) {}
+
+    friend class List;
+    friend class Iterator<!IsConst>;
+
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef typename std::conditional<IsConst, const T *, T *>::type pointer;
+    typedef typename std::conditional<IsConst, const T &, T &>::type reference;
+
+    /**
+     * @brief Default constructor. Creates a singular iterator.
+     */
+    Iterator() : node(nullptr) {}
+
+    /**
+     * @brief Conversion from iterator to const_iterator.
+     * @param other Iterator to convert.
+     */
+    template <bool WasConst, typename = typename std::enable_if<IsConst && !WasConst>::type>
+    Iterator(const Iterator<WasConst> &other) : node(other.node) {}
+
+    reference operator*() const { return node->getData(); }
+    pointer operator->() const { return &node->getData(); }
+
+    /**
+     * @brief Advance to the next element (prefix).
+     * @return Reference to this iterator.
+     */
+    Iterator &operator++()
+    {
+      node = node->getNext();
+      return *this;
+    }
+
+    /**
+     * @brief Advance to the next element (postfix).
+     * @return Copy of the iterator before advancing.
+     */
+    Iterator operator++(int)
+    {
+      Iterator temp = *this;
+      node = node->getNext();
+      return temp;
+    }
+
+    bool operator==(const Iterator &other) const { return node == other.node; }
+    bool operator!=(const Iterator &other) const { return node != other.node; }
+  };
+
+  typedef Iterator<false> iterator;
+  typedef Iterator<true> const_iterator;
+
   /**
    * @brief Default constructor. Initializes an empty list.
    */
-  List() : first(nullptr), last(nullptr), sz(0) {}
+  List() : first(nullptr), last(nullptr), sz(0), nodeAlloc(), ownsArena(true) {}
+
+  /**
+   * @brief Constructor with an allocator. Initializes an empty list.
+   *
+   * Lists built from the same allocator share its memory, so splice_after
+   * between them relinks nodes instead of copying.
+   *
+   * @param alloc Allocator the nodes are taken from (rebound to the node type).
+   */
+  explicit List(const Alloc &alloc) : first(nullptr), last(nullptr), sz(0), nodeAlloc(alloc), ownsArena(false) {}
 
   /**
    * @brief Destructor. Deletes all nodes in the list.
    */
   ~List()
   {
-    freeNodes(first);
+    freeAll(HasRelease<NodeAlloc>());
   }
 
   /**
@@ -109,7 +275,7 @@ public:
    */
   void push_back(const T &val)
   {
-    Node *newNode = new Node(val);
+    Node *newNode = createNode(val);
     if (!empty())
     {
       last->setNext(newNode);
@@ -133,7 +299,7 @@ public:
     {
       if (first == last)
       {
-        delete first;
+        destroyNode(first);
         first = last = nullptr;
       }
       else
@@ -143,7 +309,7 @@ public:
         {
           temp = temp->getNext();
         }
-        delete last;
+        destroyNode(last);
         last = temp;
         last->setNext(nullptr);
       }
@@ -157,7 +323,7 @@ public:
    */
   void push_front(const T &val)
   {
-    Node *newNode = new Node(val);
+    Node *newNode = createNode(val);
     if (!empty())
     {
       newNode->setNext(first);
@@ -181,13 +347,13 @@ public:
     {
       if (first == last)
       {
-        delete first;
+        destroyNode(first);
         first = last = nullptr;
       }
       else
       {
         Node *temp = first->getNext();
-        delete first;
+        destroyNode(first);
         first = temp;
       }
       sz--;
@@ -261,7 +427,7 @@ public:
    */
   void clear()
   {
-    freeNodes(first);
+    freeAll(HasRelease<NodeAlloc>());
     first = last = nullptr;
     sz = 0;
   }
@@ -342,7 +508,7 @@ public:
     }
     else
     {
-      Node *newNode = new Node(val);
+      Node *newNode = createNode(val);
       Node *current = first;
       for (unsigned int i = 0; i < index - 1; i++)
       {
@@ -382,7 +548,7 @@ public:
     }
     Node *temp = current->getNext();
     current->setNext(temp->getNext());
-    delete temp;
+    destroyNode(temp);
     sz--;
   }
 
@@ -427,7 +593,7 @@ public:
    * @brief Copy constructor. Creates a deep copy of another list.
    * @param other List to copy.
    */
-  List(const List<T> &other)
+  List(const List &other) : nodeAlloc(), ownsArena(true)
   {
     first = last = nullptr;
     sz = 0;
@@ -443,7 +609,7 @@ public:
    * @brief Append the elements of another list to the end of this list.
    * @param other List whose elements will be appended.
    */
-  void push_back(const List<T> &other)
+  void push_back(const List &other)
   {
     if (other.empty())
       return;
@@ -460,35 +626,42 @@ public:
    * @brief Prepend the elements of another list to the beginning of this list.
    * @param other List whose elements will be prepended.
    */
-  void push_front(const List<T> &other)
+  void push_front(const List &other)
   {
     if (other.empty())
       return;
 
-    if (empty())
+    // Copiar los nodos de other en una cadena propia (con nuestro allocator)
+    // y enlazarla delante de first.
+    Node *chainFirst = createNode(other.first->getData());
+    Node *chainLast = chainFirst;
+    Node *current = other.first->getNext();
+    try
     {
-      Node *current = other.first;
       while (current != nullptr)
       {
-        push_back(current->getData());
+        Node *newNode = createNode(current->getData());
+        chainLast->setNext(newNode);
+        chainLast = newNode;
         current = current->getNext();
       }
+    }
+    catch (...)
+    {
+      freeNodes(chainFirst);
+      throw;
+    }
 
-      List *templist = new List(other);
-      templist->last->setNext(first);
-      first = templist->first;
-      if (last == nullptr)
-      {
-        last = templist->last;
-      }
-      sz += templist->sz;
-      templist->first = templist->last = nullptr;
-      templist->sz = 0;
-      delete templist;
+    chainLast->setNext(first);
+    if (last == nullptr)
+    {
+      last = chainLast;
     }
+    first = chainFirst;
+    sz += other.sz;
   }
 
-  List<T> &operator=(const List<T> &other)
+  List &operator=(const List &other)
   { // operador de asignacion
     if (this != &other)
     {          // Evitar autoasignación
@@ -500,6 +673,7 @@ public:
         current = current->getNext();
       }
     }
+    return *this;
   }
 
     /**
@@ -507,7 +681,7 @@ public:
  * @param other List to compare with.
  * @return true if lists are equal, false otherwise.
  */
-bool operator==(const List<T> &other) const {
+bool operator==(const List &other) const {
     if (sz != other.sz) {
         return false;
     }
@@ -525,6 +699,132 @@ bool operator==(const List<T> &other) const {
     
     return true;
  }
+
+  // ==================== ITERADORES ====================
+
+  /**
+   * @brief Get an iterator to the first element.
+   * @return Iterator to the first element (end() if the list is empty).
+   */
+  iterator begin() { return iterator(first); }
+
+  /**
+   * @brief Get an iterator past the last element.
+   * @return Iterator that compares equal to an iterator advanced past back().
+   */
+  iterator end() { return iterator(nullptr); }
+
+  const_iterator begin() const { return const_iterator(first); }
+  const_iterator end() const { return const_iterator(nullptr); }
+  const_iterator cbegin() const { return const_iterator(first); }
+  const_iterator cend() const { return const_iterator(nullptr); }
+
+  /**
+   * @brief Insert an element right after a position in O(1).
+   * @param pos Iterator to an element of this list.
+   * @param val Value to insert.
+   * @return Iterator to the inserted element.
+   * @throws std::out_of_range if pos is end().
+   */
+  iterator insert_after(const_iterator pos, const T &val)
+  {
+    if (pos.node == nullptr)
+    {
+      throw out_of_range("Cannot insert after end()");
+    }
+    if (pos.node == last)
+    {
+      push_back(val);
+      return iterator(last);
+    }
+    Node *newNode = createNode(val);
+    newNode->setNext(pos.node->getNext());
+    pos.node->setNext(newNode);
+    sz++;
+    return iterator(newNode);
+  }
+
+  /**
+   * @brief Remove the element right after a position in O(1).
+   * @param pos Iterator to an element of this list that is not the last one.
+   * @return Iterator to the element that followed the erased one.
+   * @throws std::out_of_range if there is no element after pos.
+   */
+  iterator erase_after(const_iterator pos)
+  {
+    if (pos.node == nullptr || pos.node == last)
+    {
+      throw out_of_range("No element after position");
+    }
+    Node *temp = pos.node->getNext();
+    pos.node->setNext(temp->getNext());
+    if (temp == last)
+    {
+      last = pos.node;
+    }
+    destroyNode(temp);
+    sz--;
+    return iterator(pos.node->getNext());
+  }
+
+  /**
+   * @brief Move all the elements of another list right after a position.
+   *
+   * When both lists use interchangeable allocators (e.g. std::allocator, or
+   * pools built from the same PoolAllocator) the nodes are relinked in O(1).
+   * Otherwise (e.g. each list has its own pool) the elements are copied and
+   * other is cleared.
+   *
+   * @param pos Iterator to an element of this list, or end() to append.
+   * @param other List whose elements are moved; it is left empty.
+   */
+  void splice_after(const_iterator pos, List &other)
+  {
+    if (this == &other || other.empty())
+    {
+      return;
+    }
+
+    Node *after = (pos.node == nullptr) ? last : pos.node;
+
+    if (!(nodeAlloc == other.nodeAlloc))
+    {
+      Node *current = other.first;
+      while (current != nullptr)
+      {
+        if (after == nullptr)
+        {
+          push_back(current->getData());
+          after = last;
+        }
+        else
+        {
+          after = insert_after(const_iterator(after), current->getData()).node;
+        }
+        current = current->getNext();
+      }
+      other.clear();
+      return;
+    }
+
+    if (after == nullptr)
+    {
+      first = other.first;
+      last = other.last;
+    }
+    else
+    {
+      other.last->setNext(after->getNext());
+      after->setNext(other.first);
+      if (after == last)
+      {
+        last = other.last;
+      }
+    }
+    sz += other.sz;
+    other.first = other.last = nullptr;
+    other.sz = 0;
+  }
 };
 
 #endif // LIST_HH
\ No newline at end of file